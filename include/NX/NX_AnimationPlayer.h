@@ -36,12 +36,17 @@ typedef struct NX_AnimationState {
  * On each update, it advances internal timers, interpolates keyframes,
  * blends active animations according to their weights, and updates the
  * current skeleton pose.
+ *
+ * The renderer caches the skinning palette computed from the current pose
+ * and only recomputes it when `poseVersion` changes. If you modify
+ * `currentPose` manually, increment `poseVersion` afterwards.
  */
 typedef struct NX_AnimationPlayer {
     const NX_AnimationLib* animLib; ///< Animation library providing available animations.
     const NX_Skeleton* skeleton;    ///< Target skeleton to animate.
     NX_AnimationState* states;      ///< Array of active animation states.
     NX_Mat4* currentPose;           ///< Array of bone transforms representing the blended pose.
+    uint32_t poseVersion;           ///< Incremented each time the current pose is recomputed.
 } NX_AnimationPlayer;
 
 // ============================================================================
@@ -75,7 +80,7 @@ NXAPI void NX_DestroyAnimationPlayer(NX_AnimationPlayer* player);
  *
  * This function interpolates keyframes, blends all active animation states,
  * and updates the current skeleton pose. The time step `dt` can be scaled
- * to modify playback speed.
+ * to modify playback speed. Each update increments the player's `poseVersion`.
  *
  * @param player Pointer to the animation player.
  * @param dt Delta time since the last update, in seconds.
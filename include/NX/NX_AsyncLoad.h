@@ -0,0 +1,92 @@
+/* NX_AsyncLoad.h -- API declaration for Nexium's asynchronous loading module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_ASYNC_LOAD_H
+#define NX_ASYNC_LOAD_H
+
+#include "./NX_API.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// ============================================================================
+// TYPES DEFINITIONS
+// ============================================================================
+
+/**
+ * @brief Status of an asynchronous load.
+ */
+typedef enum NX_AsyncStatus {
+    NX_ASYNC_PENDING,   ///< The resource is being read, decoded or uploaded.
+    NX_ASYNC_READY,     ///< The resource is available and can be retrieved.
+    NX_ASYNC_FAILED     ///< The resource could not be loaded, the reason is written to the logs.
+} NX_AsyncStatus;
+
+/**
+ * @brief Opaque handle to an asynchronous load.
+ *
+ * Returned by the NX_LoadXXXAsync functions. File I/O and decoding run on the
+ * job system workers, then GPU objects are created on the main thread during
+ * NX_FrameStep, within the per-frame upload budget.
+ */
+typedef struct NX_AsyncLoad NX_AsyncLoad;
+
+// ============================================================================
+// FUNCTIONS DECLARATIONS
+// ============================================================================
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * @brief Returns the current status of an asynchronous load without blocking.
+ * @param load Asynchronous load handle.
+ * @return The status of the load, NX_ASYNC_FAILED if the handle is NULL.
+ */
+NXAPI NX_AsyncStatus NX_PollAsyncLoad(const NX_AsyncLoad* load);
+
+/**
+ * @brief Blocks until an asynchronous load is finished.
+ *
+ * The calling thread helps running pending jobs, then the remaining GPU
+ * uploads of this load are performed immediately, ignoring the frame budget.
+ *
+ * @param load Asynchronous load handle.
+ * @return NX_ASYNC_READY on success, NX_ASYNC_FAILED otherwise.
+ * @note Must be called from the main thread.
+ */
+NXAPI NX_AsyncStatus NX_WaitAsyncLoad(NX_AsyncLoad* load);
+
+/**
+ * @brief Destroys an asynchronous load handle.
+ *
+ * If the load is still pending it is cancelled, and if its resource was
+ * never retrieved it is destroyed as well.
+ *
+ * @param load Asynchronous load handle, can be NULL.
+ */
+NXAPI void NX_DestroyAsyncLoad(NX_AsyncLoad* load);
+
+/**
+ * @brief Sets the budget of GPU uploads performed for asynchronous loads on each frame.
+ *
+ * Uploads are processed during NX_FrameStep until either limit is reached,
+ * at least one upload step is always performed per frame.
+ *
+ * @param milliseconds Maximum time spent per frame, if <= 0 the time is not limited.
+ * @param bytes Maximum amount of data uploaded per frame, if 0 the size is not limited.
+ * @note Default is 2 ms and 16 MB per frame.
+ */
+NXAPI void NX_SetAsyncUploadBudget(double milliseconds, size_t bytes);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // NX_ASYNC_LOAD_H
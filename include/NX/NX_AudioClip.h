@@ -11,6 +11,8 @@
 
 #include "./NX_API.h"
 #include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
 
 // ============================================================================
 // TYPES DEFINITIONS
@@ -18,6 +20,36 @@
 
 typedef struct NX_AudioClip NX_AudioClip;
 
+/**
+ * @brief Defines how the samples of a clip are kept in memory.
+ */
+typedef enum NX_AudioClipMode {
+    NX_AUDIO_CLIP_DECODED,          ///< Decoded to 16-bit PCM at load time. Largest, no delay on play.
+    NX_AUDIO_CLIP_COMPRESSED        ///< File kept as is, decoded on play into a bounded LRU cache.
+} NX_AudioClipMode;
+
+/**
+ * @brief Statistics of the decoded buffer cache of the compressed clips.
+ */
+typedef struct NX_AudioClipCacheStats {
+    size_t compressedBytes;     ///< Memory used by the files of the compressed clips.
+    size_t residentBytes;       ///< Memory used by their decoded buffers currently resident.
+    uint64_t hits;              ///< Number of plays served by a resident buffer.
+    uint64_t misses;            ///< Number of plays that had to decode the clip.
+    uint64_t evictions;         ///< Number of decoded buffers released to stay within the budget.
+} NX_AudioClipCacheStats;
+
+/**
+ * @brief Statistics of the voices shared by all audio clips.
+ */
+typedef struct NX_AudioVoiceStats {
+    int activeVoices;       ///< Number of clip channels currently playing.
+    int audibleVoices;      ///< Number of playing channels holding a real source.
+    int virtualVoices;      ///< Number of playing channels tracked without being heard.
+    int realSources;        ///< Number of real sources allocated so far.
+    uint64_t steals;        ///< Number of times a source was taken from a lower priority voice.
+} NX_AudioVoiceStats;
+
 // ============================================================================
 // FUNCTIONS DECLARATIONS
 // ============================================================================
@@ -29,11 +61,31 @@ extern "C" {
 /**
  * @brief Load a clip from a file
  * @param filePath Path to the clip file (supports WAV, FLAC, MP3, OGG)
- * @param channelCount Number of channels for polyphony (must be > 0)
+ * @param channelCount Number of channels for polyphony (must be > 0), they share the global voice pool
  * @return Clip pointer on success, NULL on failure
  */
 NXAPI NX_AudioClip* NX_LoadAudioClip(const char* filePath, int channelCount);
 
+/**
+ * @brief Load a clip from a file with the given memory mode
+ * @param filePath Path to the clip file (supports WAV, FLAC, MP3, OGG)
+ * @param channelCount Number of channels for polyphony (must be > 0)
+ * @param mode Whether the clip is decoded now or kept compressed until played
+ * @return Clip pointer on success, NULL on failure
+ */
+NXAPI NX_AudioClip* NX_LoadAudioClipEx(const char* filePath, int channelCount, NX_AudioClipMode mode);
+
+/**
+ * @brief Load several clips at once, reading and decoding the files on the job system workers
+ * @param filePaths Paths to the clip files
+ * @param count Number of files
+ * @param channelCount Number of channels for polyphony of each clip (must be > 0)
+ * @param mode Whether the clips are decoded now or kept compressed until played
+ * @param clips Receives one clip pointer per file, NULL for the files that failed to load
+ * @return Number of clips loaded
+ */
+NXAPI int NX_LoadAudioClipBank(const char* const* filePaths, int count, int channelCount, NX_AudioClipMode mode, NX_AudioClip** clips);
+
 /**
  * @brief Destroy a loaded clip and free all associated resources
  * @param clip Clip pointer to destroy
@@ -84,6 +136,68 @@ NXAPI bool NX_IsAudioClipPlaying(NX_AudioClip* clip, int channel);
  */
 NXAPI int NX_GetAudioClipChannelCount(NX_AudioClip* clip);
 
+/**
+ * @brief Set the priority of a clip when voices compete for real sources
+ *
+ * Clip channels share a bounded pool of real sources. When it is full, a new
+ * sound takes the source of the lowest priority voice (the oldest one first)
+ * as long as that priority is not higher than its own, otherwise it plays as
+ * a virtual voice: inaudible, but still advancing, and made audible again at
+ * its current position once a source frees up.
+ *
+ * @param clip Clip pointer
+ * @param priority Priority, higher values are kept audible first (0 by default)
+ */
+NXAPI void NX_SetAudioClipPriority(NX_AudioClip* clip, int priority);
+
+/**
+ * @brief Get the priority of a clip
+ * @param clip Clip pointer
+ * @return Priority of the clip
+ */
+NXAPI int NX_GetAudioClipPriority(const NX_AudioClip* clip);
+
+/**
+ * @brief Set the maximum number of real sources shared by all clips
+ * @param limit Number of sources (32 by default), the driver limit still applies
+ */
+NXAPI void NX_SetAudioVoiceLimit(int limit);
+
+/**
+ * @brief Get the maximum number of real sources shared by all clips
+ * @return Number of sources
+ */
+NXAPI int NX_GetAudioVoiceLimit(void);
+
+/**
+ * @brief Get the statistics of the clip voices
+ * @return Current voice counts
+ */
+NXAPI NX_AudioVoiceStats NX_GetAudioVoiceStats(void);
+
+/**
+ * @brief Set the memory budget of the decoded buffers of compressed clips
+ * @param bytes Budget in bytes (32 MB by default), buffers of audible clips are never evicted
+ */
+NXAPI void NX_SetAudioClipCacheBudget(size_t bytes);
+
+/**
+ * @brief Get the memory budget of the decoded buffers of compressed clips
+ * @return Budget in bytes
+ */
+NXAPI size_t NX_GetAudioClipCacheBudget(void);
+
+/**
+ * @brief Get the statistics of the compressed clip cache
+ * @return Memory usage and counters
+ */
+NXAPI NX_AudioClipCacheStats NX_GetAudioClipCacheStats(void);
+
+/**
+ * @brief Reset the hit, miss and eviction counters of the compressed clip cache
+ */
+NXAPI void NX_ResetAudioClipCacheStats(void);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -11,6 +11,7 @@
 
 #include "./NX_API.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 // ============================================================================
 // TYPES DEFINITIONS
@@ -18,6 +19,15 @@
 
 typedef struct NX_AudioStream NX_AudioStream;
 
+/**
+ * @brief Statistics of the audio stream player, shared by all streams.
+ */
+typedef struct NX_AudioStreamStats {
+    int activeStreams;          ///< Number of streams currently handled by the stream thread.
+    uint64_t decodedBuffers;    ///< Number of buffers decoded ahead by the workers since the last reset.
+    uint64_t underruns;         ///< Number of times a playing source ran out of queued buffers since the last reset.
+} NX_AudioStreamStats;
+
 // ============================================================================
 // FUNCTIONS DECLARATIONS
 // ============================================================================
@@ -33,6 +43,21 @@ extern "C" {
  */
 NXAPI NX_AudioStream* NX_LoadAudioStream(const char* filePath);
 
+/**
+ * @brief Load stream from a file with a custom buffering
+ *
+ * More or larger buffers make underruns less likely at the cost of memory
+ * and of a longer delay before stop/rewind commands are heard. The stream
+ * thread wakes up when a buffer is about to be consumed, so smaller buffers
+ * also mean more frequent wakeups.
+ *
+ * @param filePath Path to the stream file
+ * @param bufferCount Number of queued buffers, clamped to [2, 8] (3 by default)
+ * @param bufferFrames Number of frames per buffer, clamped to [256, 65536] (8192 by default)
+ * @return Stream pointer on success, NULL on failure
+ */
+NXAPI NX_AudioStream* NX_LoadAudioStreamEx(const char* filePath, int bufferCount, int bufferFrames);
+
 /**
  * @brief Destroy loaded stream
  * @param stream Stream pointer
@@ -91,6 +116,17 @@ NXAPI void NX_SetAudioStreamLoop(NX_AudioStream* stream, bool loop);
  */
 NXAPI float NX_GetAudioStreamDuration(const NX_AudioStream* stream);
 
+/**
+ * @brief Get the statistics of the audio stream player
+ * @return Statistics shared by all streams
+ */
+NXAPI NX_AudioStreamStats NX_GetAudioStreamStats(void);
+
+/**
+ * @brief Reset the decoded buffer and underrun counters
+ */
+NXAPI void NX_ResetAudioStreamStats(void);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -76,9 +76,26 @@ NXAPI void NX_DestroyDynamicMesh(NX_DynamicMesh* dynMesh);
  */
 NXAPI void NX_BeginDynamicMesh(NX_DynamicMesh* dynMesh, NX_PrimitiveType type, NX_DynamicMeshFlags flags);
 
+/**
+ * @brief Begins recording geometry appended to the existing one.
+ *
+ * Unlike NX_BeginDynamicMesh, the previously recorded geometry is kept and
+ * only the new vertices and indices are processed and uploaded by
+ * NX_EndDynamicMesh. The primitive type and generation flags are kept.
+ *
+ * @param dynMesh Pointer to the dynamic mesh (cannot be NULL).
+ * @note Best suited to list primitives, appended strips or fans are not joined to the existing ones.
+ */
+NXAPI void NX_AppendDynamicMesh(NX_DynamicMesh* dynMesh);
+
 /**
  * @brief Ends recording and uploads geometry to the GPU.
  *
+ * Only the geometry recorded since the last NX_BeginDynamicMesh or
+ * NX_AppendDynamicMesh is processed and uploaded, through a persistently
+ * mapped staging buffer copied on the GPU, so the call never waits for
+ * the GPU to finish drawing the previous frames.
+ *
  * Reallocates memory on the GPU if necessary.
  *
  * @param dynMesh Pointer to the dynamic mesh (cannot be NULL).
@@ -127,6 +144,18 @@ NXAPI void NX_SetDynamicMeshColor(NX_DynamicMesh* dynMesh, NX_Color color);
  */
 NXAPI void NX_AddDynamicMeshVertex(NX_DynamicMesh* dynMesh, NX_Vec3 position);
 
+/**
+ * @brief Adds an index to the dynamic mesh.
+ *
+ * Once a dynamic mesh has indices it is drawn indexed, vertices that
+ * are not referenced by any index are then not drawn.
+ *
+ * @param dynMesh Pointer to the dynamic mesh (cannot be NULL).
+ * @param index Index of a vertex, relative to the first vertex recorded
+ *              since the last NX_BeginDynamicMesh or NX_AppendDynamicMesh.
+ */
+NXAPI void NX_AddDynamicMeshIndex(NX_DynamicMesh* dynMesh, uint32_t index);
+
 /**
  * @brief Sets the shadow casting mode for a dynamic mesh.
  *
@@ -65,6 +65,50 @@ NXAPI NX_Font* NX_LoadFont(const char* filePath, NX_FontType type, int baseSize,
  */
 NXAPI NX_Font* NX_LoadFontFromData(const void* fileData, size_t dataSize, NX_FontType type, int baseSize, const int* codepoints, int codepointCount);
 
+/**
+ * @brief Loads a font from a file, rasterizing its glyphs on first use.
+ * @param filePath Path to the font file.
+ * @param type Font type (bitmap or SDF).
+ * @param baseSize Base size of the font in pixels.
+ * @return Pointer to a newly loaded NX_Font, or NULL on failure.
+ * @note Suited to large character sets such as CJK, only the glyphs actually drawn are rasterized.
+ * @note Glyphs are kept in atlas pages of 1024x1024 pixels; once four pages are full,
+ *       the least recently drawn glyphs are evicted to make room for new ones.
+ */
+NXAPI NX_Font* NX_LoadDynamicFont(const char* filePath, NX_FontType type, int baseSize);
+
+/**
+ * @brief Loads a font from memory, rasterizing its glyphs on first use.
+ * @param fileData Pointer to font file data in memory, copied by the font.
+ * @param dataSize Size of the font data in bytes.
+ * @param type Font type (bitmap or SDF).
+ * @param baseSize Base size of the font in pixels.
+ * @return Pointer to a newly loaded NX_Font, or NULL on failure.
+ * @see NX_LoadDynamicFont
+ */
+NXAPI NX_Font* NX_LoadDynamicFontFromData(const void* fileData, size_t dataSize, NX_FontType type, int baseSize);
+
+/**
+ * @brief Sets the directory where generated font atlases are cached.
+ *
+ * When set, each atlas generated by NX_LoadFont or NX_LoadFontFromData is saved
+ * with its glyph metrics, keyed by a hash of the font data, type, base size and
+ * codepoints. Loading the same font again reads the cache and skips rasterization.
+ *
+ * @param dirPath Directory relative to the write directory, or NULL to disable caching (default).
+ * @note Caches are written in the write directory, which must also be mounted as a
+ *       search path for them to be found again (see NX_SetWriteDir and NX_AddSearchPath).
+ * @note Caches use the native data layout of the platform and carry a format version;
+ *       an outdated cache is ignored and regenerated.
+ */
+NXAPI void NX_SetFontCacheDir(const char* dirPath);
+
+/**
+ * @brief Returns the directory where generated font atlases are cached.
+ * @return The directory set with NX_SetFontCacheDir, or NULL if caching is disabled.
+ */
+NXAPI const char* NX_GetFontCacheDir(void);
+
 /**
  * @brief Destroys a font and frees its resources.
  * @param font Pointer to the NX_Font to destroy.
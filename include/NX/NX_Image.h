@@ -33,10 +33,27 @@ typedef enum NX_PixelFormat {
     NX_PIXEL_FORMAT_RG32F,      ///< Dual channel 32-bit float red-green
     NX_PIXEL_FORMAT_RGB32F,     ///< Three channel 32-bit float red-green-blue
     NX_PIXEL_FORMAT_RGBA32F,    ///< Four channel 32-bit float red-green-blue-alpha
+    NX_PIXEL_FORMAT_BC1,        ///< Block compressed RGB with 1-bit alpha, 8 bytes per 4x4 block (DXT1)
+    NX_PIXEL_FORMAT_BC3,        ///< Block compressed RGBA, 16 bytes per 4x4 block (DXT5)
+    NX_PIXEL_FORMAT_BC4,        ///< Block compressed single channel red, 8 bytes per 4x4 block (RGTC1)
+    NX_PIXEL_FORMAT_BC5,        ///< Block compressed dual channel red-green, 16 bytes per 4x4 block (RGTC2)
+    NX_PIXEL_FORMAT_BC7,        ///< Block compressed high quality RGBA, 16 bytes per 4x4 block (BPTC)
 } NX_PixelFormat;
 
+/**
+ * @brief Filters used to generate mipmaps on the CPU
+ */
+typedef enum NX_MipmapFilter {
+    NX_MIPMAP_FILTER_BOX,       ///< Average of 2x2 texels, fastest but blurry
+    NX_MIPMAP_FILTER_KAISER,    ///< Kaiser windowed sinc, sharp with little ringing
+    NX_MIPMAP_FILTER_LANCZOS,   ///< Lanczos-3 windowed sinc, sharpest but may ring on hard edges
+} NX_MipmapFilter;
+
 /**
  * @brief Image data structure
+ *
+ * For block compressed formats, 'pixels' holds the encoded blocks,
+ * row by row, with partial blocks on the right and bottom edges.
  */
 typedef struct NX_Image {
     void* pixels;               ///< Pointer to pixel data buffer
@@ -80,8 +97,12 @@ NXAPI NX_Image NX_CreateImageFromData(const void* pixels, int w, int h, NX_Pixel
 /**
  * @brief Load and decode an image from file
  *
- * Supports the following formats: PNG, TGA, HDR, JPG, BMP, PIC, PNM.
+ * Supports the following formats: PNG, TGA, HDR, JPG, BMP, PIC, PNM, DDS, KTX2.
  * Automatically converts L/LA images to RGB/RGBA and selects the appropriate pixel format.
+ * DDS and KTX2 containers are returned as stored, block compressed ones included,
+ * only their first mip level is kept (use NX_LoadTexture to upload all levels).
+ * Their sRGB formats are loaded as the UNORM equivalent, the texels are used as
+ * they would be from a PNG or JPG image.
  *
  * @param filePath Path to the image file
  * @return Decoded image, ready for use in rendering, or empty image on failure
@@ -102,8 +123,10 @@ NXAPI NX_Image NX_LoadImageRaw(const char* filePath);
 /**
  * @brief Decode an image from memory buffer
  *
- * Supports the following formats: PNG, TGA, HDR, JPG, BMP, PIC, PNM.
+ * Supports the following formats: PNG, TGA, HDR, JPG, BMP, PIC, PNM, DDS, KTX2.
  * Automatically converts L/LA images to RGB/RGBA and selects the appropriate pixel format.
+ * DDS and KTX2 containers are returned as stored, only their first mip level is kept.
+ * Their sRGB formats are loaded as the UNORM equivalent, as for NX_LoadImage.
  *
  * @param data Pointer to encoded image data in memory
  * @param size Size of the encoded data in bytes
@@ -217,7 +240,8 @@ NXAPI NX_Image NX_CopyImage(const NX_Image* image, NX_PixelFormat format);
  *                corresponding output channel (0 = red, 1 = green, 2 = blue).
  * @param defaultColor Default color used for channels when the corresponding source is NULL.
  *
- * @return New composed RGB image, or an empty image if the composition fails.
+ * @return New composed RGB image, or an empty image if the composition fails
+ *         or if a source is block compressed.
  *
  * @note This function is particularly useful for composing ORM (Occlusion/Roughness/Metalness)
  *       textures from separate grayscale sources.
@@ -233,7 +257,8 @@ NXAPI NX_Image NX_ComposeImagesRGB(const NX_Image* sources[3], NX_Color defaultC
 /**
  * @brief Set a pixel color at specific coordinates with bounds checking
  *
- * Performs boundary and validity checks before setting the pixel.
+ * Performs boundary and validity checks before setting the pixel,
+ * block compressed images are left unchanged.
  * Use NX_WritePixel for better performance if bounds checking is not needed.
  *
  * @param image Target image
@@ -246,7 +271,8 @@ NXAPI void NX_SetImagePixel(const NX_Image* image, int x, int y, NX_Color color)
 /**
  * @brief Get a pixel color at specific coordinates with bounds checking
  *
- * Performs boundary and validity checks before reading the pixel.
+ * Performs boundary and validity checks before reading the pixel,
+ * block compressed images return the default color.
  * Use NX_ReadPixel for better performance if bounds checking is not needed.
  *
  * @param image Source image
@@ -269,7 +295,7 @@ NXAPI void NX_ConvertImage(NX_Image* image, NX_PixelFormat format);
  * Inverts all color channels using the formula: result = 1.0 - color
  * Alpha channel is preserved if present.
  *
- * @param image Image to invert (modified in place)
+ * @param image Image to invert (modified in place), must be uncompressed
  */
 NXAPI void NX_InvertImage(const NX_Image* image);
 
@@ -278,7 +304,7 @@ NXAPI void NX_InvertImage(const NX_Image* image);
  *
  * Copies and scales a rectangular region from the source image to a rectangular region in the
  * destination image using nearest neighbor sampling with fixed-point 16.16 arithmetic.
- * Regions are automatically clamped to image boundaries.
+ * Regions are automatically clamped to image boundaries. Both images must be uncompressed.
  *
  * @param src Source image to copy from
  * @param srcX Source rectangle X coordinate
@@ -295,10 +321,69 @@ NXAPI void NX_BlitImage(
     const NX_Image* src, int srcX, int srcY, int srcW, int srcH,
     const NX_Image* dst, int dstX, int dstY, int dstW, int dstH);
 
+/**
+ * @brief Generates the full mip chain of an image on the CPU.
+ *
+ * Each level is resampled from the previous one with the given filter, down to 1x1,
+ * splitting the work across the job system workers. Unlike GPU generated mipmaps,
+ * the result does not depend on the driver and can be uploaded with NX_CreateTextureFromMipmaps.
+ *
+ * @param image Source image, must be uncompressed
+ * @param filter Resampling filter
+ * @param srgb Whether the color channels of 8-bit images are filtered in linear space
+ *             (set it for color maps, not for data such as normals or roughness)
+ * @param alphaCutoff If greater than zero, the alpha of each level is scaled so that the
+ *                    fraction of texels above this cutoff matches the base image
+ *                    (keeps alpha tested foliage or fences from thinning out with distance)
+ * @param levelCount Receives the number of levels, base level included
+ * @return Array of levels, the first one being a copy of the image, or NULL on failure.
+ *         Must be released with NX_DestroyImageMipmaps.
+ * @note Texels outside the image are clamped to its edges.
+ */
+NXAPI NX_Image* NX_GenImageMipmaps(const NX_Image* image, NX_MipmapFilter filter, bool srgb, float alphaCutoff, int* levelCount);
+
+/**
+ * @brief Releases the levels returned by NX_GenImageMipmaps
+ * @param levels Array of levels (can be NULL)
+ * @param levelCount Number of levels in the array
+ */
+NXAPI void NX_DestroyImageMipmaps(NX_Image* levels, int levelCount);
+
+/**
+ * @brief Compress an image into a block compressed format
+ *
+ * Encodes the image on the CPU, splitting the work across the job system workers.
+ * Images that are not RGBA8 are converted first. BC4 keeps the red channel and
+ * BC5 the red and green channels, BC1 keeps alpha as a 1-bit cutout.
+ *
+ * @param image Source image, must be uncompressed
+ * @param format Target block compressed format
+ * @return New compressed image, or an empty image on failure
+ * @note Encoding is meant for import time, the result can be kept in a model
+ *       cache (see NX_SaveModelCacheEx) to avoid paying it on every load.
+ */
+NXAPI NX_Image NX_CompressImage(const NX_Image* image, NX_PixelFormat format);
+
+/**
+ * @brief Check whether a pixel format is block compressed
+ * @param format The pixel format
+ * @return true for the BC formats, false otherwise
+ */
+NXAPI bool NX_IsPixelFormatCompressed(NX_PixelFormat format);
+
+/**
+ * @brief Get the size in bytes of an image of the given dimensions and format
+ * @param w Image width in pixels
+ * @param h Image height in pixels
+ * @param format The pixel format, block compressed formats are supported
+ * @return Size of the pixel data in bytes, 0 if the format is invalid
+ */
+NXAPI size_t NX_GetImageDataSize(int w, int h, NX_PixelFormat format);
+
 /**
  * @brief Get the number of bytes per pixel for a given format
  * @param format The pixel format
- * @return Number of bytes per pixel
+ * @return Number of bytes per pixel, 0 for block compressed formats
  */
 NXAPI int NX_GetPixelBytes(NX_PixelFormat format);
 
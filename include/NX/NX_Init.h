@@ -78,6 +78,10 @@ typedef struct NX_AppDesc {
         int sampleCount;        ///< MSAA sample count for 2D rendering, if <= 1 disables MSAA
     } render2D;
 
+    struct {
+        int workerCount;        ///< Number of job worker threads, if 0 uses the number of logical cores minus one, if < 0 jobs run on the calling thread
+    } jobs;
+
     /**
      * @brief Custom memory allocator functions
      *
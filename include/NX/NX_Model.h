@@ -10,6 +10,7 @@
 #define NX_MODEL_H
 
 #include "./NX_AnimationPlayer.h"
+#include "./NX_AsyncLoad.h"
 #include "./NX_Material.h"
 #include "./NX_Skeleton.h"
 #include "./NX_Mesh.h"
@@ -51,6 +52,8 @@ extern "C" {
  * @brief Loads a 3D model from a file.
  * @param filePath Path to the model file.
  * @return Pointer to a newly loaded NX_Model containing meshes and materials.
+ * @note Model caches written by NX_SaveModelCache are detected from their content
+ *       and loaded directly, without going through the regular import.
  */
 NXAPI NX_Model* NX_LoadModel(const char* filePath);
 
@@ -63,6 +66,58 @@ NXAPI NX_Model* NX_LoadModel(const char* filePath);
  */
 NXAPI NX_Model* NX_LoadModelFromData(const void* data, size_t size, const char* hint);
 
+/**
+ * @brief Starts loading a 3D model in the background.
+ *
+ * The file is read, imported and its images decoded on the job system workers,
+ * then meshes and textures are created on the main thread during NX_FrameStep,
+ * a few at a time according to the upload budget (see NX_SetAsyncUploadBudget).
+ *
+ * @param filePath Path to the model file.
+ * @return Handle to poll or wait on, NULL on failure. Must be destroyed with NX_DestroyAsyncLoad.
+ * @note Model caches written by NX_SaveModelCache are supported as well.
+ */
+NXAPI NX_AsyncLoad* NX_LoadModelAsync(const char* filePath);
+
+/**
+ * @brief Retrieves the model of a finished asynchronous load.
+ * @param load Handle returned by NX_LoadModelAsync.
+ * @return The loaded model, or NULL if the load is not ready, has failed, or the model was already retrieved.
+ * @note Once retrieved, the model is owned by the caller and is no longer destroyed with the handle.
+ */
+NXAPI NX_Model* NX_GetAsyncModel(NX_AsyncLoad* load);
+
+/**
+ * @brief Converts a 3D model file into a Nexium binary model cache (.nxm).
+ *
+ * The source file is imported once, then its meshes, materials (with their decoded
+ * textures), skeleton and animations are written in a GPU-ready layout.
+ * NX_LoadModel, NX_LoadSkeleton and NX_LoadAnimationLib recognize these files and
+ * upload their content as is, with no per-vertex or per-pixel processing.
+ *
+ * @param filePath Path to the source model file.
+ * @param cachePath Path of the cache file to write, relative to the write directory.
+ * @return true on success, false otherwise.
+ * @note The cache uses the native data layout of the platform and is tied to the
+ *       cache format version; an outdated cache is rejected and must be regenerated.
+ */
+NXAPI bool NX_SaveModelCache(const char* filePath, const char* cachePath);
+
+/**
+ * @brief Converts a 3D model file into a Nexium binary model cache (.nxm), with texture compression.
+ *
+ * Same as NX_SaveModelCache, but 8-bit textures can be block compressed on the CPU before being
+ * written, so that the encoding cost is paid once at import time. ORM maps are stored as BC1 and
+ * the other maps as BC7, which reduces their memory and sampling bandwidth by 4 to 8 times.
+ *
+ * @param filePath Path to the source model file.
+ * @param cachePath Path of the cache file to write, relative to the write directory.
+ * @param compressTextures Whether 8-bit textures are block compressed.
+ * @return true on success, false otherwise.
+ * @note Loading a compressed cache requires BC1 and BC7 support, see NX_IsTextureFormatSupported.
+ */
+NXAPI bool NX_SaveModelCacheEx(const char* filePath, const char* cachePath, bool compressTextures);
+
 /**
  * @brief Destroys a 3D model and frees its resources.
  * @param model Pointer to the NX_Model to destroy.
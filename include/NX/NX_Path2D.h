@@ -0,0 +1,140 @@
+/* NX_Path2D.h -- API declaration for Nexium's 2D path module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_PATH_2D_H
+#define NX_PATH_2D_H
+
+#include "./NX_Math.h"
+#include "./NX_API.h"
+
+// ============================================================================
+// TYPES DEFINITIONS
+// ============================================================================
+
+/**
+ * @brief Opaque handle to a tessellated 2D path.
+ *
+ * Lines, curves and arcs are flattened into polylines once when they are added,
+ * the path can then be drawn every frame through the current 2D transform
+ * without evaluating any curve or trigonometric function again.
+ */
+typedef struct NX_Path2D NX_Path2D;
+
+// ============================================================================
+// FUNCTIONS DECLARATIONS
+// ============================================================================
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * @brief Creates an empty path.
+ * @return Pointer to the new path, or NULL on failure.
+ */
+NXAPI NX_Path2D* NX_CreatePath2D(void);
+
+/**
+ * @brief Destroys a path.
+ * @param path Path to destroy, can be NULL.
+ */
+NXAPI void NX_DestroyPath2D(NX_Path2D* path);
+
+/**
+ * @brief Removes every point of a path, keeping its storage.
+ * @param path Path to clear.
+ */
+NXAPI void NX_ClearPath2D(NX_Path2D* path);
+
+/**
+ * @brief Starts a new sub-path at the given point.
+ * @param path Path to extend.
+ * @param point Start of the sub-path.
+ */
+NXAPI void NX_PathMoveTo2D(NX_Path2D* path, NX_Vec2 point);
+
+/**
+ * @brief Adds a straight line from the last point.
+ * @param path Path to extend.
+ * @param point End of the line.
+ * @note Starts a sub-path at this point if the path is empty.
+ */
+NXAPI void NX_PathLineTo2D(NX_Path2D* path, NX_Vec2 point);
+
+/**
+ * @brief Adds a quadratic bezier curve from the last point.
+ * @param path Path to extend.
+ * @param control Control point of the curve.
+ * @param point End of the curve.
+ * @param segments Number of segments the curve is flattened into.
+ * @note Requires a start point, on an empty path a warning is logged and the sub-path starts at the end point.
+ */
+NXAPI void NX_PathBezierQuadTo2D(NX_Path2D* path, NX_Vec2 control, NX_Vec2 point, int segments);
+
+/**
+ * @brief Adds a cubic bezier curve from the last point.
+ * @param path Path to extend.
+ * @param control0 First control point of the curve.
+ * @param control1 Second control point of the curve.
+ * @param point End of the curve.
+ * @param segments Number of segments the curve is flattened into.
+ * @note Requires a start point, on an empty path a warning is logged and the sub-path starts at the end point.
+ */
+NXAPI void NX_PathBezierCubicTo2D(NX_Path2D* path, NX_Vec2 control0, NX_Vec2 control1, NX_Vec2 point, int segments);
+
+/**
+ * @brief Adds a circular arc, joined to the last point by a straight line.
+ * @param path Path to extend.
+ * @param center Center of the arc.
+ * @param radius Radius of the arc.
+ * @param startAngle Start angle in radians.
+ * @param endAngle End angle in radians, the arc goes clockwise on screen when it is greater than the start angle.
+ * @note The sweep is clamped to one full turn in either direction, so a sweep of 2*PI draws a full circle.
+ * @param segments Number of segments the arc is flattened into.
+ */
+NXAPI void NX_PathArc2D(NX_Path2D* path, NX_Vec2 center, float radius, float startAngle, float endAngle, int segments);
+
+/**
+ * @brief Adds a closed rectangle with rounded corners as a new sub-path.
+ * @param path Path to extend.
+ * @param x X position of the top-left corner.
+ * @param y Y position of the top-left corner.
+ * @param w Width of the rectangle.
+ * @param h Height of the rectangle.
+ * @param radius Radius of the corners, clamped to half the smallest side.
+ * @param segments Number of segments per corner.
+ */
+NXAPI void NX_PathRectRounded2D(NX_Path2D* path, float x, float y, float w, float h, float radius, int segments);
+
+/**
+ * @brief Closes the current sub-path, joining its last point to its first one.
+ * @param path Path to close.
+ */
+NXAPI void NX_ClosePath2D(NX_Path2D* path);
+
+/**
+ * @brief Gets the number of points of a path once tessellated.
+ * @param path Path to query.
+ * @return Number of points, every sub-path included.
+ */
+NXAPI int NX_GetPath2DPointCount(const NX_Path2D* path);
+
+/**
+ * @brief Gets the bounds of a path.
+ * @param path Path to query.
+ * @param min Receives the minimum corner, can be NULL.
+ * @param max Receives the maximum corner, can be NULL.
+ * @note Both corners are zero for an empty path.
+ */
+NXAPI void NX_GetPath2DBounds(const NX_Path2D* path, NX_Vec2* min, NX_Vec2* max);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // NX_PATH_2D_H
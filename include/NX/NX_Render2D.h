@@ -10,13 +10,40 @@
 #define NX_RENDER_2D_H
 
 #include "./NX_RenderTexture.h"
+#include "./NX_SpriteAtlas.h"
+#include "./NX_TextLayout.h"
 #include "./NX_Shader2D.h"
+#include "./NX_Path2D.h"
 #include "./NX_Texture.h"
 #include "./NX_Vertex.h"
 #include "./NX_Font.h"
 #include "./NX_Math.h"
 #include "./NX_API.h"
 
+// ============================================================================
+// TYPES DEFINITIONS
+// ============================================================================
+
+/**
+ * @brief Defines the order in which the 2D draws are submitted.
+ */
+typedef enum NX_BatchMode2D {
+    NX_BATCH_2D_IMMEDIATE,      ///< Submission order, consecutive draws sharing the same state are merged.
+    NX_BATCH_2D_SORTED          ///< Sorted by layer, then grouped by shader and texture or font where draws do not overlap.
+} NX_BatchMode2D;
+
+/**
+ * @brief Statistics of the 2D renderer, accumulated until reset.
+ */
+typedef struct NX_Render2DStats {
+    uint64_t flushes;           ///< Number of batches uploaded, one per NX_End2D() unless the batch mode changes.
+    uint64_t drawCalls;         ///< Number of draw calls submitted.
+    uint64_t vertices;          ///< Number of vertices uploaded.
+    uint64_t indices;           ///< Number of indices uploaded.
+    uint64_t quads;             ///< Number of quads uploaded as single instances rather than vertices.
+    uint64_t culled;            ///< Number of primitives skipped because they were entirely outside the target.
+} NX_Render2DStats;
+
 // ============================================================================
 // FUNCTIONS DECLARATIONS
 // ============================================================================
@@ -41,6 +68,17 @@ NXAPI void NX_Begin2D(NX_RenderTexture* target);
  */
 NXAPI void NX_End2D(void);
 
+/**
+ * @brief Gets the statistics of the 2D renderer.
+ * @return Counters accumulated since the last call to NX_ResetRender2DStats().
+ */
+NXAPI NX_Render2DStats NX_GetRender2DStats(void);
+
+/**
+ * @brief Resets the statistics of the 2D renderer.
+ */
+NXAPI void NX_ResetRender2DStats(void);
+
 /**
  * @brief Sets the default color for 2D drawing.
  * @param color Color to use for subsequent 2D drawing operations.
@@ -69,6 +107,36 @@ NXAPI void NX_SetFont2D(const NX_Font* font);
  */
 NXAPI void NX_SetShader2D(NX_Shader2D* shader);
 
+/**
+ * @brief Sets how the following 2D draws are batched.
+ * @param mode Batch mode to use.
+ * @note The pending draws are submitted when the mode changes.
+ * @note In sorted mode, layers are drawn in ascending order. Inside a layer, a draw is
+ *       moved back to an earlier draw sharing its shader and texture only if it does not
+ *       overlap the draws in between, so overlapping draws keep their submission order.
+ * @note The default mode is NX_BATCH_2D_IMMEDIATE.
+ */
+NXAPI void NX_SetBatchMode2D(NX_BatchMode2D mode);
+
+/**
+ * @brief Gets the current 2D batch mode.
+ * @return The current batch mode.
+ */
+NXAPI NX_BatchMode2D NX_GetBatchMode2D(void);
+
+/**
+ * @brief Sets the layer of the following 2D draws.
+ * @param layer Layer key, lower layers are drawn first.
+ * @note The layer is only used in NX_BATCH_2D_SORTED mode. The default layer is 0.
+ */
+NXAPI void NX_SetLayer2D(int layer);
+
+/**
+ * @brief Gets the current 2D layer.
+ * @return The current layer key.
+ */
+NXAPI int NX_GetLayer2D(void);
+
 /**
  * @brief Pushes the current 2D transformation matrix onto the stack.
  * @note Maximum stack depth is 16 matrices.
@@ -184,9 +252,23 @@ NXAPI void NX_DrawQuadEx2D(const NX_Vertex2D* v0, const NX_Vertex2D* v1, const N
  * @param y Y-coordinate of the rectangle's top-left corner.
  * @param w Width of the rectangle.
  * @param h Height of the rectangle.
+ * @note Drawn as a single GPU instance, or as regular vertices when it follows other shapes of the same batch.
  */
 NXAPI void NX_DrawRect2D(float x, float y, float w, float h);
 
+/**
+ * @brief Draws a sprite of an atlas as a textured rectangle in 2D.
+ * @param atlas Atlas containing the sprite.
+ * @param sprite Sprite handle returned by the atlas.
+ * @param x X-coordinate of the rectangle's top-left corner.
+ * @param y Y-coordinate of the rectangle's top-left corner.
+ * @param w Width of the rectangle.
+ * @param h Height of the rectangle.
+ * @note The page texture of the sprite replaces the current texture for this draw only,
+ *       so sprites sharing a page are batched together whatever the current texture is.
+ */
+NXAPI void NX_DrawSprite2D(const NX_SpriteAtlas* atlas, int sprite, float x, float y, float w, float h);
+
 /**
  * @brief Draws the border of a rectangle in 2D.
  * @param x X-coordinate of the rectangle's top-left corner.
@@ -358,6 +440,22 @@ NXAPI void NX_DrawBezierCubic2D(NX_Vec2 p0, NX_Vec2 p1, NX_Vec2 p2, NX_Vec2 p3,
  */
 NXAPI void NX_DrawSpline2D(const NX_Vec2* points, int count, int segments, float thickness);
 
+/**
+ * @brief Draws the outline of a tessellated path in 2D.
+ * @param path Path to draw, tessellated once when it was built.
+ * @param thickness Line thickness: positive = pixels, negative = scaled by transformation.
+ * @note Closed sub-paths are joined back to their first point.
+ */
+NXAPI void NX_DrawPath2D(const NX_Path2D* path, float thickness);
+
+/**
+ * @brief Draws a tessellated path filled in 2D.
+ * @param path Path to draw, tessellated once when it was built.
+ * @note Each sub-path is filled as a triangle fan, so only convex sub-paths are filled correctly.
+ * @note Texture coordinates map the bounds of the path to [0, 1].
+ */
+NXAPI void NX_DrawPathFilled2D(const NX_Path2D* path);
+
 /**
  * @brief Draws a single Unicode codepoint in 2D.
  * @param codepoint Unicode codepoint to draw.
@@ -385,6 +483,14 @@ NXAPI void NX_DrawCodepoints2D(const int* codepoints, int length, NX_Vec2 positi
  */
 NXAPI void NX_DrawText2D(const char* text, NX_Vec2 position, float fontSize, NX_Vec2 spacing);
 
+/**
+ * @brief Draws a pre-shaped text layout in 2D.
+ * @param layout Layout to draw.
+ * @param position Position of the top-left corner of the layout in 2D space.
+ * @note The font of the layout is used instead of the current font, the current color and transform apply.
+ */
+NXAPI void NX_DrawTextLayout2D(const NX_TextLayout* layout, NX_Vec2 position);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -55,6 +55,12 @@ NXAPI double NX_GetDeltaTime(void);
  */
 NXAPI int NX_GetFPS(void);
 
+/**
+ * @brief Gets the number of job worker threads.
+ * @return Number of worker threads created by NX_InitEx, the main thread not included.
+ */
+NXAPI int NX_GetWorkerCount(void);
+
 /**
  * @brief Sets the target frame rate (FPS).
  * @param fps Desired target FPS.
@@ -0,0 +1,119 @@
+/* NX_SpriteAtlas.h -- API declaration for Nexium's sprite atlas module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_SPRITE_ATLAS_H
+#define NX_SPRITE_ATLAS_H
+
+#include "./NX_Texture.h"
+#include "./NX_Image.h"
+#include "./NX_Math.h"
+#include "./NX_API.h"
+
+// ============================================================================
+// TYPES DEFINITIONS
+// ============================================================================
+
+/**
+ * @brief Opaque handle to a runtime sprite atlas.
+ *
+ * Packs many small images into a few large RGBA8 textures, called pages,
+ * so that the 2D renderer can draw different sprites without switching textures.
+ */
+typedef struct NX_SpriteAtlas NX_SpriteAtlas;
+
+/**
+ * @brief Location of a sprite inside its atlas.
+ */
+typedef struct NX_SpriteRegion {
+    NX_Texture* texture;        ///< Page texture containing the sprite, owned by the atlas.
+    NX_Vec2 uvMin;              ///< Texture coordinates of the top-left corner.
+    NX_Vec2 uvMax;              ///< Texture coordinates of the bottom-right corner.
+    int w, h;                   ///< Size of the sprite in pixels.
+} NX_SpriteRegion;
+
+/**
+ * @brief Packing statistics of a sprite atlas.
+ */
+typedef struct NX_SpriteAtlasStats {
+    int pageCount;              ///< Number of page textures.
+    int spriteCount;            ///< Number of sprites currently in the atlas.
+    float occupancy;            ///< Sprite pixels over page pixels, padding excluded, in [0, 1].
+} NX_SpriteAtlasStats;
+
+// ============================================================================
+// FUNCTIONS DECLARATIONS
+// ============================================================================
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * @brief Creates an empty sprite atlas.
+ * @param pageSize Width and height of each page texture, in pixels.
+ * @param padding Number of pixels kept around each sprite to avoid bleeding when filtering.
+ * @param filter Filter of the page textures. Trilinear filtering is treated as bilinear.
+ * @return Pointer to the new atlas, or NULL on failure.
+ * @note Pages are only created when sprites are added.
+ */
+NXAPI NX_SpriteAtlas* NX_CreateSpriteAtlas(int pageSize, int padding, NX_TextureFilter filter);
+
+/**
+ * @brief Destroys a sprite atlas and its page textures.
+ * @param atlas Atlas to destroy, can be NULL.
+ */
+NXAPI void NX_DestroySpriteAtlas(NX_SpriteAtlas* atlas);
+
+/**
+ * @brief Adds an image to the atlas.
+ * @param atlas Target atlas.
+ * @param image Source image, converted to RGBA8 if needed. Must not be block compressed.
+ * @return Sprite handle, or -1 if the image cannot fit in a page.
+ * @note The padding is filled by extending the edges of the image.
+ * @note A new page is created when the sprite fits in none of the existing ones.
+ */
+NXAPI int NX_AddSpriteFromImage(NX_SpriteAtlas* atlas, const NX_Image* image);
+
+/**
+ * @brief Adds the content of a texture to the atlas, copied on the GPU.
+ * @param atlas Target atlas.
+ * @param texture Source texture, its format must use 4 bytes per pixel.
+ * @return Sprite handle, or -1 on failure.
+ * @note The padding is left transparent since the copy never reaches the CPU.
+ */
+NXAPI int NX_AddSpriteFromTexture(NX_SpriteAtlas* atlas, const NX_Texture* texture);
+
+/**
+ * @brief Removes a sprite, its area can then be reused by the following insertions.
+ * @param atlas Atlas containing the sprite.
+ * @param sprite Handle returned when the sprite was added.
+ * @note Handles of removed sprites are recycled by the following insertions.
+ */
+NXAPI void NX_RemoveSprite(NX_SpriteAtlas* atlas, int sprite);
+
+/**
+ * @brief Retrieves the page and texture coordinates of a sprite.
+ * @param atlas Atlas containing the sprite.
+ * @param sprite Sprite handle.
+ * @param region Output region.
+ * @return true if the handle refers to a sprite of the atlas, false otherwise.
+ */
+NXAPI bool NX_GetSpriteRegion(const NX_SpriteAtlas* atlas, int sprite, NX_SpriteRegion* region);
+
+/**
+ * @brief Gets the packing statistics of an atlas.
+ * @param atlas Atlas to query.
+ * @return Current statistics.
+ */
+NXAPI NX_SpriteAtlasStats NX_GetSpriteAtlasStats(const NX_SpriteAtlas* atlas);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // NX_SPRITE_ATLAS_H
@@ -0,0 +1,82 @@
+/* NX_TextLayout.h -- API declaration for Nexium's text layout module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_TEXT_LAYOUT_H
+#define NX_TEXT_LAYOUT_H
+
+#include "./NX_Font.h"
+#include "./NX_Math.h"
+#include "./NX_API.h"
+
+// ============================================================================
+// TYPES DEFINITIONS
+// ============================================================================
+
+/**
+ * @brief Opaque handle to a pre-shaped text.
+ *
+ * Stores the glyph quads of a string laid out once with a given font, size,
+ * spacing and wrapping width, so that static text can be drawn each frame
+ * without decoding, glyph lookups or line breaking.
+ */
+typedef struct NX_TextLayout NX_TextLayout;
+
+// ============================================================================
+// FUNCTIONS DECLARATIONS
+// ============================================================================
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/**
+ * @brief Lays out a UTF-8 string.
+ * @param font Font used to shape the text (can be NULL to use the default font).
+ * @param text Null-terminated UTF-8 string.
+ * @param fontSize Font size in pixels.
+ * @param spacing Additional spacing between characters and between lines.
+ * @param wrapWidth Maximum width of a line in pixels, zero or negative to disable wrapping.
+ * @return Pointer to the new layout, or NULL on failure.
+ * @note Lines are wrapped at spaces and tabs, words longer than a line are split.
+ * @note The font must outlive the layout.
+ */
+NXAPI NX_TextLayout* NX_CreateTextLayout(const NX_Font* font, const char* text, float fontSize, NX_Vec2 spacing, float wrapWidth);
+
+/**
+ * @brief Destroys a text layout.
+ * @param layout Layout to destroy, can be NULL.
+ */
+NXAPI void NX_DestroyTextLayout(NX_TextLayout* layout);
+
+/**
+ * @brief Lays out a new string in an existing layout, reusing its storage.
+ * @param layout Layout to update.
+ * @param text Null-terminated UTF-8 string.
+ * @note The font, size, spacing and wrapping width are kept.
+ */
+NXAPI void NX_SetTextLayoutText(NX_TextLayout* layout, const char* text);
+
+/**
+ * @brief Gets the size of the laid out text.
+ * @param layout Layout to query.
+ * @return Width of the longest line and total height, in pixels.
+ */
+NXAPI NX_Vec2 NX_GetTextLayoutSize(const NX_TextLayout* layout);
+
+/**
+ * @brief Gets the number of lines of the laid out text, wrapped lines included.
+ * @param layout Layout to query.
+ * @return Number of lines.
+ */
+NXAPI int NX_GetTextLayoutLineCount(const NX_TextLayout* layout);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // NX_TEXT_LAYOUT_H
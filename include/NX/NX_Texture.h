@@ -9,6 +9,7 @@
 #ifndef NX_TEXTURE_H
 #define NX_TEXTURE_H
 
+#include "./NX_AsyncLoad.h"
 #include "./NX_Image.h"
 #include "./NX_API.h"
 
@@ -46,6 +47,31 @@ typedef enum NX_TextureWrap {
  */
 typedef struct NX_Texture NX_Texture;
 
+/**
+ * @brief Statistics of the shared texture cache.
+ *
+ * Textures loaded through model imports are shared between materials and models
+ * when they come from the same source with the same parameters.
+ */
+typedef struct NX_TextureCacheStats {
+    uint64_t hits;      ///< Number of requests served by an already loaded texture (no decoding, no upload).
+    uint64_t misses;    ///< Number of shared textures that had to be decoded and uploaded.
+    int entries;        ///< Number of shared textures currently alive.
+} NX_TextureCacheStats;
+
+/**
+ * @brief Statistics of the texture streaming system, updated once per frame.
+ */
+typedef struct NX_TextureStreamingStats {
+    int textureCount;           ///< Number of streamed textures alive.
+    int pendingLoads;           ///< Number of stream ins currently in flight.
+    size_t residentBytes;       ///< GPU memory used by the resident levels of streamed textures.
+    size_t wantedBytes;         ///< GPU memory the levels requested by the last frame would use.
+    size_t budgetBytes;         ///< Current residency budget, 0 when unlimited.
+    uint64_t streamedLevels;    ///< Number of levels made resident since the last reset.
+    uint64_t evictedLevels;     ///< Number of levels evicted since the last reset.
+} NX_TextureStreamingStats;
+
 // ============================================================================
 // FUNCTIONS DECLARATIONS
 // ============================================================================
@@ -121,10 +147,27 @@ NXAPI NX_Texture* NX_CreateTextureFromImage(const NX_Image* image);
  */
 NXAPI NX_Texture* NX_CreateTextureFromImageEx(const NX_Image* image, NX_TextureWrap wrap, NX_TextureFilter filter);
 
+/**
+ * @brief Creates a GPU texture from a mip chain, such as the one returned by NX_GenImageMipmaps
+ *
+ * All levels are uploaded as is, no mipmap is generated by the driver unless a single level is given.
+ * Each level must have the format of the first one and half of the size of the previous one,
+ * the chain is truncated at the first level that does not match.
+ *
+ * @param levels Array of levels, largest first
+ * @param levelCount Number of levels in the array
+ * @param wrap Texture wrap mode (defines how texture coordinates outside [0,1] are handled)
+ * @param filter Texture filtering mode, levels after the first one are only sampled with trilinear filtering
+ * @return Pointer to a newly created NX_Texture, or NULL on failure
+ */
+NXAPI NX_Texture* NX_CreateTextureFromMipmaps(const NX_Image* levels, int levelCount, NX_TextureWrap wrap, NX_TextureFilter filter);
+
 /**
  * @brief Load a texture from a file and decode it for rendering.
  *
  * Automatically converts pixel formats if needed (e.g., L/LA -> RGB/RGBA)
+ * DDS and KTX2 containers are uploaded as stored, block compressed formats
+ * and mip levels included.
  *
  * @param filePath Path to the texture file
  * @return Pointer to a newly loaded NX_Texture ready for rendering, or NULL on failure
@@ -143,11 +186,96 @@ NXAPI NX_Texture* NX_LoadTexture(const char* filePath);
 NXAPI NX_Texture* NX_LoadTextureAsData(const char* filePath);
 
 /**
- * @brief Destroys a GPU texture and frees its resources.
+ * @brief Starts loading a texture in the background.
+ *
+ * The image is read and decoded on the job system workers, then the texture
+ * is created on the main thread during NX_FrameStep within the upload budget.
+ * With trilinear filtering, the mip chain is also generated by the workers
+ * (Kaiser filter, values filtered as stored) instead of by the driver.
+ * DDS and KTX2 containers are supported the same way as by NX_LoadTexture.
+ *
+ * @param filePath Path to the image file.
+ * @return Handle to poll or wait on, NULL on failure. Must be destroyed with NX_DestroyAsyncLoad.
+ */
+NXAPI NX_AsyncLoad* NX_LoadTextureAsync(const char* filePath);
+
+/**
+ * @brief Retrieves the texture of a finished asynchronous load.
+ * @param load Handle returned by NX_LoadTextureAsync.
+ * @return The loaded texture, or NULL if the load is not ready, has failed, or the texture was already retrieved.
+ * @note Once retrieved, the texture is owned by the caller and is no longer destroyed with the handle.
+ */
+NXAPI NX_Texture* NX_GetAsyncTexture(NX_AsyncLoad* load);
+
+/**
+ * @brief Loads a texture whose largest mip levels are streamed in on demand.
+ *
+ * Only the levels of at most 128 pixels are kept resident. Finer levels are
+ * loaded in the background once a 3D draw needs them, based on the screen size
+ * of its bounding volume, and evicted in least recently used order when the
+ * streaming budget is exceeded. Images too small or with a partial mip chain
+ * are loaded as regular textures.
+ *
+ * @param filePath Path to the image file, which must stay readable while the texture is alive.
+ * @return Pointer to the loaded NX_Texture, or NULL on failure.
+ * @note NX_GetTextureSize reports the full resolution. Streamed textures cannot be updated with NX_UploadTexture.
+ */
+NXAPI NX_Texture* NX_LoadTextureStreamed(const char* filePath);
+
+/**
+ * @brief Sets the GPU memory budget of the streamed texture levels.
+ * @param bytes Budget in bytes, 0 for unlimited (default).
+ * @note The levels that always stay resident are counted but never evicted.
+ */
+NXAPI void NX_SetTextureStreamingBudget(size_t bytes);
+
+/**
+ * @brief Gets the GPU memory budget of the streamed texture levels.
+ * @return Budget in bytes, 0 when unlimited.
+ */
+NXAPI size_t NX_GetTextureStreamingBudget(void);
+
+/**
+ * @brief Retrieves the statistics of the texture streaming system.
+ * @return Statistics as of the last NX_FrameStep.
+ */
+NXAPI NX_TextureStreamingStats NX_GetTextureStreamingStats(void);
+
+/**
+ * @brief Resets the streamed and evicted level counters.
+ */
+NXAPI void NX_ResetTextureStreamingStats(void);
+
+/**
+ * @brief Releases a reference to a GPU texture, freeing it with the last one.
  * @param texture Pointer to the NX_Texture to destroy.
+ * @note Textures are created with a single reference, see NX_RetainTexture.
  */
 NXAPI void NX_DestroyTexture(NX_Texture* texture);
 
+/**
+ * @brief Adds a reference to a texture.
+ *
+ * Each reference must be released by a call to NX_DestroyTexture.
+ * Model imports share their textures this way, so modifying the parameters
+ * of a material texture may affect other materials and models using it.
+ *
+ * @param texture Pointer to the NX_Texture to retain (can be NULL).
+ * @return The same texture pointer.
+ */
+NXAPI NX_Texture* NX_RetainTexture(NX_Texture* texture);
+
+/**
+ * @brief Retrieves the statistics of the shared texture cache.
+ * @return Hits and misses since the last reset, and the current entry count.
+ */
+NXAPI NX_TextureCacheStats NX_GetTextureCacheStats(void);
+
+/**
+ * @brief Resets the hit and miss counters of the shared texture cache.
+ */
+NXAPI void NX_ResetTextureCacheStats(void);
+
 /**
  * @brief Retrieves the size of the specified texture.
  * @param texture Pointer to the NX_Texture to query.
@@ -201,9 +329,19 @@ NXAPI void NX_UploadTexture(NX_Texture* texture, const NX_Image* image);
 /**
  * @brief Generates mipmaps for a texture.
  * @param texture Pointer to the NX_Texture.
+ * @note Not supported for block compressed textures, their levels must be provided.
  */
 NXAPI void NX_GenerateMipmap(NX_Texture* texture);
 
+/**
+ * @brief Checks whether textures of the given format can be created on the current device.
+ * @param format Pixel format to check.
+ * @return true if supported, false otherwise.
+ * @note Uncompressed formats are always supported, possibly with a fallback format.
+ *       Block compressed formats depend on the S3TC, RGTC and BPTC support of the driver.
+ */
+NXAPI bool NX_IsTextureFormatSupported(NX_PixelFormat format);
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -38,6 +38,7 @@
 #include "./NX_Macros.h"
 #include "./NX_Window.h"
 #include "./NX_Camera.h"
+#include "./NX_Path2D.h"
 #include "./NX_Texture.h"
 #include "./NX_Runtime.h"
 #include "./NX_Display.h"
@@ -57,10 +58,13 @@
 #include "./NX_Codepoint.h"
 #include "./NX_Clipboard.h"
 #include "./NX_AudioClip.h"
+#include "./NX_AsyncLoad.h"
 #include "./NX_Animation.h"
 #include "./NX_Filesystem.h"
+#include "./NX_TextLayout.h"
 #include "./NX_AudioStream.h"
 #include "./NX_Environment.h"
+#include "./NX_SpriteAtlas.h"
 #include "./NX_RenderTexture.h"
 #include "./NX_InstanceBuffer.h"
 #include "./NX_IndirectLight.h"
@@ -14,10 +14,28 @@ precision mediump float;
 
 /* === Attributes === */
 
+#ifndef INSTANCED_QUAD
+
 layout(location = 0) in vec2 aPosition;
 layout(location = 1) in vec2 aTexCoord;
 layout(location = 2) in vec4 aColor;
 
+#else
+
+// NOTE: One instance per quad, the corners are generated from gl_VertexID
+//       and drawn as a triangle strip. The axes already include the transform.
+
+layout(location = 0) in vec2 iOrigin;
+layout(location = 1) in vec4 iAxes;         //< xy: width axis, zw: height axis
+layout(location = 2) in vec4 iTexRect;      //< xy: min, zw: max
+layout(location = 3) in vec4 iColor;
+
+vec2 aPosition;
+vec2 aTexCoord;
+vec4 aColor;
+
+#endif
+
 /* === Uniform Buffers === */
 
 layout(std140, binding = 0) uniform UniformBlock {
@@ -42,6 +60,13 @@ layout(location = 4) out flat ivec4 vUsrData4i;
 
 void main()
 {
+#ifdef INSTANCED_QUAD
+    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+    aPosition = iOrigin + corner.x * iAxes.xy + corner.y * iAxes.zw;
+    aTexCoord = mix(iTexRect.xy, iTexRect.zw, corner);
+    aColor = iColor;
+#endif
+
     VertexOverride();
 
     vPosition = POSITION;
@@ -9,10 +9,90 @@
 #include "./Buffer.hpp"
 #include "./Pipeline.hpp"
 
+#include <SDL3/SDL_video.h>
+
 namespace gpu {
 
+/* === Local Functions === */
+
+using BufferStorageProc = void (GLAD_API_PTR*)(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+
+static BufferStorageProc GetBufferStorageProc() noexcept
+{
+    static BufferStorageProc proc = []() -> BufferStorageProc
+    {
+        // NOTE: Core in the desktop GL 4.5 context, extension only on GLES
+        const char* name = nullptr;
+        if (INX_Display.glProfile != SDL_GL_CONTEXT_PROFILE_ES) {
+            name = "glBufferStorage";
+        }
+        else if (SDL_GL_ExtensionSupported("GL_EXT_buffer_storage")) {
+            name = "glBufferStorageEXT";
+        }
+
+        if (name == nullptr) {
+            NX_LOG(D, "GPU: Buffer storage not supported, persistent mapping disabled");
+            return nullptr;
+        }
+
+        return reinterpret_cast<BufferStorageProc>(SDL_GL_GetProcAddress(name));
+    }();
+
+    return proc;
+}
+
 /* === Public Implementation === */
 
+Buffer Buffer::CreateStorage(GLenum target, GLsizeiptr size, GLbitfield flags, const void* data) noexcept
+{
+    SDL_assert(size > 0);
+
+    Buffer buffer;
+
+    BufferStorageProc bufferStorage = GetBufferStorageProc();
+    if (bufferStorage == nullptr) {
+        return buffer;
+    }
+
+    if (!IsValidTarget(target)) {
+        NX_LOG(E, "GPU: Invalid buffer target: 0x%x", target);
+        return buffer;
+    }
+
+    if (size <= 0) {
+        NX_LOG(E, "GPU: Invalid buffer size: %lld", static_cast<long long>(size));
+        return buffer;
+    }
+
+    glGenBuffers(1, &buffer.mID);
+    if (buffer.mID == 0) {
+        NX_LOG(E, "GPU: Failed to create buffer object");
+        return buffer;
+    }
+
+    buffer.mTarget = target;
+    buffer.mSize = size;
+    buffer.mUsage = GL_STREAM_DRAW;
+    buffer.mImmutable = true;
+
+    Pipeline::WithBufferBind(target, buffer.mID, [&]() {
+        bufferStorage(target, size, data, flags);
+        if (glGetError() != GL_NO_ERROR) {
+            NX_LOG(E, "GPU: Failed to allocate buffer storage (size=%lld, flags=0x%x)",
+                            static_cast<long long>(size), flags);
+            glDeleteBuffers(1, &buffer.mID);
+            buffer.mID = 0;
+        }
+    });
+
+    return buffer;
+}
+
+bool Buffer::IsStorageSupported() noexcept
+{
+    return (GetBufferStorageProc() != nullptr);
+}
+
 void Buffer::Realloc(GLsizeiptr newSize, const void* data) noexcept
 {
     SDL_assert(newSize > 0);
@@ -22,6 +102,11 @@ void Buffer::Realloc(GLsizeiptr newSize, const void* data) noexcept
         return;
     }
 
+    if (mImmutable) {
+        NX_LOG(E, "GPU: Cannot realloc a buffer with immutable storage (id=%u)", mID);
+        return;
+    }
+
     if (newSize <= 0) {
         NX_LOG(E, "GPU: Invalid buffer size: %lld", static_cast<long long>(newSize));
         return;
@@ -57,6 +142,11 @@ void Buffer::Realloc(GLsizeiptr newSize, bool keepData) noexcept
         return;
     }
 
+    if (mImmutable) {
+        NX_LOG(E, "GPU: Cannot realloc a buffer with immutable storage (id=%u)", mID);
+        return;
+    }
+
     if (newSize <= 0) {
         NX_LOG(E, "GPU: Invalid buffer size: %lld", static_cast<long long>(newSize));
         return;
@@ -168,6 +258,38 @@ bool Buffer::Upload(GLintptr offset, GLsizeiptr size, const void* data) noexcept
     return true;
 }
 
+bool Buffer::Copy(const Buffer& src, GLintptr srcOffset, GLintptr dstOffset, GLsizeiptr size) noexcept
+{
+    if (!IsValid() || !src.IsValid()) {
+        NX_LOG(E, "GPU: Cannot copy between invalid buffers");
+        return false;
+    }
+
+    if (srcOffset < 0 || dstOffset < 0 || size <= 0 || srcOffset + size > src.mSize || dstOffset + size > mSize) {
+        NX_LOG(E, "GPU: Invalid buffer copy of %lld bytes from offset %lld (size %lld) to offset %lld (size %lld)",
+                static_cast<long long>(size),
+                static_cast<long long>(srcOffset), static_cast<long long>(src.mSize),
+                static_cast<long long>(dstOffset), static_cast<long long>(mSize));
+        return false;
+    }
+
+    // NOTE: The copy targets do not affect any vertex array state,
+    //       unlike the element array target of index buffers
+    glBindBuffer(GL_COPY_READ_BUFFER, src.mID);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, mID);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, dstOffset, size);
+
+    bool success = (glGetError() == GL_NO_ERROR);
+    if (!success) {
+        NX_LOG(E, "GPU: Failed to copy buffer data (src=%u, dst=%u)", src.mID, mID);
+    }
+
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    return success;
+}
+
 void* Buffer::Map(GLenum access) noexcept
 {
     if (!IsValid()) {
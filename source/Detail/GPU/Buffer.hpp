@@ -16,6 +16,23 @@
 
 #include <utility>
 
+/* === Buffer Storage Constants === */
+
+// NOTE: Core since GL 4.4 and exposed by GL_EXT_buffer_storage on GLES,
+//       these are not part of the generated GLES 3.2 loader
+#ifndef GL_MAP_PERSISTENT_BIT
+#   define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+#ifndef GL_MAP_COHERENT_BIT
+#   define GL_MAP_COHERENT_BIT 0x0080
+#endif
+#ifndef GL_DYNAMIC_STORAGE_BIT
+#   define GL_DYNAMIC_STORAGE_BIT 0x0100
+#endif
+#ifndef GL_CLIENT_STORAGE_BIT
+#   define GL_CLIENT_STORAGE_BIT 0x0200
+#endif
+
 namespace gpu {
 
 /* === Declaration === */
@@ -26,6 +43,10 @@ public:
     Buffer() = default;
     Buffer(GLenum target, GLsizeiptr size, const void* data = nullptr, GLenum usage = GL_STATIC_DRAW) noexcept;
 
+    /** Immutable storage (glBufferStorage), returns an invalid buffer if not supported */
+    static Buffer CreateStorage(GLenum target, GLsizeiptr size, GLbitfield flags, const void* data = nullptr) noexcept;
+    static bool IsStorageSupported() noexcept;
+
     /** Destructor and Move semantics */
     ~Buffer() noexcept;
     Buffer(const Buffer&) = delete;
@@ -39,6 +60,7 @@ public:
     GLenum GetTarget() const noexcept;
     GLsizeiptr GetSize() const noexcept;
     GLenum GetUsage() const noexcept;
+    bool IsImmutable() const noexcept;
 
     /** Data management */
     void Reserve(GLsizeiptr minSize, bool keepData) noexcept;                   // Reallocates buffer if its size is < minSize, optionally preserving existing data
@@ -48,6 +70,8 @@ public:
     bool Upload(const void* data) noexcept;                                     // Overwrite entire buffer content, keep current size
     bool Upload(GLintptr offset, GLsizeiptr size, const void* data) noexcept;   // Overwrite part of the buffer at given offset
 
+    bool Copy(const Buffer& src, GLintptr srcOffset, GLintptr dstOffset, GLsizeiptr size) noexcept;     // Copy a range of another buffer, performed on the GPU timeline
+
     template<typename T>
     bool UploadObject(const T& data) noexcept;                                  // Overwrite entire buffer from offset 0 with provided data (size = sizeof(T))
 
@@ -68,6 +92,7 @@ private:
     GLenum mTarget{GL_ARRAY_BUFFER};
     GLsizeiptr mSize{0};
     GLenum mUsage{GL_STATIC_DRAW};
+    bool mImmutable{false};
 
     /** Utility functions */
     void createBuffer(const void* data, GLenum usage) noexcept;
@@ -117,6 +142,7 @@ inline Buffer::Buffer(Buffer&& other) noexcept
     , mTarget(other.mTarget)
     , mSize(other.mSize)
     , mUsage(other.mUsage)
+    , mImmutable(other.mImmutable)
 { }
 
 inline Buffer& Buffer::operator=(Buffer&& other) noexcept
@@ -127,6 +153,7 @@ inline Buffer& Buffer::operator=(Buffer&& other) noexcept
         mTarget = other.mTarget;
         mSize = other.mSize;
         mUsage = other.mUsage;
+        mImmutable = other.mImmutable;
     }
     return *this;
 }
@@ -156,6 +183,11 @@ inline GLenum Buffer::GetUsage() const noexcept
     return mUsage;
 }
 
+inline bool Buffer::IsImmutable() const noexcept
+{
+    return mImmutable;
+}
+
 inline void Buffer::Reserve(GLsizeiptr size, bool keepData) noexcept
 {
     if (size > mSize) {
@@ -236,7 +268,8 @@ inline bool Buffer::IsValidMapAccess(GLbitfield access) noexcept
     constexpr GLbitfield validBits =
         GL_MAP_READ_BIT | GL_MAP_WRITE_BIT |
         GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT |
-        GL_MAP_FLUSH_EXPLICIT_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+        GL_MAP_FLUSH_EXPLICIT_BIT | GL_MAP_UNSYNCHRONIZED_BIT |
+        GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
 
     return (access & ~validBits) == 0;
 }
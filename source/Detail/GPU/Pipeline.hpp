@@ -13,7 +13,9 @@
 
 #include "./VertexArray.hpp"
 #include "./Framebuffer.hpp"
+#include "./UnpackBufferPool.hpp"
 #include "./Texture.hpp"
+#include "./RingBuffer.hpp"
 #include "./Program.hpp"
 #include "./Buffer.hpp"
 
@@ -79,6 +81,7 @@ private:
     friend Texture;
     friend Program;
     friend Buffer;
+    friend UnpackBufferPool;
 
 public:
     Pipeline() noexcept;
@@ -107,6 +110,8 @@ public:
     void BindStorage(int slot, const Buffer& storage, size_t offset, size_t size) const noexcept;
     void BindUniform(int slot, const Buffer& uniform) const noexcept;
     void BindUniform(int slot, const Buffer& uniform, size_t offset, size_t size) const noexcept;
+    void BindStorage(int slot, const RingBuffer& storage, const RingBuffer::Range& range) const noexcept;
+    void BindUniform(int slot, const RingBuffer& uniform, const RingBuffer::Range& range) const noexcept;
 
     void UnbindFramebuffer() const noexcept;
     void UnbindVertexArray() const noexcept;
@@ -150,6 +155,7 @@ public:
 
     void DrawElements(GLenum mode, GLenum type, GLsizei count) const noexcept;
     void DrawElements(GLenum mode, GLenum type, GLint first, GLsizei count) const noexcept;
+    void DrawElementsBaseVertex(GLenum mode, GLenum type, GLint first, GLsizei count, GLint baseVertex) const noexcept;
 
     void DrawElementsInstanced(GLenum mode, GLenum type, GLsizei count, GLsizei instanceCount) const noexcept;
     void DrawElementsInstanced(GLenum mode, GLenum type, GLint first, GLsizei count, GLsizei instanceCount) const noexcept;
@@ -226,15 +232,18 @@ private:
         }
     };
 
+    // NOTE: The buffer ID is tracked as well, ring buffers replace
+    //       their storage in place when they grow
     struct BufferRange {
+        GLuint id;
         size_t offset, size;
-        BufferRange() : offset(0), size(0) {}
-        BufferRange(size_t o, size_t s) : offset(o), size(s) {}
+        BufferRange() : id(0), offset(0), size(0) {}
+        BufferRange(GLuint i, size_t o, size_t s) : id(i), offset(o), size(s) {}
         bool operator==(const BufferRange& other) const noexcept {
-            return (offset == other.offset && size == other.size);
+            return (id == other.id && offset == other.offset && size == other.size);
         }
         bool operator!=(const BufferRange& other) const noexcept {
-            return (offset != other.offset || size != other.size);
+            return (id != other.id || offset != other.offset || size != other.size);
         }
     };
 
@@ -464,7 +473,7 @@ inline void Pipeline::BindStorage(int slot, const Buffer& storage) const noexcep
     SDL_assert(storage.GetTarget() == GL_SHADER_STORAGE_BUFFER);
     SDL_assert(slot < sBindStorage.size());
 
-    BufferRange range(0, storage.GetSize());
+    BufferRange range(storage.GetID(), 0, storage.GetSize());
     if (&storage == sBindStorage[slot] && range == sStorageRange[slot]) {
         return;
     }
@@ -481,7 +490,7 @@ inline void Pipeline::BindStorage(int slot, const Buffer& storage, size_t offset
     SDL_assert(size > 0 && size <= storage.GetSize());
     SDL_assert(slot < sBindStorage.size());
 
-    BufferRange range(offset, size);
+    BufferRange range(storage.GetID(), offset, size);
     if (&storage == sBindStorage[slot] && range == sStorageRange[slot]) {
         return;
     }
@@ -496,7 +505,7 @@ inline void Pipeline::BindUniform(int slot, const Buffer& uniform) const noexcep
     SDL_assert(uniform.GetTarget() == GL_UNIFORM_BUFFER);
     SDL_assert(slot < sBindUniform.size());
 
-    BufferRange range(0, uniform.GetSize());
+    BufferRange range(uniform.GetID(), 0, uniform.GetSize());
     if (&uniform == sBindUniform[slot] && range == sUniformRange[slot]) {
         return;
     }
@@ -513,7 +522,7 @@ inline void Pipeline::BindUniform(int slot, const Buffer& uniform, size_t offset
     SDL_assert(size > 0 && size <= uniform.GetSize());
     SDL_assert(slot < sBindUniform.size());
 
-    BufferRange range(offset, size);
+    BufferRange range(uniform.GetID(), offset, size);
     if (&uniform == sBindUniform[slot] && range == sUniformRange[slot]) {
         return;
     }
@@ -523,6 +532,20 @@ inline void Pipeline::BindUniform(int slot, const Buffer& uniform, size_t offset
     sUniformRange[slot] = range;
 }
 
+inline void Pipeline::BindStorage(int slot, const RingBuffer& storage, const RingBuffer::Range& range) const noexcept
+{
+    // NOTE: Empty ranges bind the whole buffer, so that the
+    //       binding point stays valid for unused shader blocks
+    if (range.size > 0) BindStorage(slot, storage.GetBuffer(), range.offset, range.size);
+    else BindStorage(slot, storage.GetBuffer());
+}
+
+inline void Pipeline::BindUniform(int slot, const RingBuffer& uniform, const RingBuffer::Range& range) const noexcept
+{
+    if (range.size > 0) BindUniform(slot, uniform.GetBuffer(), range.offset, range.size);
+    else BindUniform(slot, uniform.GetBuffer());
+}
+
 inline void Pipeline::UnbindFramebuffer() const noexcept
 {
     if (sBindFramebuffer != nullptr) {
@@ -754,6 +777,18 @@ inline void Pipeline::DrawElements(GLenum mode, GLenum type, GLint first, GLsize
     glDrawElements(mode, count, type, reinterpret_cast<const void*>(first * typeSize));
 }
 
+inline void Pipeline::DrawElementsBaseVertex(GLenum mode, GLenum type, GLint first, GLsizei count, GLint baseVertex) const noexcept
+{
+    size_t typeSize = 0;
+    switch (type) {
+        case GL_UNSIGNED_BYTE:  typeSize = 1; break;
+        case GL_UNSIGNED_SHORT: typeSize = 2; break;
+        case GL_UNSIGNED_INT:   typeSize = 4; break;
+        default: break;
+    }
+    glDrawElementsBaseVertex(mode, count, type, reinterpret_cast<const void*>(first * typeSize), baseVertex);
+}
+
 inline void Pipeline::DrawElementsInstanced(GLenum mode, GLenum type, GLsizei count, GLsizei instanceCount) const noexcept
 {
     glDrawElementsInstanced(mode, count, type, nullptr, instanceCount);
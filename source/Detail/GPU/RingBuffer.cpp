@@ -0,0 +1,240 @@
+/* RingBuffer.cpp -- Persistently mapped ring buffer for per-frame GPU uploads
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./RingBuffer.hpp"
+#include "./Pipeline.hpp"
+
+#include <NX/NX_Math.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace gpu {
+
+/* === Local Functions === */
+
+static void WaitFence(GLsync fence) noexcept
+{
+    // Timeout of the flushed waits, the loop only exits once the fence is signaled
+    constexpr GLuint64 timeoutNs = 1000000;
+
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    while (result == GL_TIMEOUT_EXPIRED) {
+        result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeoutNs);
+    }
+
+    if (result == GL_WAIT_FAILED) {
+        NX_LOG(E, "GPU: Failed to wait for ring buffer fence");
+    }
+}
+
+/* === Public Implementation === */
+
+RingBuffer::RingBuffer(GLenum target, GLsizeiptr segmentSize, GLsizeiptr alignment, bool growable) noexcept
+    : mTarget(target), mGrowable(growable)
+{
+    SDL_assert(segmentSize > 0);
+
+    if (alignment <= 0) {
+        switch (target) {
+        case GL_UNIFORM_BUFFER:
+            alignment = Pipeline::GetUniformBufferOffsetAlignment();
+            break;
+        case GL_SHADER_STORAGE_BUFFER:
+            alignment = Pipeline::GetStorageBufferOffsetAlignment();
+            break;
+        default:
+            alignment = 16;
+            break;
+        }
+    }
+
+    SDL_assert((alignment & (alignment - 1)) == 0);
+    mAlignment = alignment;
+
+    CreateStorage(segmentSize);
+}
+
+void* RingBuffer::Map(GLsizeiptr size, Range* range) noexcept
+{
+    SDL_assert(range != nullptr);
+    SDL_assert(!mMapped && "RingBuffer::Unmap() must be called after each RingBuffer::Map()");
+
+    *range = Range{};
+
+    if (!IsValid()) {
+        NX_LOG(E, "GPU: Cannot map an invalid ring buffer");
+        return nullptr;
+    }
+
+    if (size <= 0) {
+        NX_LOG(E, "GPU: Invalid ring buffer allocation size: %lld", static_cast<long long>(size));
+        return nullptr;
+    }
+
+    /* --- Move to the next segment on a new frame, growing if the last frame overflowed --- */
+
+    if (mFrame != sFrame) {
+        if (mGrowable && mFrameUsage > mSegmentSize) {
+            Grow(mFrameUsage);
+        }
+        else if (mHead > 0) {
+            AdvanceSegment();
+        }
+        mFrame = sFrame;
+        mFrameUsage = 0;
+    }
+
+    /* --- Find room in the current segment --- */
+
+    GLintptr offset = NX_ALIGN_UP(mHead, mAlignment);
+
+    if (size > mSegmentSize) {
+        if (!mGrowable) {
+            NX_LOG(E, "GPU: Ring buffer allocation exceeds its segment size (%lld > %lld)",
+                static_cast<long long>(size), static_cast<long long>(mSegmentSize));
+            return nullptr;
+        }
+        Grow(size);
+        if (!IsValid()) return nullptr;
+        offset = 0;
+    }
+    else if (offset + size > mSegmentSize) {
+        // NOTE: Only stalls if the frame already used every segment
+        AdvanceSegment();
+        offset = 0;
+    }
+
+    mHead = offset + size;
+    mFrameUsage += size;
+
+    const GLintptr absolute = mSegment * mSegmentSize + offset;
+    *range = Range{absolute, size};
+
+    /* --- Return the write pointer --- */
+
+    if (mPersistentPtr != nullptr) {
+        return mPersistentPtr + absolute;
+    }
+
+    void* ptr = mBuffer.MapRange(absolute, size,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT
+    );
+
+    if (ptr == nullptr) {
+        *range = Range{};
+        return nullptr;
+    }
+
+    mMapped = true;
+
+    return ptr;
+}
+
+void RingBuffer::Unmap() noexcept
+{
+    if (mMapped) {
+        mBuffer.Unmap();
+        mMapped = false;
+    }
+}
+
+RingBuffer::Range RingBuffer::Upload(const void* data, GLsizeiptr size) noexcept
+{
+    Range range{};
+
+    void* ptr = Map(size, &range);
+    if (ptr == nullptr) {
+        return Range{};
+    }
+
+    std::memcpy(ptr, data, size);
+    Unmap();
+
+    return range;
+}
+
+/* === Private Implementation === */
+
+void RingBuffer::CreateStorage(GLsizeiptr segmentSize) noexcept
+{
+    mSegmentSize = NX_ALIGN_UP(segmentSize, mAlignment);
+    mSegment = 0;
+    mHead = 0;
+
+    const GLsizeiptr totalSize = SegmentCount * mSegmentSize;
+
+    /* --- Persistent coherent mapping when buffer storage is available --- */
+
+    constexpr GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    mBuffer = Buffer::CreateStorage(mTarget, totalSize, mapFlags);
+    if (mBuffer.IsValid()) {
+        mPersistentPtr = mBuffer.Map<uint8_t>(mapFlags);
+        if (mPersistentPtr != nullptr) {
+            return;
+        }
+        NX_LOG(W, "GPU: Failed to map ring buffer persistently, using unsynchronized mapping instead");
+    }
+
+    /* --- Fallback to a mutable buffer mapped per allocation --- */
+
+    mBuffer = Buffer(mTarget, totalSize, nullptr, GL_STREAM_DRAW);
+    if (!mBuffer.IsValid()) {
+        NX_LOG(E, "GPU: Failed to create ring buffer (size=%lld)", static_cast<long long>(totalSize));
+    }
+}
+
+void RingBuffer::ReleaseStorage() noexcept
+{
+    Unmap();
+
+    for (GLsync& fence : mFences) {
+        if (fence != nullptr) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    if (mPersistentPtr != nullptr) {
+        mBuffer.Unmap();
+        mPersistentPtr = nullptr;
+    }
+}
+
+void RingBuffer::AdvanceSegment() noexcept
+{
+    mFences[mSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    mSegment = (mSegment + 1) % SegmentCount;
+    mHead = 0;
+
+    GLsync& fence = mFences[mSegment];
+    if (fence != nullptr) {
+        WaitFence(fence);
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
+
+void RingBuffer::Grow(GLsizeiptr minSegmentSize) noexcept
+{
+    // NOTE: The previous storage is released by the driver once the
+    //       commands using it are done, no fence needs to be waited
+    GLsizeiptr newSize = std::max<GLsizeiptr>(mSegmentSize, 1);
+    while (newSize < minSegmentSize) {
+        newSize *= 2;
+    }
+
+    NX_LOG(D, "GPU: Growing ring buffer segments from %lld to %lld bytes",
+        static_cast<long long>(mSegmentSize), static_cast<long long>(newSize));
+
+    ReleaseStorage();
+    CreateStorage(newSize);
+}
+
+} // namespace gpu
@@ -0,0 +1,182 @@
+/* RingBuffer.hpp -- Persistently mapped ring buffer for per-frame GPU uploads
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_GPU_RING_BUFFER_HPP
+#define NX_GPU_RING_BUFFER_HPP
+
+#include "./Buffer.hpp"
+
+#include <glad/gles2.h>
+
+#include <cstdint>
+#include <utility>
+#include <array>
+
+namespace gpu {
+
+/* === Declaration === */
+
+/**
+ * Streaming buffer split into one segment per frame in flight.
+ *
+ * Data is written directly through a persistent coherent mapping when buffer
+ * storage is supported, otherwise each allocation is mapped unsynchronized.
+ * In both cases a fence is inserted when leaving a segment and waited before
+ * writing to it again, so the driver never has to synchronize implicitly.
+ *
+ * Allocations stay valid until the ring wraps back to their segment, or until
+ * the ring grows, which only happens inside Map() on growable rings.
+ */
+class RingBuffer {
+public:
+    /** Suballocated range, in bytes from the start of the buffer */
+    struct Range {
+        GLintptr offset{};
+        GLsizeiptr size{};
+    };
+
+    /** Number of segments, which is the number of frames in flight */
+    static constexpr int SegmentCount = 3;
+
+public:
+    /** Constructors */
+    RingBuffer() = default;
+    RingBuffer(GLenum target, GLsizeiptr segmentSize, GLsizeiptr alignment = 0, bool growable = true) noexcept;
+
+    /** Destructor and Move semantics */
+    ~RingBuffer() noexcept;
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+    RingBuffer(RingBuffer&& other) noexcept;
+    RingBuffer& operator=(RingBuffer&& other) noexcept;
+
+    /** Frame synchronization, must be called once per frame after the buffer swap */
+    static void NextFrame() noexcept;
+
+    /** Public interface */
+    bool IsValid() const noexcept;
+    bool IsPersistent() const noexcept;
+    const Buffer& GetBuffer() const noexcept;
+    Buffer& GetBuffer() noexcept;
+    GLsizeiptr GetSegmentSize() const noexcept;
+
+    /** Suballocation, the returned pointer is valid until Unmap() */
+    template <typename T>
+    T* Map(size_t count, Range* range) noexcept;
+    void* Map(GLsizeiptr size, Range* range) noexcept;
+    void Unmap() noexcept;                                      // Must follow each Map(), no-op when persistently mapped
+
+    Range Upload(const void* data, GLsizeiptr size) noexcept;   // Map, copy and unmap, returns an empty range on failure
+
+private:
+    /** Utility functions */
+    void CreateStorage(GLsizeiptr segmentSize) noexcept;
+    void ReleaseStorage() noexcept;
+    void AdvanceSegment() noexcept;
+    void Grow(GLsizeiptr minSegmentSize) noexcept;
+
+private:
+    /** Member variables */
+    Buffer mBuffer{};
+    std::array<GLsync, SegmentCount> mFences{};
+    uint8_t* mPersistentPtr{nullptr};   //< Mapping of the whole buffer, null on the fallback path
+    GLenum mTarget{GL_ARRAY_BUFFER};
+    GLsizeiptr mSegmentSize{0};
+    GLsizeiptr mAlignment{0};
+    GLsizeiptr mHead{0};                //< Write position in the current segment
+    GLsizeiptr mFrameUsage{0};          //< Bytes allocated since the start of the frame, across segments
+    uint64_t mFrame{0};                 //< Frame of the last allocation
+    int mSegment{0};
+    bool mGrowable{true};
+    bool mMapped{false};                //< An unsynchronized mapping is pending on the fallback path
+
+    /** Frame counter shared by all rings */
+    static inline uint64_t sFrame{0};
+};
+
+/* === Public Implementation === */
+
+inline RingBuffer::~RingBuffer() noexcept
+{
+    ReleaseStorage();
+}
+
+inline RingBuffer::RingBuffer(RingBuffer&& other) noexcept
+    : mBuffer(std::move(other.mBuffer))
+    , mFences(std::exchange(other.mFences, {}))
+    , mPersistentPtr(std::exchange(other.mPersistentPtr, nullptr))
+    , mTarget(other.mTarget)
+    , mSegmentSize(other.mSegmentSize)
+    , mAlignment(other.mAlignment)
+    , mHead(other.mHead)
+    , mFrameUsage(other.mFrameUsage)
+    , mFrame(other.mFrame)
+    , mSegment(other.mSegment)
+    , mGrowable(other.mGrowable)
+    , mMapped(std::exchange(other.mMapped, false))
+{ }
+
+inline RingBuffer& RingBuffer::operator=(RingBuffer&& other) noexcept
+{
+    if (this != &other) {
+        ReleaseStorage();
+        mBuffer = std::move(other.mBuffer);
+        mFences = std::exchange(other.mFences, {});
+        mPersistentPtr = std::exchange(other.mPersistentPtr, nullptr);
+        mTarget = other.mTarget;
+        mSegmentSize = other.mSegmentSize;
+        mAlignment = other.mAlignment;
+        mHead = other.mHead;
+        mFrameUsage = other.mFrameUsage;
+        mFrame = other.mFrame;
+        mSegment = other.mSegment;
+        mGrowable = other.mGrowable;
+        mMapped = std::exchange(other.mMapped, false);
+    }
+    return *this;
+}
+
+inline void RingBuffer::NextFrame() noexcept
+{
+    sFrame++;
+}
+
+inline bool RingBuffer::IsValid() const noexcept
+{
+    return mBuffer.IsValid();
+}
+
+inline bool RingBuffer::IsPersistent() const noexcept
+{
+    return (mPersistentPtr != nullptr);
+}
+
+inline const Buffer& RingBuffer::GetBuffer() const noexcept
+{
+    return mBuffer;
+}
+
+inline Buffer& RingBuffer::GetBuffer() noexcept
+{
+    return mBuffer;
+}
+
+inline GLsizeiptr RingBuffer::GetSegmentSize() const noexcept
+{
+    return mSegmentSize;
+}
+
+template <typename T>
+inline T* RingBuffer::Map(size_t count, Range* range) noexcept
+{
+    return static_cast<T*>(Map(static_cast<GLsizeiptr>(count * sizeof(T)), range));
+}
+
+} // namespace gpu
+
+#endif // NX_GPU_RING_BUFFER_HPP
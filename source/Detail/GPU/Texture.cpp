@@ -9,6 +9,8 @@
 #include "./Texture.hpp"
 #include "./Pipeline.hpp"
 
+#include <SDL3/SDL_video.h>
+
 namespace gpu {
 
 /* === Public Implementation === */
@@ -168,6 +170,63 @@ void Texture::ReallocLayers(int newDepth, bool keepData) noexcept
     );
 }
 
+void Texture::DropTopLevels(int count) noexcept
+{
+    SDL_assert(IsValid() && "Cannot drop levels of invalid texture"); // NOLINT
+    SDL_assert(mTarget == GL_TEXTURE_2D && "DropTopLevels only works with 2D textures"); // NOLINT
+
+    if (count <= 0 || count >= mMipLevels) {
+        return;
+    }
+
+    /* --- Create the smaller texture with same parameters --- */
+
+    TextureConfig newConfig {
+        .target = mTarget,
+        .internalFormat = mInternalFormat,
+        .data = nullptr,
+        .width = NX_MAX(1, mWidth >> count),
+        .height = NX_MAX(1, mHeight >> count),
+        .depth = 0,
+        .mipmap = true,
+        .immutable = mImmutable
+    };
+
+    Texture newTexture(newConfig, mParameters);
+
+    if (!newTexture.IsValid()) {
+        NX_LOG(E, "GPU: Failed to create new texture for DropTopLevels");
+        return;
+    }
+
+    /* --- Copy the remaining levels, the new chain can only be shorter --- */
+
+    const int levelsToCopy = NX_MIN(mMipLevels - count, newTexture.GetNumLevels());
+
+    for (int mip = 0; mip < levelsToCopy; mip++)
+    {
+        glCopyImageSubData(
+            mID, mTarget, mip + count, 0, 0, 0,
+            newTexture.GetID(), newTexture.GetTarget(), mip, 0, 0, 0,
+            NX_MAX(1, newTexture.GetWidth() >> mip),
+            NX_MAX(1, newTexture.GetHeight() >> mip), 1
+        );
+
+        GLenum err = glGetError();
+        if (err != GL_NO_ERROR) {
+            NX_LOG(E, "GPU: glCopyImageSubData failed at mip %d: 0x%x", mip, err);
+        }
+    }
+
+    if (levelsToCopy < newTexture.GetNumLevels()) {
+        newTexture.SetMipLevelRange(0, levelsToCopy - 1);
+    }
+
+    /* --- Swap with new texture --- */
+
+    *this = std::move(newTexture);
+}
+
 void Texture::Upload(const void* data, int depth, int level) noexcept
 {
     SDL_assert(IsValid() && "Cannot upload data to invalid texture"); // NOLINT
@@ -205,6 +264,23 @@ void Texture::UploadCube(const void* const* data, int level) noexcept
     });
 }
 
+void Texture::CopyRegion(const Texture& src, int srcX, int srcY, int dstX, int dstY, int w, int h, int level) noexcept
+{
+    SDL_assert(IsValid() && src.IsValid() && "Cannot copy between invalid textures"); // NOLINT
+    SDL_assert(mTarget == GL_TEXTURE_2D && src.GetTarget() == GL_TEXTURE_2D);
+
+    glCopyImageSubData(
+        src.GetID(), src.GetTarget(), level, srcX, srcY, 0,
+        mID, mTarget, level, dstX, dstY, 0,
+        w, h, 1
+    );
+
+    GLenum err = glGetError();
+    if (err != GL_NO_ERROR) {
+        NX_LOG(E, "GPU: glCopyImageSubData failed for region %dx%d: 0x%x", w, h, err);
+    }
+}
+
 void Texture::SetMipLevelRange(int baseLevel, int maxLevel) noexcept
 {
     SDL_assert(IsValid() && "Cannot set sampling levels on invalid texture"); // NOLINT
@@ -288,6 +364,28 @@ void Texture::GenerateMipmap() noexcept
     });
 }
 
+bool Texture::IsCompressedFormatSupported(GLenum internalFormat) noexcept
+{
+    // NOTE: RGTC and BPTC are core since GL 3.0 and 4.2, S3TC is an extension everywhere
+    static const bool isDesktop = (INX_Display.glProfile != SDL_GL_CONTEXT_PROFILE_ES);
+    static const bool hasS3TC = SDL_GL_ExtensionSupported("GL_EXT_texture_compression_s3tc");
+    static const bool hasRGTC = isDesktop || SDL_GL_ExtensionSupported("GL_EXT_texture_compression_rgtc");
+    static const bool hasBPTC = isDesktop || SDL_GL_ExtensionSupported("GL_EXT_texture_compression_bptc");
+
+    switch (internalFormat) {
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+        return hasS3TC;
+    case GL_COMPRESSED_RED_RGTC1:
+    case GL_COMPRESSED_RG_RGTC2:
+        return hasRGTC;
+    case GL_COMPRESSED_RGBA_BPTC_UNORM:
+        return hasBPTC;
+    default:
+        return false;
+    }
+}
+
 /* === Private Implementation === */
 
 void Texture::AllocateTexture(const TextureConfig& config) noexcept
@@ -303,6 +401,9 @@ void Texture::AllocateTexture(const TextureConfig& config) noexcept
         return AllocateMutableWithFormat(internalFormat);
     };
 
+    // NOTE: Compressed formats are always allocated as immutable storage,
+    //       mutable allocation would require a source image for each level
+
     /* --- Calculate mipmap count first --- */
 
     int mipCount = 1;
@@ -320,7 +421,7 @@ void Texture::AllocateTexture(const TextureConfig& config) noexcept
         mHeight = config.height;
         mDepth = config.depth;
         mMipLevels = mipCount;
-        mImmutable = config.immutable;
+        mImmutable = config.immutable || IsCompressedFormat(config.internalFormat);
         alloc(formatToUse);
         return;
     }
@@ -335,7 +436,7 @@ void Texture::AllocateTexture(const TextureConfig& config) noexcept
         mHeight = config.height;
         mDepth = config.depth;
         mMipLevels = mipCount;
-        mImmutable = config.immutable;
+        mImmutable = config.immutable || IsCompressedFormat(config.internalFormat);
 
         if (alloc(currentFormat)) {
             if (currentFormat != config.internalFormat) {
@@ -519,6 +620,29 @@ void Texture::UploadData_Bound(const void* data, const UploadRegion& region) noe
     int uploadHeight = (region.height > 0) ? region.height : mHeight;
     int uploadDepth = (region.depth > 0) ? region.depth : mDepth;
 
+    /* --- Block compressed data, the region must be aligned on blocks --- */
+
+    if (IsCompressedFormat(mInternalFormat)) {
+        switch (mTarget) {
+        case GL_TEXTURE_2D:
+            glCompressedTexSubImage2D(mTarget, region.level, region.x, region.y, uploadWidth, uploadHeight, mInternalFormat,
+                GetCompressedSize(mInternalFormat, uploadWidth, uploadHeight), data);
+            break;
+        case GL_TEXTURE_2D_ARRAY:
+            glCompressedTexSubImage3D(mTarget, region.level, region.x, region.y, region.z, uploadWidth, uploadHeight, uploadDepth,
+                mInternalFormat, GetCompressedSize(mInternalFormat, uploadWidth, uploadHeight, uploadDepth), data);
+            break;
+        case GL_TEXTURE_CUBE_MAP:
+            glCompressedTexSubImage2D(static_cast<GLenum>(region.cubeFace), region.level, region.x, region.y, uploadWidth, uploadHeight,
+                mInternalFormat, GetCompressedSize(mInternalFormat, uploadWidth, uploadHeight), data);
+            break;
+        default:
+            SDL_assert(false && "Unsupported texture target for compressed data"); // NOLINT
+            break;
+        }
+        return;
+    }
+
     switch (mTarget) {
     case GL_TEXTURE_2D:
         glTexSubImage2D(mTarget, region.level, region.x, region.y, uploadWidth, uploadHeight, format, type, data);
@@ -591,6 +715,11 @@ void Texture::SetAnisotropy_Bound(float anisotropy) noexcept
 
 void Texture::GenerateMipmap_Bound() noexcept
 {
+    if (IsCompressedFormat(mInternalFormat)) {
+        NX_LOG(W, "GPU: Cannot generate mipmaps for %s, levels must be uploaded", FormatToString(mInternalFormat));
+        return;
+    }
+
     glGenerateMipmap(mTarget);
 
     mMipLevels = CalculateMaxMipLevels(
@@ -17,6 +17,25 @@
 #include <unordered_map>
 #include <utility>
 
+/* === Block Compression Formats === */
+
+// NOTE: S3TC, RGTC and BPTC are extensions on GLES and are not part of the generated loader
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#   define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#   define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_RED_RGTC1
+#   define GL_COMPRESSED_RED_RGTC1 0x8DBB
+#endif
+#ifndef GL_COMPRESSED_RG_RGTC2
+#   define GL_COMPRESSED_RG_RGTC2 0x8DBD
+#endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#   define GL_COMPRESSED_RGBA_BPTC_UNORM 0x8E8C
+#endif
+
 namespace gpu {
 
 /* === Forward Declaration === */
@@ -149,11 +168,17 @@ public:
     void ReallocLayers(int count, bool keepData = false) noexcept;
     void ReserveLayers(int count, bool keepData = false) noexcept;
 
+    /** Only valid for mipmapped 2D textures; the texture will have a new ID without its 'count' largest levels */
+    void DropTopLevels(int count) noexcept;
+
     /** Data upload */
     void Upload(const void* data, int depth = 0, int level = 0) noexcept;
     void Upload(const void* data, const UploadRegion& region) noexcept;
     void UploadCube(const void* const* data, int level = 0) noexcept;
 
+    /** Copies a region of a 2D level from another texture, formats must be of the same size class */
+    void CopyRegion(const Texture& src, int srcX, int srcY, int dstX, int dstY, int w, int h, int level = 0) noexcept;
+
     /** Texture parameters */
     void SetMipLevelRange(int baseLevel, int maxLevel) noexcept;
     void SetParameters(const TextureParam& parameters) noexcept;
@@ -162,6 +187,11 @@ public:
     void SetAnisotropy(float anisotropy) noexcept;
     void GenerateMipmap() noexcept;
 
+    /** Block compression helpers */
+    static bool IsCompressedFormat(GLenum internalFormat) noexcept;
+    static bool IsCompressedFormatSupported(GLenum internalFormat) noexcept;
+    static GLsizei GetCompressedSize(GLenum internalFormat, int width, int height, int depth = 1) noexcept;
+
 private:
     /** Member variables */
     GLuint mID{0};
@@ -461,6 +491,11 @@ inline const char* Texture::FormatToString(GLenum internalFormat) noexcept
     case GL_DEPTH_COMPONENT32F: return "GL_DEPTH_COMPONENT32F";
     case GL_DEPTH24_STENCIL8: return "GL_DEPTH24_STENCIL8";
     case GL_DEPTH32F_STENCIL8: return "GL_DEPTH32F_STENCIL8";
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT: return "GL_COMPRESSED_RGBA_S3TC_DXT1_EXT";
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT: return "GL_COMPRESSED_RGBA_S3TC_DXT5_EXT";
+    case GL_COMPRESSED_RED_RGTC1: return "GL_COMPRESSED_RED_RGTC1";
+    case GL_COMPRESSED_RG_RGTC2: return "GL_COMPRESSED_RG_RGTC2";
+    case GL_COMPRESSED_RGBA_BPTC_UNORM: return "GL_COMPRESSED_RGBA_BPTC_UNORM";
     default: return "Unknown";
     }
 }
@@ -477,6 +512,41 @@ inline const char* Texture::TargetToString(GLenum target) noexcept
     }
 }
 
+inline bool Texture::IsCompressedFormat(GLenum internalFormat) noexcept
+{
+    switch (internalFormat) {
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+    case GL_COMPRESSED_RED_RGTC1:
+    case GL_COMPRESSED_RG_RGTC2:
+    case GL_COMPRESSED_RGBA_BPTC_UNORM:
+        return true;
+    default:
+        return false;
+    }
+}
+
+inline GLsizei Texture::GetCompressedSize(GLenum internalFormat, int width, int height, int depth) noexcept
+{
+    GLsizei blockBytes = 0;
+
+    switch (internalFormat) {
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_RED_RGTC1:
+        blockBytes = 8;
+        break;
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+    case GL_COMPRESSED_RG_RGTC2:
+    case GL_COMPRESSED_RGBA_BPTC_UNORM:
+        blockBytes = 16;
+        break;
+    default:
+        return 0;
+    }
+
+    return ((width + 3) / 4) * ((height + 3) / 4) * NX_MAX(depth, 1) * blockBytes;
+}
+
 inline int Texture::CalculateMaxMipLevels(int width, int height, int depth) noexcept
 {
     int maxDimension = NX_MAX3(width, height, (mTarget == GL_TEXTURE_3D) ? depth : 1);
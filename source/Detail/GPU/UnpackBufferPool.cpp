@@ -0,0 +1,203 @@
+/* UnpackBufferPool.cpp -- Pool of pixel unpack buffers for staged texture uploads
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./UnpackBufferPool.hpp"
+#include "./Pipeline.hpp"
+
+#include "../Util/Ranges.hpp"
+
+#include <algorithm>
+
+namespace gpu {
+
+/* === Public Implementation === */
+
+int UnpackBufferPool::Acquire(GLsizeiptr size) noexcept
+{
+    SDL_assert(size > 0);
+
+    /* --- Find the smallest ready slot that fits, or any ready slot to regrow --- */
+
+    int fitting = -1;
+    int fallback = -1;
+
+    for (int i = 0; i < static_cast<int>(mSlots.GetSize()); i++) {
+        Slot& slot = mSlots[i];
+        if (slot.acquired || !IsSlotReady(slot)) {
+            continue;
+        }
+        if (slot.buffer.GetSize() >= size) {
+            if (fitting < 0 || slot.buffer.GetSize() < mSlots[fitting].buffer.GetSize()) {
+                fitting = i;
+            }
+        }
+        else if (fallback < 0) {
+            fallback = i;
+        }
+    }
+
+    /* --- Create a new slot if every existing one is too small or in flight --- */
+
+    int index = fitting;
+
+    if (index < 0) {
+        if (static_cast<int>(mSlots.GetSize()) < MaxSlotCount) {
+            index = (mSlots.EmplaceBack() != nullptr) ? static_cast<int>(mSlots.GetSize()) - 1 : -1;
+        }
+        else {
+            index = fallback;
+        }
+    }
+
+    if (index < 0) {
+        return -1;
+    }
+
+    /* --- (Re)create the storage if needed and map it --- */
+
+    Slot& slot = mSlots[index];
+
+    if (slot.buffer.GetSize() < size) {
+        ReleaseSlotStorage(slot);
+        if (!CreateSlotStorage(slot, size)) {
+            return -1;
+        }
+    }
+
+    if (!slot.persistent) {
+        // NOTE: Invalidating lets the driver hand out new memory
+        //       if the previous contents are still being read
+        slot.pointer = slot.buffer.Map<uint8_t>(GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        if (slot.pointer == nullptr) {
+            NX_LOG(E, "GPU: Failed to map pixel unpack buffer");
+            return -1;
+        }
+    }
+
+    slot.acquired = true;
+    mAcquiredCount++;
+
+    return index;
+}
+
+void UnpackBufferPool::Upload(int slot, Texture& texture, GLintptr offset, const UploadRegion& region) noexcept
+{
+    SDL_assert(slot >= 0 && slot < static_cast<int>(mSlots.GetSize()) && mSlots[slot].acquired);
+
+    Slot& s = mSlots[slot];
+
+    if (!s.persistent && s.pointer != nullptr) {
+        s.buffer.Unmap();
+        s.pointer = nullptr;
+    }
+
+    // NOTE: With an unpack buffer bound, the data pointer is an offset into it
+    Pipeline::WithBufferBind(GL_PIXEL_UNPACK_BUFFER, s.buffer.GetID(), [&]() {
+        texture.Upload(reinterpret_cast<const void*>(offset), region);
+    });
+}
+
+void UnpackBufferPool::Release(int slot) noexcept
+{
+    SDL_assert(slot >= 0 && slot < static_cast<int>(mSlots.GetSize()) && mSlots[slot].acquired);
+
+    Slot& s = mSlots[slot];
+
+    if (!s.persistent && s.pointer != nullptr) {
+        s.buffer.Unmap();
+        s.pointer = nullptr;
+    }
+
+    if (s.fence != nullptr) {
+        glDeleteSync(s.fence);
+    }
+
+    s.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    s.acquired = false;
+    mAcquiredCount--;
+}
+
+void UnpackBufferPool::Clear() noexcept
+{
+    for (Slot& slot : mSlots) {
+        ReleaseSlotStorage(slot);
+    }
+
+    mSlots.Clear();
+    mAcquiredCount = 0;
+}
+
+/* === Private Implementation === */
+
+bool UnpackBufferPool::IsSlotReady(Slot& slot) noexcept
+{
+    if (slot.fence == nullptr) {
+        return true;
+    }
+
+    GLenum result = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+        return false;
+    }
+
+    glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+
+    return true;
+}
+
+bool UnpackBufferPool::CreateSlotStorage(Slot& slot, GLsizeiptr size) noexcept
+{
+    // NOTE: Sizes are rounded up so that slots get reused across similar images
+    constexpr GLsizeiptr granularity = 256 * 1024;
+    size = (size + granularity - 1) / granularity * granularity;
+
+    /* --- Persistent coherent mapping when buffer storage is available --- */
+
+    constexpr GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    slot.buffer = Buffer::CreateStorage(GL_PIXEL_UNPACK_BUFFER, size, mapFlags);
+    if (slot.buffer.IsValid()) {
+        slot.pointer = slot.buffer.Map<uint8_t>(mapFlags);
+        if (slot.pointer != nullptr) {
+            slot.persistent = true;
+            return true;
+        }
+        NX_LOG(W, "GPU: Failed to map pixel unpack buffer persistently, using transient mapping instead");
+    }
+
+    /* --- Fallback to a mutable buffer mapped on acquire --- */
+
+    slot.buffer = Buffer(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    slot.persistent = false;
+
+    if (!slot.buffer.IsValid()) {
+        NX_LOG(E, "GPU: Failed to create pixel unpack buffer (size=%lld)", static_cast<long long>(size));
+        return false;
+    }
+
+    return true;
+}
+
+void UnpackBufferPool::ReleaseSlotStorage(Slot& slot) noexcept
+{
+    if (slot.fence != nullptr) {
+        glDeleteSync(slot.fence);
+        slot.fence = nullptr;
+    }
+
+    if (slot.pointer != nullptr) {
+        slot.buffer.Unmap();
+        slot.pointer = nullptr;
+    }
+
+    slot.buffer = Buffer{};
+    slot.persistent = false;
+}
+
+} // namespace gpu
@@ -0,0 +1,103 @@
+/* UnpackBufferPool.hpp -- Pool of pixel unpack buffers for staged texture uploads
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_GPU_UNPACK_BUFFER_POOL_HPP
+#define NX_GPU_UNPACK_BUFFER_POOL_HPP
+
+#include "../Util/DynamicArray.hpp"
+#include "./Texture.hpp"
+#include "./Buffer.hpp"
+
+#include <glad/gles2.h>
+
+#include <cstdint>
+
+namespace gpu {
+
+/* === Declaration === */
+
+/**
+ * Staging pixel unpack buffers for texture uploads.
+ *
+ * A slot is acquired on the main thread, filled from any thread through its
+ * pointer, then the texture transfers are issued from the bound buffer so the
+ * driver copies from GPU visible memory instead of the client pointer.
+ * A fence is inserted on release and the slot is only reused once signaled.
+ *
+ * Slots are persistently mapped when buffer storage is supported, otherwise
+ * they are mapped on acquire and unmapped before the first transfer.
+ */
+class UnpackBufferPool {
+public:
+    /** Maximum number of slots in flight */
+    static constexpr int MaxSlotCount = 8;
+
+public:
+    /** Constructors */
+    UnpackBufferPool() = default;
+
+    /** Destructor, Clear() must be called before the context is destroyed */
+    ~UnpackBufferPool() noexcept = default;
+    UnpackBufferPool(const UnpackBufferPool&) = delete;
+    UnpackBufferPool& operator=(const UnpackBufferPool&) = delete;
+
+    /** Main thread, returns -1 if every slot is still in flight */
+    int Acquire(GLsizeiptr size) noexcept;
+
+    /** Write pointer of an acquired slot, can be filled from any thread until the first Upload() */
+    uint8_t* GetPointer(int slot) const noexcept;
+
+    /** Main thread, issues a texture transfer from 'offset' in the slot */
+    void Upload(int slot, Texture& texture, GLintptr offset, const UploadRegion& region) noexcept;
+
+    /** Main thread, fences the slot transfers and returns it to the pool */
+    void Release(int slot) noexcept;
+
+    /** Returns the number of slots acquired and not released */
+    int GetAcquiredCount() const noexcept;
+
+    /** Destroys all buffers, slots still acquired are dropped */
+    void Clear() noexcept;
+
+private:
+    struct Slot {
+        Buffer buffer{};
+        uint8_t* pointer{nullptr};
+        GLsync fence{nullptr};
+        bool acquired{false};
+        bool persistent{false};
+    };
+
+private:
+    /** Utility functions */
+    static bool IsSlotReady(Slot& slot) noexcept;
+    static bool CreateSlotStorage(Slot& slot, GLsizeiptr size) noexcept;
+    static void ReleaseSlotStorage(Slot& slot) noexcept;
+
+private:
+    /** Member variables */
+    util::DynamicArray<Slot> mSlots{};
+    int mAcquiredCount{0};
+};
+
+/* === Public Implementation === */
+
+inline uint8_t* UnpackBufferPool::GetPointer(int slot) const noexcept
+{
+    SDL_assert(slot >= 0 && slot < static_cast<int>(mSlots.GetSize()) && mSlots[slot].acquired);
+    return mSlots[slot].pointer;
+}
+
+inline int UnpackBufferPool::GetAcquiredCount() const noexcept
+{
+    return mAcquiredCount;
+}
+
+} // namespace gpu
+
+#endif // NX_GPU_UNPACK_BUFFER_POOL_HPP
@@ -134,6 +134,24 @@ VertexArray::VertexArray(Buffer* indexBuffer, std::initializer_list<VertexBuffer
     });
 }
 
+void VertexArray::SetIndexBuffer(const Buffer* buffer) noexcept
+{
+    if (buffer && (!buffer->IsValid() || buffer->GetTarget() != GL_ELEMENT_ARRAY_BUFFER)) {
+        NX_LOG(E, "GPU: Index buffer must be valid and have GL_ELEMENT_ARRAY_BUFFER target");
+        return;
+    }
+
+    if (mIndexBuffer == buffer) {
+        return;
+    }
+
+    Pipeline::WithVertexArrayBind(mID, [&]()  {
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer ? buffer->GetID() : 0);
+    });
+
+    mIndexBuffer = buffer;
+}
+
 void VertexArray::BindVertexBuffer(size_t index, const Buffer* buffer) noexcept
 {
     SDL_assert(buffer && !buffer->IsValid());
@@ -200,4 +218,20 @@ void VertexArray::UnbindVertexBuffers(std::initializer_list<size_t> indices) noe
     });
 }
 
+void VertexArray::SetVertexBufferOffset(size_t index, GLintptr offset) noexcept
+{
+    const Buffer* buffer = mVertexBuffers[index].attachedBuffer;
+    SDL_assert(buffer != nullptr);
+
+    // NOTE: Used to draw from an offset in a shared buffer without
+    //       base instance support, as on OpenGL ES 3.2
+    Pipeline::WithVertexArrayBind(mID, [&]()  {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->GetID());
+        for (VertexAttribute attr : mVertexBuffers[index].attributes) {
+            attr.offset += offset;
+            SetupVertexAttribute(attr);
+        }
+    });
+}
+
 } // namespace gpu
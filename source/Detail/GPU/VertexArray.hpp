@@ -72,6 +72,7 @@ public:
 
     /** Access to index buffer */
     const Buffer* GetIndexBuffer() const noexcept;
+    void SetIndexBuffer(const Buffer* buffer) noexcept;                      //< Attaches an index buffer after creation, or detaches it with null
 
     /** Access to vertex buffers */
     size_t GetVertexBufferCount() const noexcept;
@@ -81,6 +82,7 @@ public:
     void UnbindVertexBuffer(size_t index) noexcept;
     void BindVertexBuffers(std::initializer_list<std::pair<size_t, const Buffer*>> buffers) noexcept;
     void UnbindVertexBuffers(std::initializer_list<size_t> indices) noexcept;
+    void SetVertexBufferOffset(size_t index, GLintptr offset) noexcept;     //< Shifts the attributes of a bound buffer by 'offset' bytes
 
 private:
     /** Member variables */
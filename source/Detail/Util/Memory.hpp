@@ -10,16 +10,23 @@
 #define NX_UTIL_MEMORY_HPP
 
 #include <NX/NX_Memory.h>
+#include <type_traits>
 #include <memory>
 
 namespace util {
 
 /**
  * @brief Custom deleter using NX_Free.
+ *
+ * Destroys the pointed object first, arrays are only supported for
+ * trivially destructible types, see MakeUniqueArray().
  */
 template <typename T = void>
 struct Deleter {
     void operator()(T* ptr) const noexcept {
+        if constexpr (!std::is_void_v<T> && !std::is_trivially_destructible_v<T>) {
+            if (ptr != nullptr) ptr->~T();
+        }
         NX_Free(ptr);
     }
 };
@@ -37,6 +44,7 @@ template <typename T, typename... Args>
 inline UniquePtr<T> MakeUnique(Args&&... args)
 {
     T* ptr = NX_Malloc<T>(1);
+    if (ptr == nullptr) return nullptr;
     new (ptr) T(std::forward<Args>(args)...);
     return UniquePtr<T>(ptr);
 }
@@ -47,6 +55,7 @@ inline UniquePtr<T> MakeUnique(Args&&... args)
 template <typename T>
 inline UniquePtr<T> MakeUniqueArray(size_t count = 1)
 {
+    static_assert(std::is_trivially_destructible_v<T>, "Deleter only destroys the first element");
     T* ptr = NX_Malloc<T>(count);
     for (size_t i = 0; i < count; ++i) {
         new (ptr + i) T();
@@ -77,6 +86,7 @@ inline SharedPtr<T> MakeShared(Args&&... args)
 template <typename T>
 inline SharedPtr<T> MakeSharedArray(size_t count = 1)
 {
+    static_assert(std::is_trivially_destructible_v<T>, "Deleter only destroys the first element");
     T* ptr = NX_Malloc<T>(count);
     for (size_t i = 0; i < count; ++i) {
         new (ptr + i) T();
@@ -0,0 +1,92 @@
+/* SpscQueue.hpp -- Lock-free single producer, single consumer bounded queue
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_UTIL_SPSC_QUEUE_HPP
+#define NX_UTIL_SPSC_QUEUE_HPP
+
+#include <type_traits>
+#include <cstddef>
+#include <atomic>
+#include <array>
+
+namespace util {
+
+/* === Declaration === */
+
+/**
+ * @brief Bounded ring buffer shared by exactly one producer thread and one consumer thread.
+ *
+ * Neither side ever blocks: TryPush fails when the queue is full and TryPop fails
+ * when it is empty. Head and tail live on separate cache lines so that both threads
+ * only contend when the queue is close to full or empty.
+ *
+ * @tparam T Trivially copyable element type.
+ * @tparam N Capacity, must be a power of two.
+ */
+template <typename T, size_t N>
+class SpscQueue {
+    static_assert((N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "SpscQueue elements must be trivially copyable");
+
+public:
+    /** Producer side */
+    bool TryPush(const T& value) noexcept;
+
+    /** Consumer side */
+    bool TryPop(T* value) noexcept;
+
+    /** Approximate when called concurrently */
+    bool IsEmpty() const noexcept;
+
+private:
+    static constexpr size_t CacheLine = 64;
+
+    std::array<T, N> mItems{};
+    alignas(CacheLine) std::atomic<size_t> mHead{0};   //< Next index to pop, written by the consumer
+    alignas(CacheLine) std::atomic<size_t> mTail{0};   //< Next index to push, written by the producer
+};
+
+/* === Public Implementation === */
+
+template <typename T, size_t N>
+inline bool SpscQueue<T, N>::TryPush(const T& value) noexcept
+{
+    const size_t tail = mTail.load(std::memory_order_relaxed);
+    if (tail - mHead.load(std::memory_order_acquire) == N) {
+        return false;
+    }
+
+    mItems[tail & (N - 1)] = value;
+    mTail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T, size_t N>
+inline bool SpscQueue<T, N>::TryPop(T* value) noexcept
+{
+    const size_t head = mHead.load(std::memory_order_relaxed);
+    if (head == mTail.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    *value = mItems[head & (N - 1)];
+    mHead.store(head + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <typename T, size_t N>
+inline bool SpscQueue<T, N>::IsEmpty() const noexcept
+{
+    return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire);
+}
+
+} // namespace util
+
+#endif // NX_UTIL_SPSC_QUEUE_HPP
@@ -0,0 +1,454 @@
+/* INX_BlockCompression.cpp -- Internal CPU encoders for block compressed pixel formats
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./INX_BlockCompression.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <cfloat>
+#include <cmath>
+
+// ============================================================================
+// LOCAL FUNCTIONS
+// ============================================================================
+
+/** Writes values of up to 32 bits in little endian bit order, the destination must be zeroed */
+struct INX_BitWriter {
+    uint8_t* data;
+    int pos = 0;
+
+    void Write(uint32_t value, int bits) {
+        for (int i = 0; i < bits; i++, pos++) {
+            data[pos >> 3] |= static_cast<uint8_t>(((value >> i) & 1) << (pos & 7));
+        }
+    }
+};
+
+/** Principal axis of a set of points, through power iterations on their covariance */
+template <int N>
+static void INX_PrincipalAxis(const float (*points)[N], int count, const float* mean, float* axis)
+{
+    float cov[N][N] = {};
+
+    for (int i = 0; i < count; i++) {
+        for (int a = 0; a < N; a++) {
+            for (int b = a; b < N; b++) {
+                cov[a][b] += (points[i][a] - mean[a]) * (points[i][b] - mean[b]);
+            }
+        }
+    }
+
+    for (int a = 0; a < N; a++) {
+        for (int b = 0; b < a; b++) {
+            cov[a][b] = cov[b][a];
+        }
+        axis[a] = 1.0f;
+    }
+
+    for (int iter = 0; iter < 8; iter++) {
+        float next[N] = {};
+        float length = 0.0f;
+        for (int a = 0; a < N; a++) {
+            for (int b = 0; b < N; b++) {
+                next[a] += cov[a][b] * axis[b];
+            }
+            length = std::max(length, std::abs(next[a]));
+        }
+        if (length < FLT_EPSILON) {
+            break;
+        }
+        for (int a = 0; a < N; a++) {
+            axis[a] = next[a] / length;
+        }
+    }
+}
+
+/** Endpoints of a set of points along their principal axis */
+template <int N>
+static void INX_FitEndpoints(const float (*points)[N], int count, float* e0, float* e1)
+{
+    float mean[N] = {};
+    for (int i = 0; i < count; i++) {
+        for (int c = 0; c < N; c++) mean[c] += points[i][c];
+    }
+    for (int c = 0; c < N; c++) {
+        mean[c] /= count;
+    }
+
+    float axis[N];
+    INX_PrincipalAxis<N>(points, count, mean, axis);
+
+    float tMin = FLT_MAX, tMax = -FLT_MAX;
+    for (int i = 0; i < count; i++) {
+        float t = 0.0f;
+        for (int c = 0; c < N; c++) t += (points[i][c] - mean[c]) * axis[c];
+        tMin = std::min(tMin, t);
+        tMax = std::max(tMax, t);
+    }
+
+    float axisLengthSq = 0.0f;
+    for (int c = 0; c < N; c++) {
+        axisLengthSq += axis[c] * axis[c];
+    }
+    if (axisLengthSq > FLT_EPSILON) {
+        tMin /= axisLengthSq;
+        tMax /= axisLengthSq;
+    }
+
+    for (int c = 0; c < N; c++) {
+        e0[c] = std::clamp(mean[c] + axis[c] * tMin, 0.0f, 255.0f);
+        e1[c] = std::clamp(mean[c] + axis[c] * tMax, 0.0f, 255.0f);
+    }
+}
+
+static uint16_t INX_PackRGB565(const float* color)
+{
+    int r = static_cast<int>(color[0] * 31.0f / 255.0f + 0.5f);
+    int g = static_cast<int>(color[1] * 63.0f / 255.0f + 0.5f);
+    int b = static_cast<int>(color[2] * 31.0f / 255.0f + 0.5f);
+    return static_cast<uint16_t>((std::clamp(r, 0, 31) << 11) | (std::clamp(g, 0, 63) << 5) | std::clamp(b, 0, 31));
+}
+
+static void INX_UnpackRGB565(uint16_t packed, int* color)
+{
+    int r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+}
+
+/** BC1 color block, also used by BC3 in which case the 3 color mode is never selected */
+static void INX_EncodeColorBlock(const uint8_t* rgba, uint8_t* dst, bool punchThrough)
+{
+    std::memset(dst, 0, 8);
+
+    /* --- Gather the opaque pixels --- */
+
+    float points[16][3];
+    bool transparent[16] = {};
+    int count = 0;
+
+    for (int i = 0; i < 16; i++) {
+        transparent[i] = punchThrough && (rgba[4 * i + 3] < 128);
+        if (!transparent[i]) {
+            points[count][0] = rgba[4 * i + 0];
+            points[count][1] = rgba[4 * i + 1];
+            points[count][2] = rgba[4 * i + 2];
+            count++;
+        }
+    }
+
+    if (count == 0) {
+        // NOTE: c0 <= c1 selects the 3 color mode, index 3 is transparent black
+        dst[2] = dst[3] = 0xFF;
+        dst[4] = dst[5] = dst[6] = dst[7] = 0xFF;
+        return;
+    }
+
+    const bool threeColors = (count < 16);
+
+    /* --- Fit and quantize the endpoints, slightly inset to reduce the rounding error --- */
+
+    float e0[3], e1[3];
+    INX_FitEndpoints<3>(points, count, e0, e1);
+
+    for (int c = 0; c < 3; c++) {
+        float inset = (e1[c] - e0[c]) / 16.0f;
+        e0[c] += inset;
+        e1[c] -= inset;
+    }
+
+    uint16_t c0 = INX_PackRGB565(e1);
+    uint16_t c1 = INX_PackRGB565(e0);
+
+    // NOTE: The mode is selected by the order of the endpoints, c0 > c1 for 4 colors
+    if ((c0 < c1) != threeColors) {
+        std::swap(c0, c1);
+    }
+
+    /* --- Build the palette --- */
+
+    int palette[4][3];
+    INX_UnpackRGB565(c0, palette[0]);
+    INX_UnpackRGB565(c1, palette[1]);
+
+    const bool fourColors = (c0 > c1) || !punchThrough;
+    const int paletteSize = fourColors ? 4 : 3;
+
+    for (int c = 0; c < 3; c++) {
+        if (fourColors) {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+        else {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+
+    /* --- Select the indices --- */
+
+    uint32_t indices = 0;
+
+    for (int i = 0; i < 16; i++) {
+        int best = 3;
+        if (!transparent[i]) {
+            int bestError = INT32_MAX;
+            for (int p = 0; p < paletteSize; p++) {
+                int dr = rgba[4 * i + 0] - palette[p][0];
+                int dg = rgba[4 * i + 1] - palette[p][1];
+                int db = rgba[4 * i + 2] - palette[p][2];
+                int error = dr * dr + dg * dg + db * db;
+                if (error < bestError) {
+                    bestError = error;
+                    best = p;
+                }
+            }
+        }
+        indices |= static_cast<uint32_t>(best) << (2 * i);
+    }
+
+    dst[0] = c0 & 0xFF; dst[1] = c0 >> 8;
+    dst[2] = c1 & 0xFF; dst[3] = c1 >> 8;
+    std::memcpy(dst + 4, &indices, 4);
+}
+
+/** BC4 block of one channel, also used for the BC3 alpha and each BC5 channel */
+static void INX_EncodeChannelBlock(const uint8_t* rgba, int channel, uint8_t* dst)
+{
+    std::memset(dst, 0, 8);
+
+    int minValue = 255, maxValue = 0;
+    for (int i = 0; i < 16; i++) {
+        minValue = std::min<int>(minValue, rgba[4 * i + channel]);
+        maxValue = std::max<int>(maxValue, rgba[4 * i + channel]);
+    }
+
+    dst[0] = static_cast<uint8_t>(maxValue);
+    dst[1] = static_cast<uint8_t>(minValue);
+
+    if (minValue == maxValue) {
+        return;
+    }
+
+    /* --- Eight values mode, a0 > a1 --- */
+
+    int palette[8];
+    palette[0] = maxValue;
+    palette[1] = minValue;
+    for (int i = 2; i < 8; i++) {
+        palette[i] = ((8 - i) * maxValue + (i - 1) * minValue) / 7;
+    }
+
+    uint64_t indices = 0;
+
+    for (int i = 0; i < 16; i++) {
+        int value = rgba[4 * i + channel];
+        int best = 0, bestError = INT32_MAX;
+        for (int p = 0; p < 8; p++) {
+            int error = std::abs(value - palette[p]);
+            if (error < bestError) {
+                bestError = error;
+                best = p;
+            }
+        }
+        indices |= static_cast<uint64_t>(best) << (3 * i);
+    }
+
+    for (int i = 0; i < 6; i++) {
+        dst[2 + i] = static_cast<uint8_t>(indices >> (8 * i));
+    }
+}
+
+/** BC7 block encoded in mode 6, one subset with 8-bit RGBA endpoints and 4-bit indices */
+static void INX_EncodeBPTCBlock(const uint8_t* rgba, uint8_t* dst)
+{
+    static constexpr int weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    float points[16][4];
+    for (int i = 0; i < 16; i++) {
+        for (int c = 0; c < 4; c++) points[i][c] = rgba[4 * i + c];
+    }
+
+    /* --- Quantizes an endpoint to 7 bits per channel plus a shared p-bit --- */
+
+    auto quantize = [](const float* e, int* q, int* p) {
+        float bestError = FLT_MAX;
+        for (int pbit = 0; pbit < 2; pbit++) {
+            int candidate[4];
+            float error = 0.0f;
+            for (int c = 0; c < 4; c++) {
+                candidate[c] = std::clamp(static_cast<int>((e[c] - pbit) / 2.0f + 0.5f), 0, 127);
+                float d = static_cast<float>((candidate[c] << 1) | pbit) - e[c];
+                error += d * d;
+            }
+            if (error < bestError) {
+                bestError = error;
+                std::copy(candidate, candidate + 4, q);
+                *p = pbit;
+            }
+        }
+    };
+
+    /* --- Selects the indices for quantized endpoints, returns the total error --- */
+
+    auto selectIndices = [&](const int* q0, int p0, const int* q1, int p1, int* indices) {
+        int palette[16][4];
+        for (int c = 0; c < 4; c++) {
+            int v0 = (q0[c] << 1) | p0;
+            int v1 = (q1[c] << 1) | p1;
+            for (int i = 0; i < 16; i++) {
+                palette[i][c] = ((64 - weights[i]) * v0 + weights[i] * v1 + 32) >> 6;
+            }
+        }
+        int total = 0;
+        for (int i = 0; i < 16; i++) {
+            int bestError = INT32_MAX;
+            for (int p = 0; p < 16; p++) {
+                int error = 0;
+                for (int c = 0; c < 4; c++) {
+                    int d = rgba[4 * i + c] - palette[p][c];
+                    error += d * d;
+                }
+                if (error < bestError) {
+                    bestError = error;
+                    indices[i] = p;
+                }
+            }
+            total += bestError;
+        }
+        return total;
+    };
+
+    /* --- Initial fit along the principal axis --- */
+
+    float e0[4], e1[4];
+    INX_FitEndpoints<4>(points, 16, e0, e1);
+
+    int q0[4], q1[4], p0 = 0, p1 = 0;
+    quantize(e0, q0, &p0);
+    quantize(e1, q1, &p1);
+
+    int indices[16];
+    int error = selectIndices(q0, p0, q1, p1, indices);
+
+    /* --- Least squares refinement of the endpoints from the selected weights --- */
+
+    for (int iter = 0; iter < 2 && error > 0; iter++) {
+        float a = 0.0f, b = 0.0f, c = 0.0f;
+        float x0[4] = {}, x1[4] = {};
+        for (int i = 0; i < 16; i++) {
+            float t = weights[indices[i]] / 64.0f;
+            a += (1.0f - t) * (1.0f - t);
+            b += t * (1.0f - t);
+            c += t * t;
+            for (int k = 0; k < 4; k++) {
+                x0[k] += (1.0f - t) * points[i][k];
+                x1[k] += t * points[i][k];
+            }
+        }
+
+        float det = a * c - b * b;
+        if (std::abs(det) < FLT_EPSILON) {
+            break;
+        }
+
+        float r0[4], r1[4];
+        for (int k = 0; k < 4; k++) {
+            r0[k] = std::clamp((c * x0[k] - b * x1[k]) / det, 0.0f, 255.0f);
+            r1[k] = std::clamp((a * x1[k] - b * x0[k]) / det, 0.0f, 255.0f);
+        }
+
+        int rq0[4], rq1[4], rp0 = 0, rp1 = 0;
+        quantize(r0, rq0, &rp0);
+        quantize(r1, rq1, &rp1);
+
+        int refined[16];
+        int refinedError = selectIndices(rq0, rp0, rq1, rp1, refined);
+        if (refinedError >= error) {
+            break;
+        }
+
+        std::copy(rq0, rq0 + 4, q0);
+        std::copy(rq1, rq1 + 4, q1);
+        std::copy(refined, refined + 16, indices);
+        p0 = rp0, p1 = rp1;
+        error = refinedError;
+    }
+
+    /* --- The most significant bit of the first index is implicit, it must be zero --- */
+
+    if (indices[0] & 8) {
+        for (int k = 0; k < 4; k++) std::swap(q0[k], q1[k]);
+        for (int i = 0; i < 16; i++) indices[i] = 15 - indices[i];
+        std::swap(p0, p1);
+    }
+
+    /* --- Write the block --- */
+
+    std::memset(dst, 0, 16);
+    INX_BitWriter writer{dst};
+
+    writer.Write(1 << 6, 7);
+    for (int k = 0; k < 4; k++) {
+        writer.Write(q0[k], 7);
+        writer.Write(q1[k], 7);
+    }
+    writer.Write(p0, 1);
+    writer.Write(p1, 1);
+
+    for (int i = 0; i < 16; i++) {
+        writer.Write(indices[i], (i == 0) ? 3 : 4);
+    }
+}
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+int INX_GetBlockBytes(NX_PixelFormat format)
+{
+    switch (format) {
+    case NX_PIXEL_FORMAT_BC1:
+    case NX_PIXEL_FORMAT_BC4:
+        return 8;
+    case NX_PIXEL_FORMAT_BC3:
+    case NX_PIXEL_FORMAT_BC5:
+    case NX_PIXEL_FORMAT_BC7:
+        return 16;
+    default:
+        break;
+    }
+    return 0;
+}
+
+bool INX_EncodeBlock(NX_PixelFormat format, const uint8_t* rgba, uint8_t* dst)
+{
+    switch (format) {
+    case NX_PIXEL_FORMAT_BC1:
+        INX_EncodeColorBlock(rgba, dst, true);
+        break;
+    case NX_PIXEL_FORMAT_BC3:
+        INX_EncodeChannelBlock(rgba, 3, dst);
+        INX_EncodeColorBlock(rgba, dst + 8, false);
+        break;
+    case NX_PIXEL_FORMAT_BC4:
+        INX_EncodeChannelBlock(rgba, 0, dst);
+        break;
+    case NX_PIXEL_FORMAT_BC5:
+        INX_EncodeChannelBlock(rgba, 0, dst);
+        INX_EncodeChannelBlock(rgba, 1, dst + 8);
+        break;
+    case NX_PIXEL_FORMAT_BC7:
+        INX_EncodeBPTCBlock(rgba, dst);
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,29 @@
+/* INX_BlockCompression.hpp -- Internal CPU encoders for block compressed pixel formats
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef INX_BLOCK_COMPRESSION_HPP
+#define INX_BLOCK_COMPRESSION_HPP
+
+#include <NX/NX_Image.h>
+#include <cstdint>
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+/** Returns the size of an encoded 4x4 block, 0 if the format is not block compressed */
+int INX_GetBlockBytes(NX_PixelFormat format);
+
+/**
+ * Encodes a 4x4 block of RGBA8 pixels, stored row by row, into 'dst' which must hold
+ * INX_GetBlockBytes(format) bytes. Safe to call concurrently on different blocks.
+ * Returns false if the format is not block compressed.
+ */
+bool INX_EncodeBlock(NX_PixelFormat format, const uint8_t* rgba, uint8_t* dst);
+
+#endif // INX_BLOCK_COMPRESSION_HPP
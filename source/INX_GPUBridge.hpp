@@ -40,6 +40,11 @@ inline GLenum INX_GPU_GetInternalFormat(NX_PixelFormat format, bool framebuffer)
     case NX_PIXEL_FORMAT_RG32F: internalFormat = GL_RG32F; break;
     case NX_PIXEL_FORMAT_RGB32F: internalFormat = GL_RGB32F; break;
     case NX_PIXEL_FORMAT_RGBA32F: internalFormat = GL_RGBA32F; break;
+    case NX_PIXEL_FORMAT_BC1: internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+    case NX_PIXEL_FORMAT_BC3: internalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+    case NX_PIXEL_FORMAT_BC4: internalFormat = GL_COMPRESSED_RED_RGTC1; break;
+    case NX_PIXEL_FORMAT_BC5: internalFormat = GL_COMPRESSED_RG_RGTC2; break;
+    case NX_PIXEL_FORMAT_BC7: internalFormat = GL_COMPRESSED_RGBA_BPTC_UNORM; break;
     default: break;
     }
 
@@ -80,6 +85,11 @@ inline NX_PixelFormat INX_GPU_GetPixelFormat(GLenum internalFormat)
     case GL_RG32F: return NX_PIXEL_FORMAT_RG32F;
     case GL_RGB32F: return NX_PIXEL_FORMAT_RGB32F;
     case GL_RGBA32F: return NX_PIXEL_FORMAT_RGBA32F;
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT: return NX_PIXEL_FORMAT_BC1;
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT: return NX_PIXEL_FORMAT_BC3;
+    case GL_COMPRESSED_RED_RGTC1: return NX_PIXEL_FORMAT_BC4;
+    case GL_COMPRESSED_RG_RGTC2: return NX_PIXEL_FORMAT_BC5;
+    case GL_COMPRESSED_RGBA_BPTC_UNORM: return NX_PIXEL_FORMAT_BC7;
     default: break;
     }
 
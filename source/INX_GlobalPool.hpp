@@ -17,9 +17,13 @@
 #include "./Detail/Util/ObjectPool.hpp"
 #include "./NX_InstanceBuffer.hpp"
 #include "./NX_RenderTexture.hpp"
+#include "./NX_SpriteAtlas.hpp"
+#include "./NX_TextLayout.hpp"
+#include "./NX_Path2D.hpp"
 #include "./NX_IndirectLight.hpp"
 #include "./NX_DynamicMesh.hpp"
 #include "./NX_AudioStream.hpp"
+#include "./NX_AsyncLoad.hpp"
 #include "./NX_AudioClip.hpp"
 #include "./NX_Shader3D.hpp"
 #include "./NX_Shader2D.hpp"
@@ -44,6 +48,9 @@ public:
     using InstanceBuffers   = util::ObjectPool<NX_InstanceBuffer, 32>;
     using IndirectLights    = util::ObjectPool<NX_IndirectLight, 128>;
     using RenderTextures    = util::ObjectPool<NX_RenderTexture, 16>;
+    using SpriteAtlases     = util::ObjectPool<NX_SpriteAtlas, 32>;
+    using TextLayouts       = util::ObjectPool<NX_TextLayout, 256>;
+    using Paths2D           = util::ObjectPool<NX_Path2D, 256>;
     using AnimationLibs     = util::ObjectPool<NX_AnimationLib, 256>;
     using DynamicMeshes     = util::ObjectPool<NX_DynamicMesh, 32>;
     using Skeletons         = util::ObjectPool<NX_Skeleton, 128>;
@@ -54,6 +61,9 @@ public:
     using Meshes            = util::ObjectPool<NX_Mesh, 512>;
     using Fonts             = util::ObjectPool<NX_Font, 32>;
 
+    /** Loading */
+    using AsyncLoads        = util::ObjectPool<NX_AsyncLoad, 64>;
+
     /** Shaders */
     using Shaders3D         = util::ObjectPool<NX_Shader3D, 32>;
     using Shaders2D         = util::ObjectPool<NX_Shader2D, 32>;
@@ -84,6 +94,9 @@ private:
     InstanceBuffers  mInstanceBuffers;
     IndirectLights   mIndirectLights;
     RenderTextures   mRenderTextures;
+    SpriteAtlases    mSpriteAtlases;
+    TextLayouts      mTextLayouts;
+    Paths2D          mPaths2D;
     AnimationLibs    mAnimationLibs;
     DynamicMeshes    mDynamicMeshes;
     Skeletons        mSkeletons;
@@ -94,6 +107,9 @@ private:
     Lights           mLights;
     Fonts            mFonts;
 
+    /** Loading */
+    AsyncLoads       mAsyncLoads;
+
     /** Shaders */
     Shaders3D        mShaders3D;
     Shaders2D        mShaders2D;
@@ -112,6 +128,9 @@ inline auto& INX_GlobalPool::Get()
     else if constexpr (std::is_same_v<T, NX_InstanceBuffer>)  return mInstanceBuffers;
     else if constexpr (std::is_same_v<T, NX_IndirectLight>)   return mIndirectLights;
     else if constexpr (std::is_same_v<T, NX_RenderTexture>)   return mRenderTextures;
+    else if constexpr (std::is_same_v<T, NX_SpriteAtlas>)     return mSpriteAtlases;
+    else if constexpr (std::is_same_v<T, NX_TextLayout>)      return mTextLayouts;
+    else if constexpr (std::is_same_v<T, NX_Path2D>)          return mPaths2D;
     else if constexpr (std::is_same_v<T, NX_AnimationLib>)    return mAnimationLibs;
     else if constexpr (std::is_same_v<T, NX_DynamicMesh>)     return mDynamicMeshes;
     else if constexpr (std::is_same_v<T, NX_Skeleton>)        return mSkeletons;
@@ -121,6 +140,7 @@ inline auto& INX_GlobalPool::Get()
     else if constexpr (std::is_same_v<T, NX_Mesh>)            return mMeshes;
     else if constexpr (std::is_same_v<T, NX_Light>)           return mLights;
     else if constexpr (std::is_same_v<T, NX_Font>)            return mFonts;
+    else if constexpr (std::is_same_v<T, NX_AsyncLoad>)       return mAsyncLoads;
     else if constexpr (std::is_same_v<T, NX_Shader3D>)        return mShaders3D;
     else if constexpr (std::is_same_v<T, NX_Shader2D>)        return mShaders2D;
     else static_assert(false, "Type not supported by INX_GlobalPool");
@@ -156,6 +176,8 @@ inline void INX_GlobalPool::UnloadAll()
         }
     };
 
+    // NOTE: Pending loads may still hold partially created resources
+    clear(mAsyncLoads,       "NX_AsyncLoad");
     clear(mShaders2D,        "NX_Shader2D");
     clear(mShaders3D,        "NX_Shader3D");
     clear(mLights,           "NX_Light");
@@ -169,6 +191,9 @@ inline void INX_GlobalPool::UnloadAll()
     clear(mVertexBuffers3D,  "NX_VertexBuffer3D");
     clear(mIndirectLights,   "NX_IndirectLight");
     clear(mRenderTextures,   "NX_RenderTexture");
+    clear(mSpriteAtlases,    "NX_SpriteAtlas");
+    clear(mTextLayouts,      "NX_TextLayout");
+    clear(mPaths2D,          "NX_Path2D");
     clear(mCubemaps,         "NX_Cubemap");
     clear(mFonts,            "NX_Font");
     clear(mTextures,         "NX_Texture");
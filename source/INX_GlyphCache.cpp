@@ -0,0 +1,399 @@
+/* INX_GlyphCache.cpp -- Internal on-demand glyph rasterization for dynamic fonts
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./INX_GlyphCache.hpp"
+
+#include <NX/NX_Log.h>
+
+#include "./Detail/Util/Ranges.hpp"
+#include "./NX_Texture.hpp"
+
+#include <algorithm>
+#include <climits>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+// ============================================================================
+// GLYPH RASTERIZATION
+// ============================================================================
+
+bool INX_RasterizeGlyph(FT_Face face, NX_FontType type, int baseSize, int codepoint, INX_Glyph* glyph)
+{
+    /* --- Select the render mode --- */
+
+    FT_Render_Mode ftRenderMode{};
+    FT_Int32 ftGlyphFlags = FT_LOAD_RENDER | FT_LOAD_NO_AUTOHINT;
+
+    switch (type) {
+    case NX_FONT_NORMAL:
+        ftRenderMode = FT_RENDER_MODE_NORMAL;
+        ftGlyphFlags |= FT_LOAD_TARGET_NORMAL;
+        break;
+    case NX_FONT_LIGHT:
+        ftRenderMode = FT_RENDER_MODE_LIGHT;
+        ftGlyphFlags |= FT_LOAD_TARGET_LIGHT;
+        break;
+    case NX_FONT_MONO:
+        ftRenderMode = FT_RENDER_MODE_MONO;
+        ftGlyphFlags |= FT_LOAD_TARGET_MONO;
+        break;
+    case NX_FONT_SDF:
+        ftRenderMode = FT_RENDER_MODE_SDF;
+        ftGlyphFlags |= FT_LOAD_TARGET_NORMAL;
+        break;
+    default:
+        return false;
+    }
+
+    glyph->value = codepoint;
+
+    /* --- Get the glyph index and load it --- */
+
+    FT_UInt glyphIndex = FT_Get_Char_Index(face, codepoint);
+    if (glyphIndex == 0) {
+        return false;
+    }
+    if (FT_Load_Glyph(face, glyphIndex, ftGlyphFlags) != 0) {
+        return false;
+    }
+
+    /* --- Space character --- */
+
+    if (codepoint == 32) {
+        glyph->xAdvance = (int)(face->glyph->advance.x >> 6);
+        glyph->xOffset = glyph->yOffset = 0;
+        glyph->wGlyph = glyph->xAdvance;
+        glyph->hGlyph = baseSize;
+        return true;
+    }
+
+    /* --- Regular character --- */
+
+    if (FT_Render_Glyph(face->glyph, ftRenderMode) != 0) {
+        return false;
+    }
+
+    // Get glyph and bitmap references
+    const FT_GlyphSlot ftGlyph = face->glyph;
+    const FT_Bitmap& ftBitmap = ftGlyph->bitmap;
+
+    // Calculating the number of pixels in the bitmap
+    int pixelCount = ftBitmap.width * ftBitmap.rows;
+
+    // NOTE: Empty bitmaps (NBSP, ideographic space, zero-width marks) are
+    //       valid glyphs, like spaces they only keep their advance
+    if (pixelCount == 0) {
+        glyph->xAdvance = (int)(ftGlyph->advance.x >> 6);
+        glyph->xOffset = glyph->yOffset = 0;
+        glyph->wGlyph = glyph->hGlyph = 0;
+        return true;
+    }
+
+    // Allocation to keep the bitmap in our glyph cache
+    glyph->pixels = util::MakeUniqueArray<uint8_t>(pixelCount);
+    if (glyph->pixels == nullptr) {
+        return false;
+    }
+
+    // Copying the rasterized bitmap to our glyph cache
+    if (type != NX_FONT_MONO) {
+        SDL_memcpy(glyph->pixels.get(), ftBitmap.buffer, pixelCount);
+    }
+    else {
+        const FT_Bitmap &bm = ftBitmap;
+        for (unsigned int y = 0; y < bm.rows; ++y) {
+            for (unsigned int x = 0; x < bm.width; ++x) {
+                int byteIndex = y * bm.pitch + (x >> 3);
+                int bitIndex = 7 - (x & 7);
+                bool pixelOn = (bm.buffer[byteIndex] >> bitIndex) & 1;
+                glyph->pixels.get()[y * bm.width + x] = pixelOn ? 255 : 0;
+            }
+        }
+    }
+
+    // Get horizontal advance
+    glyph->xAdvance = (int)(ftGlyph->advance.x >> 6);
+
+    // Calculate the offset needed to draw the glyph
+    int ascent = face->size->metrics.ascender >> 6;
+    glyph->xOffset = ftGlyph->bitmap_left;
+    glyph->yOffset = ascent - ftGlyph->bitmap_top;
+
+    // Keeps the pixel dimensions of the glyph
+    glyph->wGlyph = ftBitmap.width;
+    glyph->hGlyph = ftBitmap.rows;
+
+    return true;
+}
+
+// ============================================================================
+// PUBLIC IMPLEMENTATION
+// ============================================================================
+
+INX_GlyphCache::~INX_GlyphCache()
+{
+    for (Page& page : mPages) {
+        NX_DestroyTexture(page.texture);
+    }
+
+    mSlots.Clear();
+
+    if (mFace != nullptr) FT_Done_Face(mFace);
+    if (mLibrary != nullptr) FT_Done_FreeType(mLibrary);
+}
+
+bool INX_GlyphCache::Init(const void* fileData, size_t dataSize, NX_FontType type, int baseSize, int padding)
+{
+    mType = type;
+    mBaseSize = baseSize;
+    mPadding = padding;
+
+    /* --- Keep a copy of the font data for the face --- */
+
+    mFileData = util::MakeUniqueArray<uint8_t>(dataSize);
+    if (mFileData == nullptr) {
+        return false;
+    }
+    SDL_memcpy(mFileData.get(), fileData, dataSize);
+
+    /* --- Load the face --- */
+
+    if (FT_Init_FreeType(&mLibrary) != 0) {
+        mLibrary = nullptr;
+        return false;
+    }
+
+    if (FT_New_Memory_Face(mLibrary, mFileData.get(), dataSize, 0, &mFace) != 0) {
+        mFace = nullptr;
+        return false;
+    }
+
+    if (FT_Set_Pixel_Sizes(mFace, 0, baseSize) != 0) {
+        return false;
+    }
+
+    /* --- The first page always exists, empty glyphs refer to it --- */
+
+    return AddPage();
+}
+
+const INX_Glyph& INX_GlyphCache::GetGlyph(int codepoint)
+{
+    constexpr int fallback = 63; //< Fallback is '?'
+
+    /* --- Cached glyph --- */
+
+    auto it = mSlotMap.find(codepoint);
+    if (it != mSlotMap.end()) {
+        Slot* slot = it->second;
+        slot->lastUse = mEpoch;
+        return slot->glyph;
+    }
+
+    if (mMissing.contains(codepoint)) {
+        return (codepoint != fallback) ? GetGlyph(fallback) : mEmptyGlyph;
+    }
+
+    /* --- Rasterize the glyph --- */
+
+    INX_Glyph glyph{};
+
+    if (!INX_RasterizeGlyph(mFace, mType, mBaseSize, codepoint, &glyph)) {
+        mMissing.insert(codepoint);
+        return (codepoint != fallback) ? GetGlyph(fallback) : mEmptyGlyph;
+    }
+
+    /* --- Store its pixels in a page --- */
+
+    INX_RectPacker::Rect rect{};
+
+    if (glyph.pixels != nullptr) {
+        int page = Allocate(glyph.wGlyph + 2 * mPadding, glyph.hGlyph + 2 * mPadding, &rect);
+        if (page < 0) {
+            NX_LOG(E, "RENDER: Failed to cache glyph %i of %ix%i pixels", codepoint, glyph.wGlyph, glyph.hGlyph);
+            return mEmptyGlyph;
+        }
+        glyph.xAtlas = rect.x + mPadding;
+        glyph.yAtlas = rect.y + mPadding;
+        glyph.page = page;
+        WritePixels(page, rect, glyph);
+        glyph.pixels.reset();
+    }
+    else {
+        // NOTE: Glyphs without pixels, such as spaces, only keep their advance
+        glyph.wGlyph = glyph.hGlyph = 0;
+    }
+
+    /* --- Register the slot --- */
+
+    Slot* slot = mSlots.Create();
+    if (slot == nullptr) {
+        NX_LOG(E, "RENDER: Failed to register glyph %i in the cache", codepoint);
+        if (rect.w > 0) mPages[glyph.page].packer.Free(rect);
+        return mEmptyGlyph;
+    }
+
+    slot->glyph = std::move(glyph);
+    slot->rect = rect;
+    slot->lastUse = mEpoch;
+
+    mSlotMap[codepoint] = slot;
+
+    return slot->glyph;
+}
+
+void INX_GlyphCache::Commit()
+{
+    for (Page& page : mPages)
+    {
+        if (page.dirtyMaxX <= page.dirtyMinX || page.dirtyMaxY <= page.dirtyMinY) {
+            continue;
+        }
+
+        // NOTE: The region is widened to multiples of four pixels so that
+        //       its rows match the default unpack alignment of R8 uploads
+        const int x0 = page.dirtyMinX & ~3;
+        const int x1 = std::min((page.dirtyMaxX + 3) & ~3, PageSize);
+        const int y0 = page.dirtyMinY;
+        const int w = x1 - x0;
+        const int h = page.dirtyMaxY - y0;
+
+        if (!mUploadScratch.Resize(static_cast<size_t>(w) * h)) {
+            NX_LOG(E, "RENDER: Failed to upload glyph cache page; Out of memory");
+            continue;
+        }
+
+        for (int y = 0; y < h; y++) {
+            SDL_memcpy(&mUploadScratch[y * w], page.pixels.get() + (y0 + y) * PageSize + x0, w);
+        }
+
+        page.texture->gpu.Upload(mUploadScratch.GetData(), gpu::UploadRegion {
+            .x = x0, .y = y0,
+            .width = w, .height = h
+        });
+
+        page.dirtyMinX = page.dirtyMinY = PageSize;
+        page.dirtyMaxX = page.dirtyMaxY = 0;
+    }
+
+    mEpoch++;
+}
+
+// ============================================================================
+// PRIVATE IMPLEMENTATION
+// ============================================================================
+
+int INX_GlyphCache::Allocate(int w, int h, INX_RectPacker::Rect* rect)
+{
+    if (w > PageSize || h > PageSize) {
+        return -1;
+    }
+
+    while (true)
+    {
+        for (size_t i = 0; i < mPages.GetSize(); i++) {
+            if (mPages[i].packer.Insert(w, h, rect)) {
+                return static_cast<int>(i);
+            }
+        }
+
+        if (static_cast<int>(mPages.GetSize()) < MaxPages || !EvictLeastRecent()) {
+            if (!AddPage()) {
+                return -1;
+            }
+        }
+    }
+}
+
+bool INX_GlyphCache::AddPage()
+{
+    NX_TextureFilter filter = (mType == NX_FONT_MONO) ? NX_TEXTURE_FILTER_POINT : NX_TEXTURE_FILTER_BILINEAR;
+
+    NX_Texture* texture = NX_CreateTextureEx(
+        PageSize, PageSize, nullptr,
+        NX_PIXEL_FORMAT_R8, NX_TEXTURE_WRAP_CLAMP, filter
+    );
+
+    if (texture == nullptr) {
+        NX_LOG(E, "RENDER: Failed to create glyph cache page");
+        return false;
+    }
+
+    Page* page = mPages.EmplaceBack();
+    if (page == nullptr) {
+        NX_LOG(E, "RENDER: Failed to register glyph cache page");
+        NX_DestroyTexture(texture);
+        return false;
+    }
+
+    page->texture = texture;
+    page->pixels = util::MakeUniqueArray<uint8_t>(PageSize * PageSize);
+    page->packer.Reset(PageSize, PageSize);
+    page->dirtyMinX = page->dirtyMinY = PageSize;
+    page->dirtyMaxX = page->dirtyMaxY = 0;
+
+    if (mPages.GetSize() > MaxPages) {
+        NX_LOG(W, "RENDER: Glyph cache exceeds %i pages, too many glyphs are drawn in a single batch", MaxPages);
+    }
+
+    return true;
+}
+
+bool INX_GlyphCache::EvictLeastRecent()
+{
+    /* --- Find the least recently used glyph not drawn by the pending batch --- */
+
+    Slot* oldest = nullptr;
+    uint64_t oldestUse = UINT64_MAX;
+
+    for (Slot& slot : mSlots) {
+        if (slot.rect.w > 0 && slot.lastUse < mEpoch && slot.lastUse < oldestUse) {
+            oldestUse = slot.lastUse;
+            oldest = &slot;
+        }
+    }
+
+    if (oldest == nullptr) {
+        return false;
+    }
+
+    /* --- Give back its area --- */
+
+    mPages[oldest->glyph.page].packer.Free(oldest->rect);
+    mSlotMap.erase(oldest->glyph.value);
+    mSlots.Destroy(oldest);
+
+    return true;
+}
+
+void INX_GlyphCache::WritePixels(int page, const INX_RectPacker::Rect& rect, const INX_Glyph& glyph)
+{
+    Page& target = mPages[page];
+    uint8_t* pixels = target.pixels.get();
+
+    /* --- Clear the whole area, it may hold an evicted glyph --- */
+
+    for (int y = rect.y; y < rect.y + rect.h; y++) {
+        SDL_memset(pixels + y * PageSize + rect.x, 0, rect.w);
+    }
+
+    /* --- Copy the glyph inside the padding --- */
+
+    const uint8_t* src = glyph.pixels.get();
+    for (int y = 0; y < glyph.hGlyph; y++) {
+        SDL_memcpy(pixels + (glyph.yAtlas + y) * PageSize + glyph.xAtlas, src + y * glyph.wGlyph, glyph.wGlyph);
+    }
+
+    /* --- Extend the dirty region --- */
+
+    target.dirtyMinX = std::min(target.dirtyMinX, rect.x);
+    target.dirtyMinY = std::min(target.dirtyMinY, rect.y);
+    target.dirtyMaxX = std::max(target.dirtyMaxX, rect.x + rect.w);
+    target.dirtyMaxY = std::max(target.dirtyMaxY, rect.y + rect.h);
+}
@@ -0,0 +1,121 @@
+/* INX_GlyphCache.hpp -- Internal on-demand glyph rasterization for dynamic fonts
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef INX_GLYPH_CACHE_HPP
+#define INX_GLYPH_CACHE_HPP
+
+#include <NX/NX_Texture.h>
+#include <NX/NX_Font.h>
+
+#include "./Detail/Util/DynamicArray.hpp"
+#include "./Detail/Util/ObjectPool.hpp"
+#include "./Detail/Util/Memory.hpp"
+#include "./INX_RectPacker.hpp"
+#include "./NX_Font.hpp"
+
+#include <unordered_map>
+#include <unordered_set>
+
+// ============================================================================
+// FREETYPE FORWARD DECLARATIONS
+// ============================================================================
+
+typedef struct FT_LibraryRec_* FT_Library;
+typedef struct FT_FaceRec_* FT_Face;
+
+// ============================================================================
+// GLYPH RASTERIZATION
+// ============================================================================
+
+/**
+ * Renders a glyph with a face already sized to the base size of the font.
+ * Fills the metrics and the R8 pixels of the glyph, pixels are left null for
+ * glyphs without a bitmap such as spaces. Returns false if the face has no
+ * glyph for this codepoint or if rendering fails.
+ */
+bool INX_RasterizeGlyph(FT_Face face, NX_FontType type, int baseSize, int codepoint, INX_Glyph* glyph);
+
+// ============================================================================
+// GLYPH CACHE
+// ============================================================================
+
+/**
+ * Keeps a FreeType face alive and rasterizes glyphs on first use into R8
+ * atlas pages. Pages are added up to a limit, then the least recently used
+ * glyphs are evicted to make room. Rasterized glyphs are written to a CPU copy
+ * of their page and only the modified region is uploaded by Commit().
+ *
+ * Glyphs used since the last Commit() are never evicted, the batch that
+ * references them has not been drawn yet.
+ */
+class INX_GlyphCache {
+public:
+    static constexpr int PageSize = 1024;
+    static constexpr int MaxPages = 4;          //< Soft limit, exceeded only when every glyph is in use
+
+public:
+    INX_GlyphCache() = default;
+    ~INX_GlyphCache();
+
+    INX_GlyphCache(const INX_GlyphCache&) = delete;
+    INX_GlyphCache& operator=(const INX_GlyphCache&) = delete;
+
+    /** Loads the face from a copy of the font data */
+    bool Init(const void* fileData, size_t dataSize, NX_FontType type, int baseSize, int padding);
+
+    /** Returns the glyph of a codepoint, rasterizing it if needed, valid until the next Commit() */
+    const INX_Glyph& GetGlyph(int codepoint);
+
+    /** Uploads the modified regions of the pages, to call before drawing the batch */
+    void Commit();
+
+    /** Page access */
+    int GetPageCount() const { return static_cast<int>(mPages.GetSize()); }
+    NX_Texture* GetPageTexture(int page) const { return mPages[page].texture; }
+
+private:
+    struct Page {
+        NX_Texture* texture{};
+        util::UniquePtr<uint8_t> pixels{};      //< CPU copy of the page
+        INX_RectPacker packer{};
+        int dirtyMinX{}, dirtyMinY{};
+        int dirtyMaxX{}, dirtyMaxY{};            //< Empty when max <= min
+    };
+
+    struct Slot {
+        INX_Glyph glyph{};
+        INX_RectPacker::Rect rect{};             //< Allocated rectangle, padding included
+        uint64_t lastUse{};
+    };
+
+private:
+    int Allocate(int w, int h, INX_RectPacker::Rect* rect);
+    bool AddPage();
+    bool EvictLeastRecent();
+    void WritePixels(int page, const INX_RectPacker::Rect& rect, const INX_Glyph& glyph);
+
+private:
+    FT_Library mLibrary{};
+    FT_Face mFace{};
+    util::UniquePtr<uint8_t> mFileData{};       //< FreeType reads the face from this memory
+
+    util::DynamicArray<Page> mPages{};
+    util::ObjectPool<Slot, 256> mSlots{};       //< Pool so that returned glyphs survive new slots
+    std::unordered_map<int, Slot*> mSlotMap{};   //< Codepoint to slot
+    std::unordered_set<int> mMissing{};          //< Codepoints absent from the face
+
+    util::DynamicArray<uint8_t> mUploadScratch{};
+    INX_Glyph mEmptyGlyph{};
+
+    NX_FontType mType{};
+    int mBaseSize{};
+    int mPadding{};
+    uint64_t mEpoch{1};                         //< Incremented by each Commit()
+};
+
+#endif // INX_GLYPH_CACHE_HPP
@@ -0,0 +1,376 @@
+/* INX_ImageContainer.cpp -- Internal loading of DDS and KTX2 texture containers
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./INX_ImageContainer.hpp"
+#include "./INX_ImageMipmaps.hpp"
+
+#include "./Detail/Util/Ranges.hpp"
+
+#include <NX/NX_Log.h>
+
+#include <SDL3/SDL_stdinc.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+// ============================================================================
+// LOCAL CONSTANTS
+// ============================================================================
+
+static constexpr uint8_t INX_DDS_MAGIC[4] = { 'D', 'D', 'S', ' ' };
+
+static constexpr uint8_t INX_KTX2_MAGIC[12] = {
+    0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'
+};
+
+static constexpr size_t INX_DDS_HEADER_SIZE = 4 + 124;   //< Magic and DDS_HEADER
+static constexpr size_t INX_DDS_DX10_SIZE = 20;          //< DDS_HEADER_DXT10
+static constexpr size_t INX_KTX2_HEADER_SIZE = 80;       //< Identifier, header and index
+static constexpr size_t INX_KTX2_LEVEL_SIZE = 24;        //< Level index entry
+
+// ============================================================================
+// LOCAL FUNCTIONS
+// ============================================================================
+
+template <typename T>
+static T INX_Read(const uint8_t* data, size_t offset)
+{
+    T value;
+    std::memcpy(&value, data + offset, sizeof(T));
+    return value;
+}
+
+static constexpr uint32_t INX_FourCC(const char (&code)[5])
+{
+    return uint32_t(uint8_t(code[0])) | (uint32_t(uint8_t(code[1])) << 8) |
+          (uint32_t(uint8_t(code[2])) << 16) | (uint32_t(uint8_t(code[3])) << 24);
+}
+
+static void INX_DestroyLevels(util::DynamicArray<NX_Image>* levels)
+{
+    for (NX_Image& level : *levels) {
+        NX_DestroyImage(&level);
+    }
+    levels->Clear();
+}
+
+/** Copies 'count' levels stored contiguously from 'offset', swapping red and blue if requested */
+static bool INX_CopyLevels(const uint8_t* data, size_t size, size_t offset, int w, int h, int count,
+                           NX_PixelFormat format, bool swapRB, util::DynamicArray<NX_Image>* levels)
+{
+    // NOTE: Levels past the full chain would all be 1x1 and shift by 32 or more is undefined
+    count = std::min(count, INX_GetMipLevelCount(w, h));
+
+    for (int i = 0; i < count; i++)
+    {
+        const int lw = std::max(w >> i, 1);
+        const int lh = std::max(h >> i, 1);
+        const size_t levelSize = NX_GetImageDataSize(lw, lh, format);
+
+        if (offset + levelSize > size) {
+            // NOTE: Truncated mip chains are accepted as long as the first level is complete
+            if (i > 0) break;
+            return false;
+        }
+
+        void* pixels = SDL_malloc(levelSize);
+        if (pixels == nullptr) {
+            INX_DestroyLevels(levels);
+            return false;
+        }
+
+        SDL_memcpy(pixels, data + offset, levelSize);
+        offset += levelSize;
+
+        if (swapRB) {
+            uint8_t* px = static_cast<uint8_t*>(pixels);
+            for (size_t j = 0; j < levelSize; j += 4) {
+                std::swap(px[j], px[j + 2]);
+            }
+        }
+
+        levels->PushBack(NX_Image{ pixels, lw, lh, format });
+    }
+
+    return true;
+}
+
+/* --- Level count --- */
+
+/** Clamps the level count declared by a file to the full mip chain of its base level */
+static int INX_ClampLevelCount(uint32_t declared, int w, int h, const char* container)
+{
+    const int maxCount = INX_GetMipLevelCount(w, h);
+    if (declared > static_cast<uint32_t>(maxCount)) {
+        NX_LOG(W, "IMAGE: %s file declares %u mip levels, only %i exist for %ix%i; Extra levels ignored",
+               container, declared, maxCount, w, h);
+        return maxCount;
+    }
+    return std::max(static_cast<int>(declared), 1);
+}
+
+/* --- DDS --- */
+
+// NOTE: sRGB variants map to the same pixel formats as their UNORM counterparts, the
+//       engine samples 8-bit color data without hardware sRGB decoding, as it does for
+//       PNG or JPG images, so the texels are used exactly as they would be from those
+
+static NX_PixelFormat INX_GetDXGIFormat(uint32_t dxgi, bool* swapRB, bool* srgb)
+{
+    switch (dxgi) {
+    case 2:  return NX_PIXEL_FORMAT_RGBA32F;                        // R32G32B32A32_FLOAT
+    case 10: return NX_PIXEL_FORMAT_RGBA16F;                        // R16G16B16A16_FLOAT
+    case 28: return NX_PIXEL_FORMAT_RGBA8;                          // R8G8B8A8_UNORM
+    case 29: *srgb = true; return NX_PIXEL_FORMAT_RGBA8;            // R8G8B8A8_UNORM_SRGB
+    case 87: *swapRB = true; return NX_PIXEL_FORMAT_RGBA8;          // B8G8R8A8_UNORM
+    case 91: *swapRB = *srgb = true; return NX_PIXEL_FORMAT_RGBA8;  // B8G8R8A8_UNORM_SRGB
+    case 71: return NX_PIXEL_FORMAT_BC1;                            // BC1_UNORM
+    case 72: *srgb = true; return NX_PIXEL_FORMAT_BC1;              // BC1_UNORM_SRGB
+    case 77: return NX_PIXEL_FORMAT_BC3;                            // BC3_UNORM
+    case 78: *srgb = true; return NX_PIXEL_FORMAT_BC3;              // BC3_UNORM_SRGB
+    case 80: return NX_PIXEL_FORMAT_BC4;                            // BC4_UNORM
+    case 83: return NX_PIXEL_FORMAT_BC5;                            // BC5_UNORM
+    case 98: return NX_PIXEL_FORMAT_BC7;                            // BC7_UNORM
+    case 99: *srgb = true; return NX_PIXEL_FORMAT_BC7;              // BC7_UNORM_SRGB
+    default: break;
+    }
+    return NX_PIXEL_FORMAT_INVALID;
+}
+
+static bool INX_LoadDDS(const uint8_t* data, size_t size, util::DynamicArray<NX_Image>* levels)
+{
+    constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+    constexpr uint32_t DDPF_FOURCC = 0x4;
+    constexpr uint32_t DDPF_RGB = 0x40;
+    constexpr uint32_t DDSCAPS2_CUBEMAP = 0x200;
+    constexpr uint32_t DDSCAPS2_VOLUME = 0x200000;
+
+    if (size < INX_DDS_HEADER_SIZE) {
+        NX_LOG(E, "IMAGE: Invalid DDS file; Truncated header");
+        return false;
+    }
+
+    const uint32_t flags = INX_Read<uint32_t>(data, 8);
+    const int h = static_cast<int>(INX_Read<uint32_t>(data, 12));
+    const int w = static_cast<int>(INX_Read<uint32_t>(data, 16));
+    const uint32_t mipCount = INX_Read<uint32_t>(data, 28);
+    const uint32_t pfFlags = INX_Read<uint32_t>(data, 80);
+    const uint32_t fourCC = INX_Read<uint32_t>(data, 84);
+    const uint32_t bitCount = INX_Read<uint32_t>(data, 88);
+    const uint32_t rMask = INX_Read<uint32_t>(data, 92);
+    const uint32_t aMask = INX_Read<uint32_t>(data, 104);
+    const uint32_t caps2 = INX_Read<uint32_t>(data, 112);
+
+    if (w <= 0 || h <= 0) {
+        NX_LOG(E, "IMAGE: Invalid DDS file; Invalid dimensions");
+        return false;
+    }
+
+    if (caps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME)) {
+        NX_LOG(E, "IMAGE: Unsupported DDS file; Cubemaps and volumes are not supported");
+        return false;
+    }
+
+    /* --- Resolve the pixel format --- */
+
+    NX_PixelFormat format = NX_PIXEL_FORMAT_INVALID;
+    size_t offset = INX_DDS_HEADER_SIZE;
+    bool swapRB = false;
+    bool srgb = false;
+
+    if ((pfFlags & DDPF_FOURCC) && fourCC == INX_FourCC("DX10")) {
+        if (size < INX_DDS_HEADER_SIZE + INX_DDS_DX10_SIZE) {
+            NX_LOG(E, "IMAGE: Invalid DDS file; Truncated DX10 header");
+            return false;
+        }
+        const uint32_t dxgi = INX_Read<uint32_t>(data, offset);
+        const uint32_t dimension = INX_Read<uint32_t>(data, offset + 4);
+        const uint32_t arraySize = INX_Read<uint32_t>(data, offset + 12);
+        if (dimension != 3 || arraySize > 1) {
+            NX_LOG(E, "IMAGE: Unsupported DDS file; Only single 2D textures are supported");
+            return false;
+        }
+        format = INX_GetDXGIFormat(dxgi, &swapRB, &srgb);
+        offset += INX_DDS_DX10_SIZE;
+        if (srgb) {
+            NX_LOG(V, "IMAGE: DDS sRGB format (DXGI %u) loaded as its UNORM equivalent", dxgi);
+        }
+    }
+    else if (pfFlags & DDPF_FOURCC) {
+        switch (fourCC) {
+        case INX_FourCC("DXT1"): format = NX_PIXEL_FORMAT_BC1; break;
+        case INX_FourCC("DXT5"): format = NX_PIXEL_FORMAT_BC3; break;
+        case INX_FourCC("ATI1"):
+        case INX_FourCC("BC4U"): format = NX_PIXEL_FORMAT_BC4; break;
+        case INX_FourCC("ATI2"):
+        case INX_FourCC("BC5U"): format = NX_PIXEL_FORMAT_BC5; break;
+        case 113: format = NX_PIXEL_FORMAT_RGBA16F; break;  // D3DFMT_A16B16G16R16F
+        case 116: format = NX_PIXEL_FORMAT_RGBA32F; break;  // D3DFMT_A32B32G32R32F
+        default: break;
+        }
+    }
+    else if ((pfFlags & DDPF_RGB) && bitCount == 32 && aMask == 0xFF000000) {
+        if (rMask == 0x000000FF) format = NX_PIXEL_FORMAT_RGBA8;
+        else if (rMask == 0x00FF0000) format = NX_PIXEL_FORMAT_RGBA8, swapRB = true;
+    }
+
+    if (format == NX_PIXEL_FORMAT_INVALID) {
+        NX_LOG(E, "IMAGE: Unsupported DDS pixel format");
+        return false;
+    }
+
+    /* --- Copy the levels --- */
+
+    const int levelCount = (flags & DDSD_MIPMAPCOUNT) ? INX_ClampLevelCount(mipCount, w, h, "DDS") : 1;
+
+    if (!INX_CopyLevels(data, size, offset, w, h, levelCount, format, swapRB, levels)) {
+        NX_LOG(E, "IMAGE: Invalid DDS file; Truncated pixel data");
+        return false;
+    }
+
+    return true;
+}
+
+/* --- KTX2 --- */
+
+static NX_PixelFormat INX_GetVkFormat(uint32_t vkFormat, bool* srgb)
+{
+    switch (vkFormat) {
+    case 9:  return NX_PIXEL_FORMAT_R8;                             // R8_UNORM
+    case 16: return NX_PIXEL_FORMAT_RG8;                            // R8G8_UNORM
+    case 23: return NX_PIXEL_FORMAT_RGB8;                           // R8G8B8_UNORM
+    case 29: *srgb = true; return NX_PIXEL_FORMAT_RGB8;             // R8G8B8_SRGB
+    case 37: return NX_PIXEL_FORMAT_RGBA8;                          // R8G8B8A8_UNORM
+    case 43: *srgb = true; return NX_PIXEL_FORMAT_RGBA8;            // R8G8B8A8_SRGB
+    case 97: return NX_PIXEL_FORMAT_RGBA16F;                        // R16G16B16A16_SFLOAT
+    case 109: return NX_PIXEL_FORMAT_RGBA32F;                       // R32G32B32A32_SFLOAT
+    case 131:                                                       // BC1_RGB_UNORM_BLOCK
+    case 133: return NX_PIXEL_FORMAT_BC1;                           // BC1_RGBA_UNORM_BLOCK
+    case 132:                                                       // BC1_RGB_SRGB_BLOCK
+    case 134: *srgb = true; return NX_PIXEL_FORMAT_BC1;             // BC1_RGBA_SRGB_BLOCK
+    case 137: return NX_PIXEL_FORMAT_BC3;                           // BC3_UNORM_BLOCK
+    case 138: *srgb = true; return NX_PIXEL_FORMAT_BC3;             // BC3_SRGB_BLOCK
+    case 139: return NX_PIXEL_FORMAT_BC4;                           // BC4_UNORM_BLOCK
+    case 141: return NX_PIXEL_FORMAT_BC5;                           // BC5_UNORM_BLOCK
+    case 145: return NX_PIXEL_FORMAT_BC7;                           // BC7_UNORM_BLOCK
+    case 146: *srgb = true; return NX_PIXEL_FORMAT_BC7;             // BC7_SRGB_BLOCK
+    default: break;
+    }
+    return NX_PIXEL_FORMAT_INVALID;
+}
+
+static bool INX_LoadKTX2(const uint8_t* data, size_t size, util::DynamicArray<NX_Image>* levels)
+{
+    if (size < INX_KTX2_HEADER_SIZE) {
+        NX_LOG(E, "IMAGE: Invalid KTX2 file; Truncated header");
+        return false;
+    }
+
+    const uint32_t vkFormat = INX_Read<uint32_t>(data, 12);
+    const int w = static_cast<int>(INX_Read<uint32_t>(data, 20));
+    const int h = static_cast<int>(INX_Read<uint32_t>(data, 24));
+    const uint32_t depth = INX_Read<uint32_t>(data, 28);
+    const uint32_t layerCount = INX_Read<uint32_t>(data, 32);
+    const uint32_t faceCount = INX_Read<uint32_t>(data, 36);
+    const uint32_t fileLevelCount = std::max<uint32_t>(INX_Read<uint32_t>(data, 40), 1);
+    const uint32_t supercompression = INX_Read<uint32_t>(data, 44);
+
+    if (w <= 0 || h <= 0) {
+        NX_LOG(E, "IMAGE: Invalid KTX2 file; Invalid dimensions");
+        return false;
+    }
+
+    if (depth > 1 || layerCount > 1 || faceCount != 1) {
+        NX_LOG(E, "IMAGE: Unsupported KTX2 file; Only single 2D textures are supported");
+        return false;
+    }
+
+    if (supercompression != 0) {
+        NX_LOG(E, "IMAGE: Unsupported KTX2 file; Supercompression scheme %u is not supported", supercompression);
+        return false;
+    }
+
+    bool srgb = false;
+    const NX_PixelFormat format = INX_GetVkFormat(vkFormat, &srgb);
+    if (format == NX_PIXEL_FORMAT_INVALID) {
+        NX_LOG(E, "IMAGE: Unsupported KTX2 pixel format (VkFormat %u)", vkFormat);
+        return false;
+    }
+    if (srgb) {
+        NX_LOG(V, "IMAGE: KTX2 sRGB format (VkFormat %u) loaded as its UNORM equivalent", vkFormat);
+    }
+
+    if (size < INX_KTX2_HEADER_SIZE + static_cast<uint64_t>(fileLevelCount) * INX_KTX2_LEVEL_SIZE) {
+        NX_LOG(E, "IMAGE: Invalid KTX2 file; Truncated level index");
+        return false;
+    }
+
+    /* --- Copy the levels, the index lists them largest first --- */
+
+    const uint32_t levelCount = INX_ClampLevelCount(fileLevelCount, w, h, "KTX2");
+
+    for (uint32_t i = 0; i < levelCount; i++)
+    {
+        const size_t entry = INX_KTX2_HEADER_SIZE + i * INX_KTX2_LEVEL_SIZE;
+        const uint64_t byteOffset = INX_Read<uint64_t>(data, entry);
+        const uint64_t byteLength = INX_Read<uint64_t>(data, entry + 8);
+
+        const int lw = std::max(w >> i, 1);
+        const int lh = std::max(h >> i, 1);
+
+        if (byteOffset > size || byteLength > size - byteOffset ||
+            byteLength < NX_GetImageDataSize(lw, lh, format)) {
+            NX_LOG(E, "IMAGE: Invalid KTX2 file; Level %u is out of bounds", i);
+            INX_DestroyLevels(levels);
+            return false;
+        }
+
+        if (!INX_CopyLevels(data, size, byteOffset, lw, lh, 1, format, false, levels)) {
+            INX_DestroyLevels(levels);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+bool INX_IsImageContainer(const void* data, size_t size)
+{
+    if (data == nullptr) {
+        return false;
+    }
+
+    return (size >= sizeof(INX_DDS_MAGIC) && std::memcmp(data, INX_DDS_MAGIC, sizeof(INX_DDS_MAGIC)) == 0)
+        || (size >= sizeof(INX_KTX2_MAGIC) && std::memcmp(data, INX_KTX2_MAGIC, sizeof(INX_KTX2_MAGIC)) == 0);
+}
+
+bool INX_LoadImageContainer(const void* data, size_t size, util::DynamicArray<NX_Image>* levels)
+{
+    levels->Clear();
+
+    if (!INX_IsImageContainer(data, size)) {
+        return false;
+    }
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    bool success = (bytes[0] == 'D')
+        ? INX_LoadDDS(bytes, size, levels)
+        : INX_LoadKTX2(bytes, size, levels);
+
+    if (!success) {
+        INX_DestroyLevels(levels);
+    }
+
+    return success;
+}
@@ -0,0 +1,31 @@
+/* INX_ImageContainer.hpp -- Internal loading of DDS and KTX2 texture containers
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef INX_IMAGE_CONTAINER_HPP
+#define INX_IMAGE_CONTAINER_HPP
+
+#include <NX/NX_Image.h>
+
+#include "./Detail/Util/DynamicArray.hpp"
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+/** Returns true if the data starts with a DDS or KTX2 signature */
+bool INX_IsImageContainer(const void* data, size_t size);
+
+/**
+ * Parses a DDS or KTX2 container into one image per mip level, largest first.
+ * Only single 2D images are supported (no arrays, cubemaps or volumes), and KTX2
+ * files must not be supercompressed. On failure, false is returned and no level
+ * is left allocated. Each level owns its pixels and is freed with NX_DestroyImage.
+ */
+bool INX_LoadImageContainer(const void* data, size_t size, util::DynamicArray<NX_Image>* levels);
+
+#endif // INX_IMAGE_CONTAINER_HPP
@@ -0,0 +1,383 @@
+/* INX_ImageMipmaps.cpp -- Internal CPU generation of image mip chains
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./INX_ImageMipmaps.hpp"
+#include "./INX_JobSystem.hpp"
+
+#include <NX/NX_Math.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cmath>
+
+// ============================================================================
+// LOCAL FUNCTIONS
+// ============================================================================
+
+/** Normalized sinc, sin(pi x) / (pi x) */
+static float INX_Sinc(float x)
+{
+    if (std::abs(x) < 1e-5f) return 1.0f;
+    x *= NX_PI;
+    return std::sin(x) / x;
+}
+
+/** Modified Bessel function of the first kind and order zero, from its power series */
+static float INX_BesselI0(float x)
+{
+    const float halfX2 = 0.25f * x * x;
+    float sum = 1.0f, term = 1.0f;
+
+    for (int k = 1; k < 32 && term > 1e-7f * sum; k++) {
+        term *= halfX2 / static_cast<float>(k * k);
+        sum += term;
+    }
+
+    return sum;
+}
+
+/** Support radius of a filter, in destination texels */
+static float INX_GetKernelRadius(NX_MipmapFilter filter)
+{
+    switch (filter) {
+    case NX_MIPMAP_FILTER_BOX: return 0.5f;
+    case NX_MIPMAP_FILTER_KAISER: return 3.0f;
+    case NX_MIPMAP_FILTER_LANCZOS: return 3.0f;
+    default: break;
+    }
+    return 0.5f;
+}
+
+/** Evaluates a filter at 'x' destination texels from the center */
+static float INX_EvalKernel(NX_MipmapFilter filter, float x)
+{
+    x = std::abs(x);
+
+    switch (filter) {
+    case NX_MIPMAP_FILTER_KAISER:
+        {
+            // NOTE: Width 3 and alpha 4, a good tradeoff between sharpness and ringing
+            constexpr float width = 3.0f, alpha = 4.0f;
+            if (x >= width) return 0.0f;
+            const float t = x / width;
+            return INX_Sinc(x) * INX_BesselI0(alpha * std::sqrt(1.0f - t * t)) / INX_BesselI0(alpha);
+        }
+    case NX_MIPMAP_FILTER_LANCZOS:
+        return (x < 3.0f) ? INX_Sinc(x) * INX_Sinc(x / 3.0f) : 0.0f;
+    default:
+        break;
+    }
+
+    return (x <= 0.5f) ? 1.0f : 0.0f;
+}
+
+/** Source texels and weights contributing to each destination texel along one axis */
+struct INX_MipTaps {
+    util::DynamicArray<int> indices;    //< 'count' per destination texel, clamped to the edges
+    util::DynamicArray<float> weights;  //< Normalized, zero for padding taps
+    int count;
+};
+
+static INX_MipTaps INX_ComputeMipTaps(int srcSize, int dstSize, NX_MipmapFilter filter)
+{
+    const float scale = static_cast<float>(srcSize) / dstSize;
+    const float support = INX_GetKernelRadius(filter) * scale;
+
+    INX_MipTaps taps;
+    taps.count = static_cast<int>(std::ceil(2.0f * support)) + 1;
+    (void)taps.indices.Resize(static_cast<size_t>(dstSize) * taps.count);
+    (void)taps.weights.Resize(static_cast<size_t>(dstSize) * taps.count);
+
+    for (int d = 0; d < dstSize; d++) {
+        int* indices = &taps.indices[static_cast<size_t>(d) * taps.count];
+        float* weights = &taps.weights[static_cast<size_t>(d) * taps.count];
+
+        const float center = (d + 0.5f) * scale;
+        const int first = static_cast<int>(std::floor(center - support));
+
+        float sum = 0.0f;
+        for (int k = 0; k < taps.count; k++) {
+            const int s = first + k;
+            indices[k] = std::clamp(s, 0, srcSize - 1);
+            weights[k] = INX_EvalKernel(filter, (s + 0.5f - center) / scale);
+            sum += weights[k];
+        }
+
+        // NOTE: The kernels are positive around their center, the sum cannot vanish
+        const float invSum = 1.0f / sum;
+        for (int k = 0; k < taps.count; k++) {
+            weights[k] *= invSum;
+        }
+    }
+
+    return taps;
+}
+
+/** Conversion tables between 8-bit sRGB values and linear floats */
+struct INX_SRGBTables {
+    static constexpr int LinearSteps = 16384;
+    float toLinear[256];
+    uint8_t fromLinear[LinearSteps + 1];
+
+    INX_SRGBTables() {
+        for (int i = 0; i < 256; i++) {
+            float c = i / 255.0f;
+            toLinear[i] = (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        for (int i = 0; i <= LinearSteps; i++) {
+            float c = static_cast<float>(i) / LinearSteps;
+            c = (c <= 0.0031308f) ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+            fromLinear[i] = static_cast<uint8_t>(c * 255.0f + 0.5f);
+        }
+    }
+};
+
+static const INX_SRGBTables& INX_GetSRGBTables()
+{
+    static const INX_SRGBTables tables;
+    return tables;
+}
+
+/** Reads a row of the base image as floats, color channels are linearized if requested */
+static void INX_ReadBaseRow(const NX_Image& image, int y, int channels, bool srgb, float* out)
+{
+    const int w = image.w;
+
+    if (NX_GetPixelChannelBytes(image.format) == 1) {
+        const float* toLinear = INX_GetSRGBTables().toLinear;
+        const uint8_t* row = static_cast<const uint8_t*>(image.pixels) + static_cast<size_t>(y) * w * channels;
+        for (int i = 0; i < w * channels; i++) {
+            const bool color = srgb && (i % channels) < 3;
+            out[i] = color ? toLinear[row[i]] : row[i] / 255.0f;
+        }
+        return;
+    }
+
+    for (int x = 0; x < w; x++) {
+        NX_Color color = NX_ReadPixel(image.pixels, y * w + x, image.format);
+        const float values[4] = { color.r, color.g, color.b, color.a };
+        for (int c = 0; c < channels; c++) {
+            out[x * channels + c] = values[c];
+        }
+    }
+}
+
+/** Writes a float level into a new image of the given format, scaling its alpha */
+static NX_Image INX_WriteLevel(const float* texels, int w, int h, NX_PixelFormat format,
+                               int channels, bool srgb, float alphaScale)
+{
+    NX_Image image = NX_CreateImage(w, h, format);
+    if (image.pixels == nullptr) {
+        return image;
+    }
+
+    const bool is8Bit = (NX_GetPixelChannelBytes(format) == 1);
+
+    INX_Jobs.ParallelFor(h, 16, [&](int begin, int end) {
+        const uint8_t* fromLinear = INX_GetSRGBTables().fromLinear;
+        constexpr float linearSteps = INX_SRGBTables::LinearSteps;
+
+        for (int y = begin; y < end; y++) {
+            const float* src = texels + static_cast<size_t>(y) * w * channels;
+            if (is8Bit) {
+                uint8_t* dst = static_cast<uint8_t*>(image.pixels) + static_cast<size_t>(y) * w * channels;
+                for (int i = 0; i < w * channels; i++) {
+                    const int c = i % channels;
+                    const float v = NX_Saturate((c == 3) ? src[i] * alphaScale : src[i]);
+                    dst[i] = (srgb && c < 3)
+                        ? fromLinear[static_cast<int>(v * linearSteps + 0.5f)]
+                        : static_cast<uint8_t>(v * 255.0f + 0.5f);
+                }
+            }
+            else {
+                for (int x = 0; x < w; x++) {
+                    float values[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+                    for (int c = 0; c < channels; c++) {
+                        values[c] = src[x * channels + c];
+                    }
+                    values[3] *= alphaScale;
+                    NX_Color color = { values[0], values[1], values[2], values[3] };
+                    NX_WritePixel(image.pixels, y * w + x, format, color);
+                }
+            }
+        }
+    });
+
+    return image;
+}
+
+/** Fraction of texels whose scaled alpha passes the cutoff */
+static float INX_GetAlphaCoverage(const float* texels, size_t count, float cutoff, float scale)
+{
+    size_t covered = 0;
+    for (size_t i = 0; i < count; i++) {
+        covered += (texels[4 * i + 3] * scale > cutoff);
+    }
+    return static_cast<float>(covered) / count;
+}
+
+/** Finds the alpha scale giving a level the same coverage as the base image */
+static float INX_FindAlphaScale(const float* texels, size_t count, float cutoff, float coverage)
+{
+    // NOTE: Coverage only grows with the scale, a bisection converges quickly
+    float lo = 0.0f, hi = 4.0f;
+
+    for (int i = 0; i < 12; i++) {
+        float mid = 0.5f * (lo + hi);
+        if (INX_GetAlphaCoverage(texels, count, cutoff, mid) < coverage) lo = mid;
+        else hi = mid;
+    }
+
+    return hi;
+}
+
+/** Destroys the levels appended from 'firstLevel', on failure */
+static void INX_DestroyLevels(util::DynamicArray<NX_Image>* mipmaps, size_t firstLevel)
+{
+    for (size_t i = firstLevel; i < mipmaps->GetSize(); i++) {
+        NX_DestroyImage(&(*mipmaps)[i]);
+    }
+    (void)mipmaps->Resize(firstLevel);
+}
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+int INX_GetMipLevelCount(int w, int h)
+{
+    int count = 1;
+    for (int size = std::max(w, h); size > 1; size >>= 1) {
+        count++;
+    }
+    return count;
+}
+
+bool INX_GenImageMipmaps(const NX_Image& image, NX_MipmapFilter filter, bool srgb,
+                         float alphaCutoff, util::DynamicArray<NX_Image>* mipmaps)
+{
+    if (image.pixels == nullptr || image.w <= 0 || image.h <= 0 || NX_IsPixelFormatCompressed(image.format)) {
+        return false;
+    }
+
+    const int channels = NX_GetPixelChannels(image.format);
+    const bool alphaCoverage = (alphaCutoff > 0.0f && channels == 4);
+
+    // NOTE: sRGB decoding only makes sense for 8-bit values, float formats are already linear
+    srgb = srgb && (NX_GetPixelChannelBytes(image.format) == 1);
+
+    /* --- Coverage of the base image, with alpha read as stored --- */
+
+    float baseCoverage = 0.0f;
+
+    if (alphaCoverage) {
+        std::atomic<size_t> covered{0};
+        INX_Jobs.ParallelFor(image.h, 32, [&](int begin, int end) {
+            util::DynamicArray<float> row(static_cast<size_t>(image.w) * channels);
+            size_t count = 0;
+            for (int y = begin; y < end; y++) {
+                INX_ReadBaseRow(image, y, channels, false, row.GetData());
+                for (int x = 0; x < image.w; x++) {
+                    count += (row[4 * x + 3] > alphaCutoff);
+                }
+            }
+            covered += count;
+        });
+        baseCoverage = static_cast<float>(covered) / (static_cast<size_t>(image.w) * image.h);
+    }
+
+    /* --- Each level is resampled from the previous one, the first from the base image --- */
+
+    const size_t firstLevel = mipmaps->GetSize();
+    util::DynamicArray<float> prev, tmp, next;
+    int srcW = image.w, srcH = image.h;
+
+    while (srcW > 1 || srcH > 1)
+    {
+        const int dstW = std::max(srcW / 2, 1);
+        const int dstH = std::max(srcH / 2, 1);
+        const bool fromBase = (srcW == image.w && srcH == image.h);
+
+        const INX_MipTaps xTaps = INX_ComputeMipTaps(srcW, dstW, filter);
+        const INX_MipTaps yTaps = INX_ComputeMipTaps(srcH, dstH, filter);
+
+        /* --- Horizontal pass, every source row to 'dstW' texels --- */
+
+        if (!tmp.Resize(static_cast<size_t>(dstW) * srcH * channels) ||
+            !next.Assign(static_cast<size_t>(dstW) * dstH * channels, 0.0f)) {
+            INX_DestroyLevels(mipmaps, firstLevel);
+            return false;
+        }
+
+        INX_Jobs.ParallelFor(srcH, 16, [&](int begin, int end) {
+            util::DynamicArray<float> scratch(fromBase ? static_cast<size_t>(srcW) * channels : 0);
+            for (int y = begin; y < end; y++) {
+                const float* row = prev.GetData() + static_cast<size_t>(y) * srcW * channels;
+                if (fromBase) {
+                    INX_ReadBaseRow(image, y, channels, srgb, scratch.GetData());
+                    row = scratch.GetData();
+                }
+                float* out = tmp.GetData() + static_cast<size_t>(y) * dstW * channels;
+                for (int x = 0; x < dstW; x++) {
+                    const int* indices = &xTaps.indices[static_cast<size_t>(x) * xTaps.count];
+                    const float* weights = &xTaps.weights[static_cast<size_t>(x) * xTaps.count];
+                    float acc[4] = {};
+                    for (int k = 0; k < xTaps.count; k++) {
+                        const float* texel = row + indices[k] * channels;
+                        for (int c = 0; c < channels; c++) {
+                            acc[c] += weights[k] * texel[c];
+                        }
+                    }
+                    for (int c = 0; c < channels; c++) {
+                        out[x * channels + c] = acc[c];
+                    }
+                }
+            }
+        });
+
+        /* --- Vertical pass, whole rows are accumulated so the inner loop vectorizes --- */
+
+        INX_Jobs.ParallelFor(dstH, 16, [&](int begin, int end) {
+            const int rowSize = dstW * channels;
+            for (int y = begin; y < end; y++) {
+                const int* indices = &yTaps.indices[static_cast<size_t>(y) * yTaps.count];
+                const float* weights = &yTaps.weights[static_cast<size_t>(y) * yTaps.count];
+                float* out = next.GetData() + static_cast<size_t>(y) * rowSize;
+                for (int k = 0; k < yTaps.count; k++) {
+                    const float* in = tmp.GetData() + static_cast<size_t>(indices[k]) * rowSize;
+                    const float weight = weights[k];
+                    for (int i = 0; i < rowSize; i++) {
+                        out[i] += weight * in[i];
+                    }
+                }
+            }
+        });
+
+        /* --- Store the level, the chain itself keeps the unscaled alpha --- */
+
+        float alphaScale = 1.0f;
+        if (alphaCoverage) {
+            alphaScale = INX_FindAlphaScale(next.GetData(), static_cast<size_t>(dstW) * dstH, alphaCutoff, baseCoverage);
+        }
+
+        NX_Image level = INX_WriteLevel(next.GetData(), dstW, dstH, image.format, channels, srgb, alphaScale);
+        if (level.pixels == nullptr) {
+            INX_DestroyLevels(mipmaps, firstLevel);
+            return false;
+        }
+
+        mipmaps->PushBack(level);
+
+        prev.Swap(next);
+        srcW = dstW;
+        srcH = dstH;
+    }
+
+    return true;
+}
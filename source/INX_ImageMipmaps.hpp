@@ -0,0 +1,32 @@
+/* INX_ImageMipmaps.hpp -- Internal CPU generation of image mip chains
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef INX_IMAGE_MIPMAPS_HPP
+#define INX_IMAGE_MIPMAPS_HPP
+
+#include <NX/NX_Image.h>
+
+#include "./Detail/Util/DynamicArray.hpp"
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+/** Returns the number of levels of a full mip chain, base level included */
+int INX_GetMipLevelCount(int w, int h);
+
+/**
+ * Generates the levels following the base image, down to 1x1, and appends them to 'mipmaps'.
+ * Levels keep the format of the base image, which must not be block compressed.
+ * The work is split across the job system workers, the calling thread takes part in it.
+ * On failure, false is returned and nothing is appended.
+ */
+bool INX_GenImageMipmaps(const NX_Image& image, NX_MipmapFilter filter, bool srgb,
+                         float alphaCutoff, util::DynamicArray<NX_Image>* mipmaps);
+
+#endif // INX_IMAGE_MIPMAPS_HPP
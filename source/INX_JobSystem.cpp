@@ -0,0 +1,284 @@
+/* INX_JobSystem.cpp -- Internal implementation details for the library-wide job scheduler
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./INX_JobSystem.hpp"
+#include "./Detail/Util/Ranges.hpp"
+
+#include <NX/NX_Log.h>
+
+// ============================================================================
+// JOB SYSTEM
+// ============================================================================
+
+INX_JobSystem INX_Jobs{};
+
+/** Index of the worker slot owned by the current thread, -1 for foreign threads */
+static thread_local int INX_WorkerIndex = -1;
+
+// ============================================================================
+// PUBLIC IMPLEMENTATION
+// ============================================================================
+
+bool INX_JobSystem::Init(int workerCount)
+{
+    mMainThreadId = std::this_thread::get_id();
+    mShouldStop = false;
+
+    /* --- Create one slot per worker, plus one for the main thread --- */
+
+    mWorkers.Clear();
+    if (!mWorkers.Reset(workerCount + 1) || !mWorkers.Resize(workerCount + 1)) {
+        NX_LOG(E, "CORE: Failed to allocate the job system worker slots");
+        return false;
+    }
+
+    INX_WorkerIndex = workerCount;
+
+    /* --- Start worker threads --- */
+
+    for (int i = 0; i < workerCount; i++) {
+        mWorkers[i].thread = std::thread([this, i]() { WorkerLoop(i); });
+    }
+
+    NX_LOG(V, "CORE: Job system initialized with %d worker thread(s)", workerCount);
+
+    return true;
+}
+
+void INX_JobSystem::Quit()
+{
+    /* --- Stop workers once the queues are empty --- */
+
+    {
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+        mShouldStop = true;
+    }
+    mWakeCV.notify_all();
+
+    for (Worker& worker : mWorkers) {
+        if (worker.thread.joinable()) {
+            worker.thread.join();
+        }
+    }
+
+    /* --- Flush what remains on the main thread so that no counter is left pending --- */
+
+    while (TryRunJob() || !mMainTasks.IsEmpty()) {
+        RunMainTasks();
+    }
+
+    mWorkers.Clear();
+    INX_WorkerIndex = -1;
+}
+
+void INX_JobSystem::Submit(Task task, INX_JobCounter* counter, INX_JobCounter* dependency)
+{
+    Schedule(Job{ std::move(task), counter, false }, dependency);
+}
+
+void INX_JobSystem::SubmitMain(Task task, INX_JobCounter* counter, INX_JobCounter* dependency)
+{
+    Schedule(Job{ std::move(task), counter, true }, dependency);
+}
+
+void INX_JobSystem::Wait(INX_JobCounter& counter)
+{
+    const bool mainThread = IsMainThread();
+
+    while (!counter.IsDone()) {
+        if (mainThread) RunMainTasks();
+        if (!TryRunJob()) {
+            std::this_thread::yield();
+        }
+    }
+
+    // NOTE: The last job decrements the counter under its lock,
+    //       it must be released before the counter can be destroyed
+    std::lock_guard<std::mutex> lock(counter.mMutex);
+}
+
+bool INX_JobSystem::TryRunJob()
+{
+    Job job;
+    if (!Pop(&job)) {
+        return false;
+    }
+    Execute(job);
+    return true;
+}
+
+void INX_JobSystem::RunMainTasks()
+{
+    if (!IsMainThread()) {
+        return;
+    }
+
+    util::DynamicArray<Job> tasks;
+    {
+        std::lock_guard<std::mutex> lock(mMainMutex);
+        tasks.Swap(mMainTasks);
+    }
+
+    for (Job& job : tasks) {
+        Execute(job);
+    }
+}
+
+// ============================================================================
+// PRIVATE IMPLEMENTATION
+// ============================================================================
+
+void INX_JobSystem::Schedule(Job&& job, INX_JobCounter* dependency)
+{
+    if (job.counter != nullptr) {
+        job.counter->mPending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /* --- Defer the job if its dependency is still pending --- */
+
+    if (dependency != nullptr) {
+        std::lock_guard<std::mutex> lock(dependency->mMutex);
+        if (dependency->mPending.load(std::memory_order_acquire) != 0) {
+            dependency->mContinuations.PushBack(std::move(job));
+            return;
+        }
+    }
+
+    Dispatch(std::move(job));
+}
+
+void INX_JobSystem::Dispatch(Job&& job)
+{
+    if (job.mainThread) {
+        std::lock_guard<std::mutex> lock(mMainMutex);
+        mMainTasks.PushBack(std::move(job));
+    }
+    else {
+        Push(std::move(job));
+    }
+}
+
+void INX_JobSystem::Push(Job&& job)
+{
+    // NOTE: Before init or after shutdown, jobs are simply run on the calling thread
+    if (mWorkers.IsEmpty()) {
+        Execute(job);
+        return;
+    }
+
+    // Jobs go to the deque of the submitting thread, foreign threads spread them
+    int index = INX_WorkerIndex;
+    if (index < 0) {
+        index = mNextVictim.fetch_add(1, std::memory_order_relaxed) % mWorkers.GetSize();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mWorkers[index].mutex);
+        mWorkers[index].jobs.PushBack(std::move(job));
+    }
+
+    mQueuedCount.fetch_add(1, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock(mSleepMutex);
+    }
+    mWakeCV.notify_one();
+}
+
+bool INX_JobSystem::Pop(Job* job)
+{
+    const int count = static_cast<int>(mWorkers.GetSize());
+    const int self = INX_WorkerIndex;
+
+    /* --- Try our own deque first, most recent job is the hottest in cache --- */
+
+    if (self >= 0 && self < count) {
+        Worker& worker = mWorkers[self];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.jobs.GetSize() > worker.head) {
+            *job = std::move(*worker.jobs.GetBack());
+            worker.jobs.PopBack();
+            if (worker.jobs.GetSize() == worker.head) {
+                worker.jobs.Clear();
+                worker.head = 0;
+            }
+            mQueuedCount.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    /* --- Steal the oldest job of another thread --- */
+
+    const int start = static_cast<int>(mNextVictim.fetch_add(1, std::memory_order_relaxed) % std::max(count, 1));
+
+    for (int i = 0; i < count; i++) {
+        int victim = (start + i) % count;
+        if (victim == self) continue;
+
+        Worker& worker = mWorkers[victim];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.jobs.GetSize() > worker.head) {
+            *job = std::move(worker.jobs[worker.head++]);
+            if (worker.jobs.GetSize() == worker.head) {
+                worker.jobs.Clear();
+                worker.head = 0;
+            }
+            mQueuedCount.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void INX_JobSystem::Execute(Job& job)
+{
+    job.task();
+    Finish(job.counter);
+}
+
+void INX_JobSystem::Finish(INX_JobCounter* counter)
+{
+    if (counter == nullptr) {
+        return;
+    }
+
+    util::DynamicArray<Job> continuations;
+    {
+        std::lock_guard<std::mutex> lock(counter->mMutex);
+        if (counter->mPending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            continuations.Swap(counter->mContinuations);
+        }
+    }
+
+    // NOTE: The counter may be destroyed from here, only the local copy is used
+    for (Job& job : continuations) {
+        Dispatch(std::move(job));
+    }
+}
+
+void INX_JobSystem::WorkerLoop(int index)
+{
+    INX_WorkerIndex = index;
+
+    while (true)
+    {
+        if (TryRunJob()) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mSleepMutex);
+        mWakeCV.wait(lock, [this]() {
+            return mShouldStop || mQueuedCount.load(std::memory_order_acquire) > 0;
+        });
+
+        if (mShouldStop && mQueuedCount.load(std::memory_order_acquire) <= 0) {
+            break;
+        }
+    }
+}
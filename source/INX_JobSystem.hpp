@@ -0,0 +1,173 @@
+/* INX_JobSystem.hpp -- Internal implementation details for the library-wide job scheduler
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef INX_JOB_SYSTEM_HPP
+#define INX_JOB_SYSTEM_HPP
+
+#include "./Detail/Util/DynamicArray.hpp"
+#include "./Detail/Util/FixedArray.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+
+// ============================================================================
+// JOB COUNTER
+// ============================================================================
+
+/**
+ * Tracks the number of pending jobs submitted with it.
+ * A counter can be waited on, or used as a dependency for other jobs which
+ * are then only scheduled once it reaches zero.
+ * It must outlive every job that references it.
+ */
+class INX_JobCounter {
+public:
+    bool IsDone() const;
+
+private:
+    friend class INX_JobSystem;
+    struct Job;
+
+    std::atomic<int> mPending{0};
+    std::mutex mMutex;                  //< Protects the continuations
+    util::DynamicArray<Job> mContinuations; //< Jobs waiting for this counter to reach zero
+};
+
+struct INX_JobCounter::Job {
+    std::function<void()> task;
+    INX_JobCounter* counter{};
+    bool mainThread{};
+};
+
+// ============================================================================
+// JOB SYSTEM
+// ============================================================================
+
+extern class INX_JobSystem {
+public:
+    using Task = std::function<void()>;
+
+public:
+    /** Creates the worker threads, must be called from the main thread */
+    bool Init(int workerCount);
+    void Quit();
+
+    /** Returns the number of worker threads, the main thread not included */
+    int GetWorkerCount() const;
+    bool IsMainThread() const;
+
+    /** Schedules a task on the workers, after 'dependency' has reached zero if provided */
+    void Submit(Task task, INX_JobCounter* counter = nullptr, INX_JobCounter* dependency = nullptr);
+
+    /** Schedules a task that will only run on the main thread (e.g. GL uploads) */
+    void SubmitMain(Task task, INX_JobCounter* counter = nullptr, INX_JobCounter* dependency = nullptr);
+
+    /** Helps running jobs until the counter reaches zero, also runs the main tasks on the main thread */
+    void Wait(INX_JobCounter& counter);
+
+    /** Runs one pending job if any, returns false if none could be found */
+    bool TryRunJob();
+
+    /** Runs all pending main thread tasks, does nothing if not called from the main thread */
+    void RunMainTasks();
+
+    /**
+     * Splits [0, count) into ranges of at least 'grain' elements and calls 'fn(begin, end)'
+     * for each of them, the calling thread takes part in the work and returns once all are done.
+     */
+    template <typename F>
+    void ParallelFor(int count, int grain, F&& fn);
+
+private:
+    using Job = INX_JobCounter::Job;
+
+    struct Worker {
+        std::thread thread;
+        std::mutex mutex;
+        util::DynamicArray<Job> jobs;   //< Owner pops from the back, thieves from 'head'
+        size_t head{0};                 //< Jobs before it were stolen, reset once the array is drained
+    };
+
+private:
+    void Schedule(Job&& job, INX_JobCounter* dependency);
+    void Dispatch(Job&& job);
+    void Push(Job&& job);
+    bool Pop(Job* job);
+    void Execute(Job& job);
+    void Finish(INX_JobCounter* counter);
+    void WorkerLoop(int index);
+
+private:
+    /** Workers, the last slot is owned by the main thread and has no thread */
+    util::FixedArray<Worker> mWorkers;
+    std::atomic<uint32_t> mNextVictim{0};
+
+    /** Sleeping workers */
+    std::mutex mSleepMutex;
+    std::condition_variable mWakeCV;
+    std::atomic<int> mQueuedCount{0};
+    bool mShouldStop{false};
+
+    /** Main thread affine tasks */
+    std::mutex mMainMutex;
+    util::DynamicArray<Job> mMainTasks;
+    std::thread::id mMainThreadId{};
+
+} INX_Jobs;
+
+// ============================================================================
+// INLINE IMPLEMENTATION
+// ============================================================================
+
+inline bool INX_JobCounter::IsDone() const
+{
+    return mPending.load(std::memory_order_acquire) == 0;
+}
+
+inline int INX_JobSystem::GetWorkerCount() const
+{
+    return mWorkers.IsEmpty() ? 0 : static_cast<int>(mWorkers.GetSize()) - 1;
+}
+
+inline bool INX_JobSystem::IsMainThread() const
+{
+    return std::this_thread::get_id() == mMainThreadId;
+}
+
+template <typename F>
+void INX_JobSystem::ParallelFor(int count, int grain, F&& fn)
+{
+    const int workerCount = GetWorkerCount();
+    grain = std::max(grain, 1);
+
+    if (workerCount == 0 || count <= grain) {
+        if (count > 0) fn(0, count);
+        return;
+    }
+
+    // NOTE: No more ranges than threads, each range is split as evenly as possible
+    const int rangeCount = std::min((count + grain - 1) / grain, workerCount + 1);
+    const int rangeSize = (count + rangeCount - 1) / rangeCount;
+
+    INX_JobCounter counter;
+
+    for (int begin = rangeSize; begin < count; begin += rangeSize) {
+        int end = std::min(begin + rangeSize, count);
+        Submit([&fn, begin, end]() { fn(begin, end); }, &counter);
+    }
+
+    fn(0, std::min(rangeSize, count));
+
+    Wait(counter);
+}
+
+#endif // INX_JOB_SYSTEM_HPP
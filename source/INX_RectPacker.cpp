@@ -0,0 +1,196 @@
+/* INX_RectPacker.cpp -- Internal incremental rectangle packer for runtime atlases
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./INX_RectPacker.hpp"
+
+#include "./Detail/Util/Ranges.hpp"
+
+#include <algorithm>
+#include <climits>
+
+// ============================================================================
+// PUBLIC IMPLEMENTATION
+// ============================================================================
+
+INX_RectPacker::INX_RectPacker(int w, int h)
+{
+    Reset(w, h);
+}
+
+void INX_RectPacker::Reset(int w, int h)
+{
+    mWidth = w;
+    mHeight = h;
+    mUsedArea = 0;
+
+    mFreeRects.Clear();
+    mFreeRects.PushBack(Rect{0, 0, w, h});
+}
+
+bool INX_RectPacker::Insert(int w, int h, Rect* rect)
+{
+    if (w <= 0 || h <= 0 || w > mWidth || h > mHeight) {
+        return false;
+    }
+
+    /* --- Best short side fit, ties broken by the long side --- */
+
+    int bestShort = INT_MAX;
+    int bestLong = INT_MAX;
+    Rect best{};
+
+    for (const Rect& free : mFreeRects)
+    {
+        if (free.w < w || free.h < h) {
+            continue;
+        }
+
+        int leftoverX = free.w - w;
+        int leftoverY = free.h - h;
+        int shortSide = std::min(leftoverX, leftoverY);
+        int longSide = std::max(leftoverX, leftoverY);
+
+        if (shortSide < bestShort || (shortSide == bestShort && longSide < bestLong)) {
+            best = Rect{free.x, free.y, w, h};
+            bestShort = shortSide;
+            bestLong = longSide;
+        }
+    }
+
+    if (bestShort == INT_MAX) {
+        return false;
+    }
+
+    /* --- Carve the rectangle out of the free space --- */
+
+    SplitFreeRects(best);
+    PruneFreeRects();
+
+    mUsedArea += static_cast<int64_t>(w) * h;
+    *rect = best;
+
+    return true;
+}
+
+void INX_RectPacker::Free(const Rect& rect)
+{
+    if (rect.w <= 0 || rect.h <= 0) {
+        return;
+    }
+
+    mUsedArea -= static_cast<int64_t>(rect.w) * rect.h;
+    mFreeRects.PushBack(rect);
+
+    MergeFreeRects();
+    PruneFreeRects();
+}
+
+// ============================================================================
+// PRIVATE IMPLEMENTATION
+// ============================================================================
+
+bool INX_RectPacker::Contains(const Rect& a, const Rect& b)
+{
+    return b.x >= a.x && b.y >= a.y
+        && b.x + b.w <= a.x + a.w
+        && b.y + b.h <= a.y + a.h;
+}
+
+bool INX_RectPacker::Overlaps(const Rect& a, const Rect& b)
+{
+    return a.x < b.x + b.w && b.x < a.x + a.w
+        && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+void INX_RectPacker::SplitFreeRects(const Rect& used)
+{
+    // NOTE: Each overlapped free rectangle is replaced by up to four maximal
+    //       rectangles around the used one, they overlap each other on purpose
+    mSplitRects.Clear();
+
+    for (size_t i = 0; i < mFreeRects.GetSize();)
+    {
+        const Rect free = mFreeRects[i];
+
+        if (!Overlaps(free, used)) {
+            i++;
+            continue;
+        }
+
+        if (used.x > free.x) {
+            mSplitRects.PushBack(Rect{free.x, free.y, used.x - free.x, free.h});
+        }
+        if (used.x + used.w < free.x + free.w) {
+            mSplitRects.PushBack(Rect{used.x + used.w, free.y, free.x + free.w - used.x - used.w, free.h});
+        }
+        if (used.y > free.y) {
+            mSplitRects.PushBack(Rect{free.x, free.y, free.w, used.y - free.y});
+        }
+        if (used.y + used.h < free.y + free.h) {
+            mSplitRects.PushBack(Rect{free.x, used.y + used.h, free.w, free.y + free.h - used.y - used.h});
+        }
+
+        mFreeRects[i] = *mFreeRects.GetBack();
+        mFreeRects.PopBack();
+    }
+
+    mFreeRects.Insert(mFreeRects.End(), mSplitRects.Begin(), mSplitRects.End());
+}
+
+void INX_RectPacker::MergeFreeRects()
+{
+    bool merged = true;
+
+    while (merged)
+    {
+        merged = false;
+
+        for (size_t i = 0; i < mFreeRects.GetSize() && !merged; i++) {
+            for (size_t j = i + 1; j < mFreeRects.GetSize() && !merged; j++) {
+                Rect& a = mFreeRects[i];
+                const Rect& b = mFreeRects[j];
+
+                if (a.x == b.x && a.w == b.w && (a.y + a.h == b.y || b.y + b.h == a.y)) {
+                    a.y = std::min(a.y, b.y);
+                    a.h += b.h;
+                    merged = true;
+                }
+                else if (a.y == b.y && a.h == b.h && (a.x + a.w == b.x || b.x + b.w == a.x)) {
+                    a.x = std::min(a.x, b.x);
+                    a.w += b.w;
+                    merged = true;
+                }
+
+                if (merged) {
+                    mFreeRects.Erase(mFreeRects.Begin() + j);
+                }
+            }
+        }
+    }
+}
+
+void INX_RectPacker::PruneFreeRects()
+{
+    for (size_t i = 0; i < mFreeRects.GetSize();)
+    {
+        bool contained = false;
+        for (size_t j = 0; j < mFreeRects.GetSize(); j++) {
+            if (i != j && Contains(mFreeRects[j], mFreeRects[i])) {
+                contained = true;
+                break;
+            }
+        }
+
+        if (contained) {
+            mFreeRects.Erase(mFreeRects.Begin() + i);
+        }
+        else {
+            i++;
+        }
+    }
+}
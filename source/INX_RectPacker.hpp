@@ -0,0 +1,67 @@
+/* INX_RectPacker.hpp -- Internal incremental rectangle packer for runtime atlases
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef INX_RECT_PACKER_HPP
+#define INX_RECT_PACKER_HPP
+
+#include "./Detail/Util/DynamicArray.hpp"
+
+#include <cstdint>
+
+// ============================================================================
+// RECT PACKER
+// ============================================================================
+
+/**
+ * MaxRects packer with the best short side fit heuristic.
+ *
+ * Unlike stb_rect_pack, rectangles are inserted one at a time and can be freed,
+ * which makes it suitable for atlases filled and evicted at runtime. Freed areas
+ * are merged back with neighbouring free areas whenever they share a full edge.
+ */
+class INX_RectPacker {
+public:
+    struct Rect {
+        int x{}, y{}, w{}, h{};
+    };
+
+public:
+    INX_RectPacker() = default;
+    INX_RectPacker(int w, int h);
+
+    /** Clears every allocation */
+    void Reset(int w, int h);
+
+    /** Finds room for a rectangle, returns false if it cannot fit */
+    bool Insert(int w, int h, Rect* rect);
+
+    /** Gives back a rectangle previously returned by Insert() */
+    void Free(const Rect& rect);
+
+    /** Packing information */
+    int GetWidth() const { return mWidth; }
+    int GetHeight() const { return mHeight; }
+    int64_t GetUsedArea() const { return mUsedArea; }
+
+private:
+    static bool Contains(const Rect& a, const Rect& b);
+    static bool Overlaps(const Rect& a, const Rect& b);
+
+    void SplitFreeRects(const Rect& used);
+    void MergeFreeRects();
+    void PruneFreeRects();
+
+private:
+    util::DynamicArray<Rect> mFreeRects;
+    util::DynamicArray<Rect> mSplitRects;   //< Scratch storage of SplitFreeRects()
+    int mWidth{0};
+    int mHeight{0};
+    int64_t mUsedArea{0};
+};
+
+#endif // INX_RECT_PACKER_HPP
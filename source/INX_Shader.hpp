@@ -15,12 +15,14 @@
 #include "./Detail/Util/DynamicArray.hpp"
 #include "./Detail/Util/String.hpp"
 
+#include "./Detail/GPU/RingBuffer.hpp"
 #include "./Detail/GPU/Pipeline.hpp"
 #include "./Detail/GPU/Program.hpp"
 #include "./Detail/GPU/Texture.hpp"
 #include "./Detail/GPU/Buffer.hpp"
 #include "./INX_Utils.hpp"
 
+#include <cstring>
 #include <array>
 
 /**
@@ -80,7 +82,7 @@ public:
     /** Upload data to the static uniform buffer */
     void UpdateStaticBuffer(size_t offset, size_t size, const void* data);
     
-    /** Upload data to the dynamic uniform buffer (creates a new range) */
+    /** Stage data for the dynamic uniform buffer (creates a new range, streamed on the next bind) */
     void UpdateDynamicBuffer(size_t size, const void* data);
 
     /** Bind uniform buffers for the current draw call */
@@ -130,16 +132,19 @@ protected:
     struct DynamicBuffer {
         struct Range { size_t offset, size; };
         util::DynamicArray<Range> ranges{};
+        util::DynamicArray<uint8_t> staging{};  //< Data of all ranges, offsets are relative to its start
+        gpu::RingBuffer::Range uploaded{};      //< Location of the staging data in the ring buffer
+        gpu::RingBuffer buffer{};
         int currentRangeIndex{};
         size_t currentOffset{};
-        gpu::Buffer buffer{};
+        bool dirty{};                           //< Staging data changed since the last upload
     };
 
 protected:
     std::array<gpu::Program, VariantCount> mPrograms{};
     std::array<bool, SAMPLER_COUNT> mSamplerExists{};
     TextureArray mBindedTextures{};
-    DynamicBuffer mDynamicBuffer{};
+    mutable DynamicBuffer mDynamicBuffer{};     //< Streamed lazily by BindUniforms()
     gpu::Buffer mStaticBuffer{};
 };
 
@@ -199,38 +204,29 @@ void INX_Shader<Derived>::UpdateDynamicBuffer(size_t size, const void* data)
         return;
     }
 
+    size_t maxUBOSize = static_cast<size_t>(gpu::Pipeline::GetMaxUniformBufferSize());
+    if (size > maxUBOSize) {
+        NX_LOG(E, "RENDER: Dynamic buffer upload failed (size=%zu > GPU limit=%zu)", size, maxUBOSize);
+        return;
+    }
+
     size_t alignment = gpu::Pipeline::GetUniformBufferOffsetAlignment();
     size_t alignedOffset = NX_ALIGN_UP(mDynamicBuffer.currentOffset, alignment);
 
-    size_t requiredSize = alignedOffset + size;
-    size_t currentSize = mDynamicBuffer.buffer.GetSize();
-    size_t maxUBOSize = static_cast<size_t>(gpu::Pipeline::GetMaxUniformBufferSize());
-
-    // Grow buffer if needed
-    if (requiredSize > currentSize) {
-        size_t newSize = NX_ALIGN_UP(2 * currentSize, alignment);
-        while (newSize < requiredSize) {
-            newSize *= 2;
-            newSize = NX_ALIGN_UP(newSize, alignment);
-        }
-        
-        if (newSize > maxUBOSize) {
-            NX_LOG(E,
-                "RENDER: Dynamic buffer resize failed (required=%zu > GPU limit=%zu)",
-                newSize, maxUBOSize
-            );
-            return;
-        }
-        
-        mDynamicBuffer.buffer.Realloc(newSize, true);
+    // Stage the data, the ring buffer is written once on the next bind
+    if (!mDynamicBuffer.staging.Resize(alignedOffset + size)) {
+        NX_LOG(E, "RENDER: Dynamic buffer staging allocation failed (requested: %zu bytes)", alignedOffset + size);
+        return;
     }
 
+    std::memcpy(&mDynamicBuffer.staging[alignedOffset], data, size);
+
     // Record this range for binding
     mDynamicBuffer.currentRangeIndex = static_cast<int>(mDynamicBuffer.ranges.GetSize());
     mDynamicBuffer.ranges.EmplaceBack(alignedOffset, size);
 
-    mDynamicBuffer.buffer.Upload(alignedOffset, size, data);
     mDynamicBuffer.currentOffset = alignedOffset + size;
+    mDynamicBuffer.dirty = true;
 }
 
 template <typename Derived>
@@ -243,12 +239,25 @@ void INX_Shader<Derived>::BindUniforms(const gpu::Pipeline& pipeline, int dynami
         );
     }
 
-    if (mDynamicBuffer.buffer.IsValid() && dynamicRangeIndex >= 0) {
+    if (!mDynamicBuffer.buffer.IsValid() || dynamicRangeIndex < 0) {
+        return;
+    }
+
+    // All ranges staged since the last bind are streamed in a single allocation
+    if (mDynamicBuffer.dirty) {
+        mDynamicBuffer.uploaded = mDynamicBuffer.buffer.Upload(
+            mDynamicBuffer.staging.GetData(),
+            mDynamicBuffer.staging.GetSize()
+        );
+        mDynamicBuffer.dirty = false;
+    }
+
+    if (mDynamicBuffer.uploaded.size > 0 && dynamicRangeIndex < mDynamicBuffer.ranges.GetSize()) {
         const auto& range = mDynamicBuffer.ranges[dynamicRangeIndex];
         pipeline.BindUniform(
             UniformBinding[DYNAMIC_UNIFORM],
-            mDynamicBuffer.buffer,
-            range.offset,
+            mDynamicBuffer.buffer.GetBuffer(),
+            mDynamicBuffer.uploaded.offset + range.offset,
             range.size
         );
     }
@@ -270,6 +279,9 @@ void INX_Shader<Derived>::ClearDynamicBuffer()
 {
     mDynamicBuffer.currentOffset = 0;
     mDynamicBuffer.ranges.Clear();
+    mDynamicBuffer.staging.Clear();
+    mDynamicBuffer.uploaded = {};
+    mDynamicBuffer.dirty = false;
 }
 
 template <typename Derived>
@@ -81,6 +81,52 @@ inline void INX_ForEachBit(uint32_t bitfield, Func&& func)
     }
 }
 
+/**
+ * @brief Compute a 64-bit hash of a memory block.
+ * 
+ * Word-at-a-time variant of FNV-1a: each 8-byte word is xored in and multiplied
+ * by the FNV prime, then the high bits are folded back down. Trailing bytes use
+ * the byte-wise FNV-1a step. Hashes differ from the reference FNV-1a ones.
+ * 
+ * @param data Pointer to the data to hash.
+ * @param size Size of the data in bytes.
+ * @param seed Initial hash value, allows chaining several blocks.
+ * @return uint64_t The resulting hash.
+ * 
+ * @note Intended for cache keys, not suitable for cryptographic use.
+ */
+inline uint64_t INX_HashBytes(const void* data, size_t size, uint64_t seed = 0xcbf29ce484222325ull)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = seed;
+
+    // NOTE: Consumes eight bytes per step, large blocks (embedded images) are hashed often
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        SDL_memcpy(&word, bytes + i, 8);
+        hash = (hash ^ word) * 0x100000001b3ull;
+        hash ^= hash >> 29; //< Folds high bits back, the multiply only propagates upward
+    }
+    for (; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Combine a value into an existing hash.
+ * 
+ * @param hash The hash to combine into.
+ * @param value The value to combine.
+ * @return uint64_t The combined hash.
+ */
+constexpr uint64_t INX_HashCombine(uint64_t hash, uint64_t value)
+{
+    return hash ^ (value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2));
+}
+
 /**
  * @brief Get the file extension from a file path.
  * 
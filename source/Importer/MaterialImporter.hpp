@@ -24,6 +24,9 @@ public:
     /** Loads the materials and stores them in the specified model */
     bool LoadMaterials(NX_Model* model);
 
+    /** Loads the material parameters only, textures are left to NULL */
+    void LoadParameters(NX_Material* material, int index);
+
 private:
     /** Loads a material into memory */
     void LoadMaterial(NX_Material* material, int index);
@@ -36,7 +39,7 @@ private:
 /* === Public Implementation === */
 
 inline MaterialImporter::MaterialImporter(const SceneImporter& importer)
-    : mImporter(importer), mTextureLoader(importer)
+    : mImporter(importer), mTextureLoader(importer, true)
 {
     SDL_assert(importer.IsValid());
 }
@@ -50,6 +53,8 @@ inline bool MaterialImporter::LoadMaterials(NX_Model* model)
         return false;
     }
 
+    mTextureLoader.LoadTextures();
+
     for (size_t i = 0; i < model->materialCount; i++) {
         LoadMaterial(&model->materials[i], i);
     }
@@ -57,9 +62,7 @@ inline bool MaterialImporter::LoadMaterials(NX_Model* model)
     return true;
 }
 
-/* === Private Material === */
-
-inline void MaterialImporter::LoadMaterial(NX_Material* material, int index)
+inline void MaterialImporter::LoadParameters(NX_Material* material, int index)
 {
     const aiMaterial* aiMat = mImporter.GetMaterial(index);
 
@@ -67,9 +70,7 @@ inline void MaterialImporter::LoadMaterial(NX_Material* material, int index)
 
     *material = NX_GetDefaultMaterial();
 
-    /* --- Load albedo map --- */
-
-    material->albedo.texture = mTextureLoader.Get(index, TextureLoader::MAP_ALBEDO);
+    /* --- Load albedo color --- */
 
     aiColor4D color;
     if (aiMat->Get(AI_MATKEY_BASE_COLOR, color) == AI_SUCCESS) {
@@ -95,12 +96,7 @@ inline void MaterialImporter::LoadMaterial(NX_Material* material, int index)
         }
     }
 
-    /* --- Load emission map --- */
-
-    material->emission.texture = mTextureLoader.Get(index, TextureLoader::MAP_EMISSION);
-    if (material->emission.texture != nullptr) {
-        material->emission.energy = 1.0f;
-    }
+    /* --- Load emission color --- */
 
     aiColor4D emissionColor;
     if (aiMat->Get(AI_MATKEY_COLOR_EMISSIVE, emissionColor) == AI_SUCCESS) {
@@ -108,9 +104,7 @@ inline void MaterialImporter::LoadMaterial(NX_Material* material, int index)
         material->emission.energy = 1.0f;
     }
 
-    /* --- Load ORM map --- */
-
-    material->orm.texture = mTextureLoader.Get(index, TextureLoader::MAP_ORM);
+    /* --- Load ORM factors --- */
 
     float roughness;
     if (aiMat->Get(AI_MATKEY_ROUGHNESS_FACTOR, roughness) == AI_SUCCESS) {
@@ -122,14 +116,11 @@ inline void MaterialImporter::LoadMaterial(NX_Material* material, int index)
         material->orm.metalness = metalness;
     }
 
-    /* --- Load normal map --- */
+    /* --- Load normal scale --- */
 
-    material->normal.texture = mTextureLoader.Get(index, TextureLoader::MAP_NORMAL);
-    if (material->normal.texture != nullptr) {
-        float normalScale;
-        if (aiMat->Get(AI_MATKEY_BUMPSCALING, normalScale) == AI_SUCCESS) {
-            material->normal.scale = normalScale;
-        }
+    float normalScale;
+    if (aiMat->Get(AI_MATKEY_BUMPSCALING, normalScale) == AI_SUCCESS) {
+        material->normal.scale = normalScale;
     }
 
     /* --- Handle glTF alpha cutoff --- */
@@ -184,6 +175,22 @@ inline void MaterialImporter::LoadMaterial(NX_Material* material, int index)
     }
 }
 
+/* === Private Material === */
+
+inline void MaterialImporter::LoadMaterial(NX_Material* material, int index)
+{
+    LoadParameters(material, index);
+
+    material->albedo.texture = mTextureLoader.Get(index, TextureLoader::MAP_ALBEDO);
+    material->emission.texture = mTextureLoader.Get(index, TextureLoader::MAP_EMISSION);
+    material->orm.texture = mTextureLoader.Get(index, TextureLoader::MAP_ORM);
+    material->normal.texture = mTextureLoader.Get(index, TextureLoader::MAP_NORMAL);
+
+    if (material->emission.texture != nullptr) {
+        material->emission.energy = 1.0f;
+    }
+}
+
 } // namespace import
 
 #endif // NX_IMPORT_MATERIAL_IMPORTER_HPP
@@ -3,6 +3,10 @@
 
 #include <NX/NX_Model.h>
 
+#include "../Detail/Util/DynamicArray.hpp"
+#include "../Detail/Util/FixedArray.hpp"
+#include "../Detail/Util/Ranges.hpp"
+#include "../INX_JobSystem.hpp"
 #include "./SceneImporter.hpp"
 #include "./AssimpHelper.hpp"
 #include "NX/NX_Mesh.h"
@@ -12,6 +16,8 @@
 #include <assimp/mesh.h>
 #include <float.h>
 
+#include <atomic>
+
 namespace import {
 
 /* === Declaration === */
@@ -24,13 +30,28 @@ public:
     /** Loads the meshes and stores them in the specified model */
     bool LoadMeshes(NX_Model* model);
 
+    /** Processes the meshes in parallel on the CPU only, arrays must have room for the scene mesh count */
+    bool LoadMeshData(NX_MeshData* meshes, NX_BoundingBox3D* aabbs, int* meshMaterials);
+
+private:
+    struct Entry {
+        const aiMesh* mesh;
+        NX_Mat4 transform;
+    };
+
 private:
-    /** Iterate through all nodes to load meshes */
-    bool LoadRecursive(NX_Model* model, const aiNode* node, const NX_Mat4& parentTransform);
+    /** Gathers the scene meshes with their global transform, indexed like the scene meshes */
+    util::DynamicArray<Entry> GatherEntries() const;
+
+    /** Iterate through all nodes, 'fn' is called for each mesh with its global transform */
+    template <typename F>
+    bool LoadRecursive(const aiNode* node, const NX_Mat4& parentTransform, F&& fn) const;
+
+    /** Converts a mesh into CPU-side mesh data */
+    bool ProcessMesh(NX_MeshData* data, NX_BoundingBox3D* aabb, const aiMesh* mesh, const NX_Mat4& transform);
 
-    /** Loads a mesh into memory */
     template <bool HasBones>
-    NX_Mesh* LoadMesh(const aiMesh* mesh, const NX_Mat4& transform);
+    bool ProcessMesh(NX_MeshData* data, NX_BoundingBox3D* aabb, const aiMesh* mesh, const NX_Mat4& transform);
 
 private:
     const SceneImporter& mImporter;
@@ -61,7 +82,65 @@ inline bool MeshImporter::LoadMeshes(NX_Model* model)
         return false;
     }
 
-    if (!LoadRecursive(model, mImporter.GetRootNode(), NX_MAT4_IDENTITY)) {
+    /* --- Process all meshes on the job system, then upload them on the main thread --- */
+
+    util::DynamicArray<NX_MeshData> data(model->meshCount);
+    util::DynamicArray<NX_BoundingBox3D> aabbs(model->meshCount);
+
+    bool success = true;
+
+    if (INX_Jobs.IsMainThread())
+    {
+        // Each upload is a main thread task depending on the conversion of its mesh,
+        // so the first meshes are uploaded while the others are still being converted
+        util::DynamicArray<Entry> entries = GatherEntries();
+        util::FixedArray<INX_JobCounter> converted(model->meshCount, model->meshCount);
+        INX_JobCounter uploaded;
+
+        std::atomic<bool> valid(true);
+
+        for (int i = 0; i < model->meshCount; i++)
+        {
+            INX_Jobs.Submit([&, i]() {
+                const Entry& entry = entries[i];
+                if (entry.mesh == nullptr) return;
+                model->meshMaterials[i] = entry.mesh->mMaterialIndex;
+                if (!ProcessMesh(&data[i], &aabbs[i], entry.mesh, entry.transform)) {
+                    NX_LOG(E, "RENDER: Unable to load mesh [%d]; The model will be invalid", i);
+                    valid = false;
+                }
+            }, &converted[i]);
+
+            INX_Jobs.SubmitMain([&, i]() {
+                if (!valid) return;
+                model->meshes[i] = NX_CreateMesh(NX_PRIMITIVE_TRIANGLES, &data[i], &aabbs[i]);
+                if (model->meshes[i] == nullptr) valid = false;
+            }, &uploaded, &converted[i]);
+        }
+
+        INX_Jobs.Wait(uploaded);
+
+        for (int i = 0; i < model->meshCount; i++) {
+            INX_Jobs.Wait(converted[i]);
+        }
+
+        success = valid;
+    }
+    else
+    {
+        success = LoadMeshData(data.GetData(), aabbs.GetData(), model->meshMaterials);
+
+        for (int i = 0; success && i < model->meshCount; i++) {
+            model->meshes[i] = NX_CreateMesh(NX_PRIMITIVE_TRIANGLES, &data[i], &aabbs[i]);
+            success = (model->meshes[i] != nullptr);
+        }
+    }
+
+    for (NX_MeshData& meshData : data) {
+        NX_DestroyMeshData(&meshData);
+    }
+
+    if (!success) {
         for (int i = 0; i < model->meshCount; i++) {
             NX_DestroyMesh(model->meshes[i]);
         }
@@ -81,9 +160,48 @@ inline bool MeshImporter::LoadMeshes(NX_Model* model)
     return true;
 }
 
+inline bool MeshImporter::LoadMeshData(NX_MeshData* meshes, NX_BoundingBox3D* aabbs, int* meshMaterials)
+{
+    util::DynamicArray<Entry> entries = GatherEntries();
+
+    /* --- Process the meshes in parallel --- */
+
+    std::atomic<bool> success(true);
+
+    INX_Jobs.ParallelFor(static_cast<int>(entries.GetSize()), 1, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            const Entry& entry = entries[i];
+            if (entry.mesh == nullptr) continue;
+            meshMaterials[i] = entry.mesh->mMaterialIndex;
+            if (!ProcessMesh(&meshes[i], &aabbs[i], entry.mesh, entry.transform)) {
+                NX_LOG(E, "RENDER: Unable to load mesh [%d]; The model will be invalid", i);
+                success = false;
+            }
+        }
+    });
+
+    return success;
+}
+
 /* === Private Implementation === */
 
-inline bool MeshImporter::LoadRecursive(NX_Model* model, const aiNode* node, const NX_Mat4& parentTransform)
+inline util::DynamicArray<MeshImporter::Entry> MeshImporter::GatherEntries() const
+{
+    // NOTE: A mesh referenced by several nodes keeps the transform of the last one
+    util::DynamicArray<Entry> entries(mImporter.GetScene()->mNumMeshes, Entry{ nullptr, NX_MAT4_IDENTITY });
+
+    LoadRecursive(mImporter.GetRootNode(), NX_MAT4_IDENTITY,
+        [&](uint32_t meshIndex, const aiMesh* mesh, const NX_Mat4& transform) {
+            entries[meshIndex] = Entry{ mesh, transform };
+            return true;
+        }
+    );
+
+    return entries;
+}
+
+template <typename F>
+bool MeshImporter::LoadRecursive(const aiNode* node, const NX_Mat4& parentTransform, F&& fn) const
 {
     NX_Mat4 localTransform = AssimpCast<NX_Mat4>(node->mTransformation);
     NX_Mat4 globalTransform = NX_Mat4Mul(&localTransform, &parentTransform);
@@ -91,25 +209,14 @@ inline bool MeshImporter::LoadRecursive(NX_Model* model, const aiNode* node, con
     for (uint32_t i = 0; i < node->mNumMeshes; i++)
     {
         uint32_t meshIndex = node->mMeshes[i];
-        const aiMesh* mesh = mImporter.GetMesh(meshIndex);
-
-        model->meshMaterials[meshIndex] = mesh->mMaterialIndex;
-
-        if (mesh->mNumBones) {
-            model->meshes[meshIndex] = LoadMesh<true>(mesh, globalTransform);
-        }
-        else {
-            model->meshes[meshIndex] = LoadMesh<false>(mesh, globalTransform);
-        }
-
-        if (model->meshes[meshIndex] == nullptr) {
-            NX_LOG(E, "RENDER: Unable to load mesh [%d]; The model will be invalid", node->mMeshes[i]);
+        if (!fn(meshIndex, mImporter.GetMesh(meshIndex), globalTransform)) {
+            NX_LOG(E, "RENDER: Unable to load mesh [%d]; The model will be invalid", meshIndex);
             return false;
         }
     }
 
     for (uint32_t i = 0; i < node->mNumChildren; i++) {
-        if(!LoadRecursive(model, node->mChildren[i], globalTransform)) {
+        if(!LoadRecursive(node->mChildren[i], globalTransform, fn)) {
             return false;
         }
     }
@@ -117,21 +224,29 @@ inline bool MeshImporter::LoadRecursive(NX_Model* model, const aiNode* node, con
     return true;
 }
 
+inline bool MeshImporter::ProcessMesh(NX_MeshData* data, NX_BoundingBox3D* aabb, const aiMesh* mesh, const NX_Mat4& transform)
+{
+    if (mesh != nullptr && mesh->mNumBones) {
+        return ProcessMesh<true>(data, aabb, mesh, transform);
+    }
+    return ProcessMesh<false>(data, aabb, mesh, transform);
+}
+
 template <bool HasBones>
-NX_Mesh* MeshImporter::LoadMesh(const aiMesh* mesh, const NX_Mat4& transform)
+bool MeshImporter::ProcessMesh(NX_MeshData* out, NX_BoundingBox3D* outAABB, const aiMesh* mesh, const NX_Mat4& transform)
 {
     /* --- Validate input parameters --- */
 
     if (!mesh) {
         NX_LOG(E, "RENDER: Invalid parameters during assimp mesh processing");
-        return nullptr;
+        return false;
     }
 
     /* --- Validate mesh data presence --- */
 
     if (mesh->mNumVertices == 0 || mesh->mNumFaces == 0) {
         NX_LOG(E, "RENDER: Empty mesh detected during assimp mesh processing");
-        return nullptr;
+        return false;
     }
 
     /* --- Allocate vertex and index buffers --- */
@@ -142,7 +257,7 @@ NX_Mesh* MeshImporter::LoadMesh(const aiMesh* mesh, const NX_Mat4& transform)
     NX_MeshData data = NX_CreateMeshData(vertexCount, indexCount);
     if (!data.vertices || !data.indices) {
         NX_LOG(E, "RENDER: Failed to load mesh; Unable to allocate mesh data");
-        return nullptr;
+        return false;
     }
 
     /* --- Initialize bounding box --- */
@@ -331,13 +446,13 @@ NX_Mesh* MeshImporter::LoadMesh(const aiMesh* mesh, const NX_Mat4& transform)
         if (face->mNumIndices != 3) {
             NX_LOG(E, "RENDER: Non-triangular face detected (indices: %u)", face->mNumIndices);
             NX_DestroyMeshData(&data);
-            return nullptr;
+            return false;
         }
         for (uint32_t j = 0; j < 3; j++) {
             if (face->mIndices[j] >= mesh->mNumVertices) {
                 NX_LOG(E, "RENDER: Invalid vertex index (%u >= %u)", face->mIndices[j], mesh->mNumVertices);
                 NX_DestroyMeshData(&data);
-                return nullptr;
+                return false;
             }
         }
         data.indices[indexOffset++] = face->mIndices[0];
@@ -350,14 +465,15 @@ NX_Mesh* MeshImporter::LoadMesh(const aiMesh* mesh, const NX_Mat4& transform)
     if (indexOffset != indexCount) {
         NX_LOG(E, "RENDER: Inconsistency in the number of indices (%zu != %zu)", indexOffset, indexCount);
         NX_DestroyMeshData(&data);
-        return nullptr;
+        return false;
     }
 
-    /* --- Create the mesh in the pool and return it --- */
+    /* --- Transfer ownership of the mesh data --- */
+
+    *out = data;
+    *outAABB = aabb;
 
-    NX_Mesh* modelMesh = NX_CreateMesh(NX_PRIMITIVE_TRIANGLES, &data, &aabb);
-    NX_DestroyMeshData(&data);
-    return modelMesh;
+    return true;
 }
 
 } // namespace import
@@ -0,0 +1,863 @@
+/* ModelCache.hpp -- Reader and writer of Nexium's binary model cache (.nxm)
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_IMPORT_MODEL_CACHE_HPP
+#define NX_IMPORT_MODEL_CACHE_HPP
+
+#include <NX/NX_Filesystem.h>
+#include <NX/NX_Animation.h>
+#include <NX/NX_Skeleton.h>
+#include <NX/NX_Texture.h>
+#include <NX/NX_Memory.h>
+#include <NX/NX_Model.h>
+#include <NX/NX_Image.h>
+
+#include "../Detail/Util/DynamicArray.hpp"
+#include "../INX_GlobalPool.hpp"
+#include "../NX_Texture.hpp"
+#include "../INX_Utils.hpp"
+
+#include "./AnimationImporter.hpp"
+#include "./MaterialImporter.hpp"
+#include "./SkeletonImporter.hpp"
+#include "./SceneImporter.hpp"
+#include "./TextureLoader.hpp"
+#include "./MeshImporter.hpp"
+
+#include <SDL3/SDL_assert.h>
+#include <unordered_map>
+#include <float.h>
+
+namespace import {
+
+/* === File Layout === */
+
+/**
+ * The cache is a single block addressed by absolute offsets, every array is
+ * aligned on 16 bytes so that it can be consumed in place once the file is in
+ * memory. Vertices are stored in the NX_Vertex3D layout and images in their
+ * decoded pixel format, or block compressed when requested at write time,
+ * which allows them to be sent to the GPU as is.
+ *
+ * Data is stored in the native layout of the platform; the header records the
+ * vertex size and format version so that a stale cache is rejected, not misread.
+ */
+namespace nxm {
+
+constexpr char Magic[4] = { 'N', 'X', 'M', '\0' };
+constexpr uint32_t Version = 2;
+constexpr uint64_t Alignment = 16;
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t vertexSize;            //< sizeof(NX_Vertex3D) at write time
+    uint32_t meshCount;
+    uint32_t materialCount;
+    uint32_t boneCount;
+    uint32_t animationCount;
+    uint32_t reserved;
+    NX_BoundingBox3D aabb;
+    uint64_t meshOffset;            //< nxm::Mesh[meshCount]
+    uint64_t materialOffset;        //< nxm::Material[materialCount]
+    uint64_t skeletonOffset;        //< nxm::Skeleton, zero if there is no skeleton
+    uint64_t animationOffset;       //< nxm::Animation[animationCount]
+};
+
+struct Mesh {
+    uint64_t vertexOffset;          //< NX_Vertex3D[vertexCount]
+    uint64_t indexOffset;           //< uint32_t[indexCount], zero if not indexed
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    int32_t material;
+    uint32_t primitiveType;
+    NX_BoundingBox3D aabb;
+};
+
+struct Texture {
+    uint64_t pixelOffset;           //< Zero if the material has no texture for this map
+    uint64_t pixelSize;
+    uint64_t key;                   //< Source key, see TextureLoader, used to share the texture once loaded
+    int32_t width;
+    int32_t height;
+    uint32_t format;                //< NX_PixelFormat
+    uint32_t wrap;                  //< NX_TextureWrap
+};
+
+struct Material {
+    Texture maps[TextureLoader::MAP_COUNT];
+    NX_Color albedoColor;
+    NX_Color emissionColor;
+    float emissionEnergy;
+    float aoLightAffect;
+    float occlusion;
+    float roughness;
+    float metalness;
+    float normalScale;
+    float alphaCutOff;
+    uint32_t shading;
+    uint32_t blend;
+    uint32_t cull;
+};
+
+struct Skeleton {
+    uint64_t bonesOffset;           //< NX_BoneInfo[boneCount]
+    uint64_t boneOffsetsOffset;     //< NX_Mat4[boneCount]
+    uint64_t bindLocalOffset;       //< NX_Mat4[boneCount]
+    uint64_t bindPoseOffset;        //< NX_Mat4[boneCount]
+};
+
+struct Animation {
+    char name[32];
+    float ticksPerSecond;
+    float duration;
+    int32_t boneCount;
+    uint32_t channelCount;
+    uint64_t channelOffset;         //< nxm::Channel[channelCount]
+};
+
+struct Channel {
+    uint64_t positionOffset;        //< NX_Vec3Key[positionKeyCount]
+    uint64_t rotationOffset;        //< NX_QuatKey[rotationKeyCount]
+    uint64_t scaleOffset;           //< NX_Vec3Key[scaleKeyCount]
+    uint32_t positionKeyCount;
+    uint32_t rotationKeyCount;
+    uint32_t scaleKeyCount;
+    int32_t boneIndex;
+};
+
+} // namespace nxm
+
+/* === Declaration === */
+
+class ModelCacheWriter {
+public:
+    /** Constructors, 8-bit images are block compressed if 'compressTextures' is set */
+    ModelCacheWriter(const SceneImporter& importer, bool compressTextures = false);
+
+    /** Converts the imported scene and writes it to the given path */
+    bool Save(const char* filePath);
+
+private:
+    /** Sections writing */
+    bool WriteMeshes();
+    bool WriteMaterials();
+    bool WriteSkeleton();
+    bool WriteAnimations();
+
+    /** Raw storage, returned offsets are aligned and remain valid after growth */
+    uint64_t Allocate(size_t size);
+    uint64_t Write(const void* data, size_t size);
+
+    template <typename T>
+    T* At(uint64_t offset);
+
+private:
+    const SceneImporter& mImporter;
+    util::DynamicArray<uint8_t> mData;
+    bool mCompressTextures;
+};
+
+class ModelCacheReader {
+public:
+    /** Constructors */
+    ModelCacheReader(const void* data, size_t size);
+
+    /** Returns true if the data starts with an .nxm header, valid or not */
+    static bool IsCache(const void* data, size_t size);
+
+    /** Loading functions, data is consumed in place */
+    NX_Model* LoadModel();
+    NX_Skeleton* LoadSkeleton();
+    NX_AnimationLib* LoadAnimationLib();
+
+    /** Get info */
+    bool IsValid() const;
+
+private:
+    /** Loads a material and its textures */
+    void LoadMaterial(NX_Material* material, const nxm::Material& src);
+    NX_Texture* LoadTexture(const nxm::Texture& src);
+
+    /** Bounds checked access, returns nullptr if the range is not within the file */
+    template <typename T>
+    const T* Get(uint64_t offset, uint64_t count = 1) const;
+
+private:
+    const uint8_t* mData;
+    size_t mSize;
+    const nxm::Header* mHeader;
+};
+
+/* === Public Implementation - Writer === */
+
+inline ModelCacheWriter::ModelCacheWriter(const SceneImporter& importer, bool compressTextures)
+    : mImporter(importer), mCompressTextures(compressTextures)
+{
+    SDL_assert(importer.IsValid());
+}
+
+inline bool ModelCacheWriter::Save(const char* filePath)
+{
+    mData.Clear();
+
+    /* --- Reserve the header, filled by each section --- */
+
+    uint64_t headerOffset = Allocate(sizeof(nxm::Header));
+    SDL_assert(headerOffset == 0);
+
+    nxm::Header* header = At<nxm::Header>(headerOffset);
+    SDL_memcpy(header->magic, nxm::Magic, sizeof(nxm::Magic));
+    header->version = nxm::Version;
+    header->vertexSize = sizeof(NX_Vertex3D);
+
+    /* --- Write all sections --- */
+
+    if (!WriteMeshes() || !WriteMaterials() || !WriteSkeleton() || !WriteAnimations()) {
+        NX_LOG(E, "RENDER: Failed to build model cache '%s'", filePath);
+        return false;
+    }
+
+    /* --- Write the file --- */
+
+    if (!NX_WriteFile(filePath, mData.GetData(), mData.GetSize())) {
+        NX_LOG(E, "RENDER: Failed to write model cache '%s'", filePath);
+        return false;
+    }
+
+    NX_LOG(V, "RENDER: Model cache '%s' written (%zu bytes)", filePath, mData.GetSize());
+
+    return true;
+}
+
+/* === Private Implementation - Writer === */
+
+inline bool ModelCacheWriter::WriteMeshes()
+{
+    const int meshCount = mImporter.GetMeshCount();
+
+    /* --- Process meshes on the CPU --- */
+
+    util::DynamicArray<NX_MeshData> meshes;
+    util::DynamicArray<NX_BoundingBox3D> aabbs;
+    util::DynamicArray<int> materials;
+
+    if (!meshes.Resize(meshCount) || !aabbs.Resize(meshCount) || !materials.Resize(meshCount)) {
+        NX_LOG(E, "RENDER: Unable to allocate memory for cached meshes");
+        return false;
+    }
+
+    bool success = MeshImporter(mImporter).LoadMeshData(
+        meshes.GetData(), aabbs.GetData(), materials.GetData()
+    );
+
+    /* --- Write mesh records and their data --- */
+
+    if (success)
+    {
+        uint64_t meshOffset = Allocate(meshCount * sizeof(nxm::Mesh));
+
+        NX_BoundingBox3D modelAABB;
+        modelAABB.min = NX_VEC3(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+        modelAABB.max = NX_VEC3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+        for (int i = 0; i < meshCount; i++)
+        {
+            const NX_MeshData& data = meshes[i];
+
+            nxm::Mesh mesh{};
+            mesh.vertexCount = data.vertexCount;
+            mesh.indexCount = data.indexCount;
+            mesh.material = materials[i];
+            mesh.primitiveType = NX_PRIMITIVE_TRIANGLES;
+            mesh.aabb = aabbs[i];
+
+            mesh.vertexOffset = Write(data.vertices, data.vertexCount * sizeof(NX_Vertex3D));
+            if (data.indexCount > 0) {
+                mesh.indexOffset = Write(data.indices, data.indexCount * sizeof(uint32_t));
+            }
+
+            *At<nxm::Mesh>(meshOffset + i * sizeof(nxm::Mesh)) = mesh;
+
+            modelAABB.min = NX_Vec3Min(modelAABB.min, mesh.aabb.min);
+            modelAABB.max = NX_Vec3Max(modelAABB.max, mesh.aabb.max);
+        }
+
+        nxm::Header* header = At<nxm::Header>(0);
+        header->meshCount = meshCount;
+        header->meshOffset = meshOffset;
+        header->aabb = modelAABB;
+    }
+
+    /* --- Release CPU data --- */
+
+    for (int i = 0; i < meshCount; i++) {
+        NX_DestroyMeshData(&meshes[i]);
+    }
+
+    return success;
+}
+
+inline bool ModelCacheWriter::WriteMaterials()
+{
+    const int materialCount = mImporter.GetMaterialCount();
+    const uint64_t materialOffset = Allocate(materialCount * sizeof(nxm::Material));
+
+    /* --- Write material parameters --- */
+
+    MaterialImporter materialImporter(mImporter);
+
+    for (int i = 0; i < materialCount; i++)
+    {
+        NX_Material material{};
+        materialImporter.LoadParameters(&material, i);
+
+        nxm::Material* dst = At<nxm::Material>(materialOffset + i * sizeof(nxm::Material));
+        dst->albedoColor = material.albedo.color;
+        dst->emissionColor = material.emission.color;
+        dst->emissionEnergy = material.emission.energy;
+        dst->aoLightAffect = material.orm.aoLightAffect;
+        dst->occlusion = material.orm.occlusion;
+        dst->roughness = material.orm.roughness;
+        dst->metalness = material.orm.metalness;
+        dst->normalScale = material.normal.scale;
+        dst->alphaCutOff = material.alphaCutOff;
+        dst->shading = material.shading;
+        dst->blend = material.blend;
+        dst->cull = material.cull;
+    }
+
+    /* --- Write decoded images --- */
+
+    // NOTE: Maps sharing the same image reference the same pixels
+    std::unordered_map<uint64_t, nxm::Texture> written;
+
+    auto onRequest = [](int, TextureLoader::Map, uint64_t) {
+        return true;
+    };
+
+    auto onReady = [&](int i, TextureLoader::Map map, uint64_t key, const TextureLoader::Image& img) {
+        if (img.image.pixels == nullptr) {
+            return;
+        }
+
+        auto [it, inserted] = written.try_emplace(key);
+        nxm::Texture& texture = it->second;
+
+        if (inserted) {
+            const NX_Image* image = &img.image;
+            NX_Image compressed{};
+
+            // NOTE: ORM maps have no alpha and tolerate BC1, other maps need the BC7 quality
+            if (mCompressTextures && NX_GetPixelChannelBytes(image->format) == 1) {
+                compressed = NX_CompressImage(image, (map == TextureLoader::MAP_ORM) ? NX_PIXEL_FORMAT_BC1 : NX_PIXEL_FORMAT_BC7);
+                if (compressed.pixels != nullptr) image = &compressed;
+            }
+
+            texture.pixelSize = NX_GetImageDataSize(image->w, image->h, image->format);
+            texture.pixelOffset = Write(image->pixels, texture.pixelSize);
+            texture.key = key;
+            texture.width = image->w;
+            texture.height = image->h;
+            texture.format = image->format;
+            texture.wrap = TextureLoader::GetWrapMode(img.wrap[0]);
+
+            NX_DestroyImage(&compressed);
+        }
+
+        nxm::Material* dst = At<nxm::Material>(materialOffset + i * sizeof(nxm::Material));
+        dst->maps[map] = texture;
+
+        // NOTE: Same rule as MaterialImporter, an emission map enables emission
+        if (map == TextureLoader::MAP_EMISSION) {
+            dst->emissionEnergy = 1.0f;
+        }
+    };
+
+    TextureLoader(mImporter).LoadImages(onRequest, onReady);
+
+    nxm::Header* header = At<nxm::Header>(0);
+    header->materialCount = materialCount;
+    header->materialOffset = materialOffset;
+
+    return true;
+}
+
+inline bool ModelCacheWriter::WriteSkeleton()
+{
+    if (mImporter.GetBoneCount() == 0) {
+        return true;
+    }
+
+    NX_Skeleton* skeleton = SkeletonImporter(mImporter).ProcessSkeleton();
+    if (skeleton == nullptr) {
+        return false;
+    }
+
+    const size_t matSize = skeleton->boneCount * sizeof(NX_Mat4);
+
+    nxm::Skeleton src{};
+    src.bonesOffset = Write(skeleton->bones, skeleton->boneCount * sizeof(NX_BoneInfo));
+    src.boneOffsetsOffset = Write(skeleton->boneOffsets, matSize);
+    src.bindLocalOffset = Write(skeleton->bindLocal, matSize);
+    src.bindPoseOffset = Write(skeleton->bindPose, matSize);
+
+    uint64_t skeletonOffset = Write(&src, sizeof(src));
+
+    nxm::Header* header = At<nxm::Header>(0);
+    header->boneCount = skeleton->boneCount;
+    header->skeletonOffset = skeletonOffset;
+
+    NX_DestroySkeleton(skeleton);
+
+    return true;
+}
+
+inline bool ModelCacheWriter::WriteAnimations()
+{
+    if (mImporter.GetAnimationCount() == 0 || mImporter.GetBoneCount() == 0) {
+        return true;
+    }
+
+    NX_AnimationLib* animLib = AnimationImporter(mImporter).LoadAnimationLib();
+    if (animLib == nullptr) {
+        return false;
+    }
+
+    uint64_t animationOffset = Allocate(animLib->count * sizeof(nxm::Animation));
+
+    for (int i = 0; i < animLib->count; i++)
+    {
+        const NX_Animation& anim = animLib->animations[i];
+
+        nxm::Animation dst{};
+        SDL_memcpy(dst.name, anim.name, sizeof(dst.name));
+        dst.ticksPerSecond = anim.ticksPerSecond;
+        dst.duration = anim.duration;
+        dst.boneCount = anim.boneCount;
+        dst.channelCount = anim.channelCount;
+        dst.channelOffset = Allocate(anim.channelCount * sizeof(nxm::Channel));
+
+        for (uint32_t j = 0; j < anim.channelCount; j++)
+        {
+            const NX_AnimationChannel& channel = anim.channels[j];
+
+            nxm::Channel chan{};
+            chan.positionKeyCount = channel.positionKeyCount;
+            chan.rotationKeyCount = channel.rotationKeyCount;
+            chan.scaleKeyCount = channel.scaleKeyCount;
+            chan.boneIndex = channel.boneIndex;
+
+            if (channel.positionKeyCount > 0) {
+                chan.positionOffset = Write(channel.positionKeys, channel.positionKeyCount * sizeof(NX_Vec3Key));
+            }
+            if (channel.rotationKeyCount > 0) {
+                chan.rotationOffset = Write(channel.rotationKeys, channel.rotationKeyCount * sizeof(NX_QuatKey));
+            }
+            if (channel.scaleKeyCount > 0) {
+                chan.scaleOffset = Write(channel.scaleKeys, channel.scaleKeyCount * sizeof(NX_Vec3Key));
+            }
+
+            *At<nxm::Channel>(dst.channelOffset + j * sizeof(nxm::Channel)) = chan;
+        }
+
+        *At<nxm::Animation>(animationOffset + i * sizeof(nxm::Animation)) = dst;
+    }
+
+    nxm::Header* header = At<nxm::Header>(0);
+    header->animationCount = animLib->count;
+    header->animationOffset = animationOffset;
+
+    NX_DestroyAnimationLib(animLib);
+
+    return true;
+}
+
+inline uint64_t ModelCacheWriter::Allocate(size_t size)
+{
+    const uint64_t offset = (mData.GetSize() + nxm::Alignment - 1) & ~(nxm::Alignment - 1);
+    const size_t required = offset + size;
+
+    // NOTE: Resize() only grows to the exact size, grow geometrically here
+    if (required > mData.GetCapacity()) {
+        if (!mData.Reserve(std::max(required, 2 * mData.GetCapacity()))) {
+            NX_LOG(E, "RENDER: Unable to grow model cache buffer to %zu bytes", required);
+            SDL_assert(false);
+        }
+    }
+
+    mData.Resize(required); //< Zero fills padding and reserved space
+    return offset;
+}
+
+inline uint64_t ModelCacheWriter::Write(const void* data, size_t size)
+{
+    uint64_t offset = Allocate(size);
+    if (size > 0) SDL_memcpy(mData.GetData() + offset, data, size);
+    return offset;
+}
+
+template <typename T>
+T* ModelCacheWriter::At(uint64_t offset)
+{
+    SDL_assert(offset + sizeof(T) <= mData.GetSize());
+    return reinterpret_cast<T*>(mData.GetData() + offset);
+}
+
+/* === Public Implementation - Reader === */
+
+inline ModelCacheReader::ModelCacheReader(const void* data, size_t size)
+    : mData(static_cast<const uint8_t*>(data)), mSize(size), mHeader(nullptr)
+{
+    if (!IsCache(data, size) || size < sizeof(nxm::Header)) {
+        NX_LOG(E, "RENDER: Invalid model cache; Missing or truncated header");
+        return;
+    }
+
+    const nxm::Header* header = reinterpret_cast<const nxm::Header*>(mData);
+
+    if (header->version != nxm::Version) {
+        NX_LOG(E, "RENDER: Model cache version mismatch (%u != %u); The cache must be regenerated", header->version, nxm::Version);
+        return;
+    }
+
+    if (header->vertexSize != sizeof(NX_Vertex3D)) {
+        NX_LOG(E, "RENDER: Model cache vertex layout mismatch; The cache must be regenerated");
+        return;
+    }
+
+    mHeader = header;
+}
+
+inline bool ModelCacheReader::IsCache(const void* data, size_t size)
+{
+    return data != nullptr && size >= sizeof(nxm::Magic)
+        && SDL_memcmp(data, nxm::Magic, sizeof(nxm::Magic)) == 0;
+}
+
+inline NX_Model* ModelCacheReader::LoadModel()
+{
+    if (!IsValid()) {
+        return nullptr;
+    }
+
+    const nxm::Mesh* meshes = Get<nxm::Mesh>(mHeader->meshOffset, mHeader->meshCount);
+    const nxm::Material* materials = Get<nxm::Material>(mHeader->materialOffset, mHeader->materialCount);
+    if (!meshes || !materials) {
+        NX_LOG(E, "RENDER: Invalid model cache; Corrupted mesh or material table");
+        return nullptr;
+    }
+
+    NX_Model* model = INX_Pool.Create<NX_Model>();
+    if (model == nullptr) {
+        NX_LOG(E, "RENDER: Failed to load model; Object pool issue");
+        return nullptr;
+    }
+
+    /* --- Allocate model arrays --- */
+
+    model->meshes = NX_Calloc<NX_Mesh*>(mHeader->meshCount);
+    model->meshMaterials = NX_Calloc<int>(mHeader->meshCount);
+    model->materials = NX_Calloc<NX_Material>(mHeader->materialCount);
+
+    if (!model->meshes || !model->meshMaterials || (!model->materials && mHeader->materialCount > 0)) {
+        NX_LOG(E, "RENDER: Unable to allocate memory for model arrays; The model will be invalid");
+        NX_DestroyModel(model);
+        return nullptr;
+    }
+
+    model->meshCount = mHeader->meshCount;
+    model->materialCount = mHeader->materialCount;
+    model->aabb = mHeader->aabb;
+
+    /* --- Create meshes directly from the cached buffers --- */
+
+    for (uint32_t i = 0; i < mHeader->meshCount; i++)
+    {
+        const nxm::Mesh& src = meshes[i];
+
+        const NX_Vertex3D* vertices = Get<NX_Vertex3D>(src.vertexOffset, src.vertexCount);
+        const uint32_t* indices = Get<uint32_t>(src.indexOffset, src.indexCount);
+
+        if (!vertices || (src.indexCount > 0 && !indices) || src.material < 0 || static_cast<uint32_t>(src.material) >= mHeader->materialCount) {
+            NX_LOG(E, "RENDER: Invalid model cache; Corrupted mesh [%u]", i);
+            NX_DestroyModel(model);
+            return nullptr;
+        }
+
+        // NOTE: The data is only read by NX_CreateMesh, it is not modified
+        NX_MeshData data{};
+        data.vertices = const_cast<NX_Vertex3D*>(vertices);
+        data.indices = src.indexCount > 0 ? const_cast<uint32_t*>(indices) : nullptr;
+        data.vertexCount = src.vertexCount;
+        data.indexCount = src.indexCount;
+
+        model->meshes[i] = NX_CreateMesh(static_cast<NX_PrimitiveType>(src.primitiveType), &data, &src.aabb);
+        model->meshMaterials[i] = src.material;
+
+        if (model->meshes[i] == nullptr) {
+            NX_DestroyModel(model);
+            return nullptr;
+        }
+    }
+
+    /* --- Create materials and upload their images --- */
+
+    for (uint32_t i = 0; i < mHeader->materialCount; i++) {
+        LoadMaterial(&model->materials[i], materials[i]);
+    }
+
+    /* --- Load skeleton --- */
+
+    model->skeleton = LoadSkeleton();
+
+    return model;
+}
+
+inline NX_Skeleton* ModelCacheReader::LoadSkeleton()
+{
+    if (!IsValid() || mHeader->boneCount == 0) {
+        return nullptr;
+    }
+
+    const uint32_t boneCount = mHeader->boneCount;
+
+    const nxm::Skeleton* src = Get<nxm::Skeleton>(mHeader->skeletonOffset);
+    if (src == nullptr) {
+        NX_LOG(E, "RENDER: Invalid model cache; Corrupted skeleton");
+        return nullptr;
+    }
+
+    const NX_BoneInfo* bones = Get<NX_BoneInfo>(src->bonesOffset, boneCount);
+    const NX_Mat4* boneOffsets = Get<NX_Mat4>(src->boneOffsetsOffset, boneCount);
+    const NX_Mat4* bindLocal = Get<NX_Mat4>(src->bindLocalOffset, boneCount);
+    const NX_Mat4* bindPose = Get<NX_Mat4>(src->bindPoseOffset, boneCount);
+
+    if (!bones || !boneOffsets || !bindLocal || !bindPose) {
+        NX_LOG(E, "RENDER: Invalid model cache; Corrupted skeleton");
+        return nullptr;
+    }
+
+    /* --- Copy bone arrays, the skeleton owns them --- */
+
+    NX_Skeleton* skeleton = INX_Pool.Create<NX_Skeleton>();
+    if (skeleton == nullptr) {
+        return nullptr;
+    }
+
+    skeleton->bones = NX_Malloc<NX_BoneInfo>(boneCount);
+    skeleton->boneOffsets = NX_Malloc<NX_Mat4>(boneCount);
+    skeleton->bindLocal = NX_Malloc<NX_Mat4>(boneCount);
+    skeleton->bindPose = NX_Malloc<NX_Mat4>(boneCount);
+    skeleton->boneCount = boneCount;
+
+    if (!skeleton->bones || !skeleton->boneOffsets || !skeleton->bindLocal || !skeleton->bindPose) {
+        NX_LOG(E, "RENDER: Failed to allocate memory for skeleton bones");
+        NX_DestroySkeleton(skeleton);
+        return nullptr;
+    }
+
+    SDL_memcpy(skeleton->bones, bones, boneCount * sizeof(NX_BoneInfo));
+    SDL_memcpy(skeleton->boneOffsets, boneOffsets, boneCount * sizeof(NX_Mat4));
+    SDL_memcpy(skeleton->bindLocal, bindLocal, boneCount * sizeof(NX_Mat4));
+    SDL_memcpy(skeleton->bindPose, bindPose, boneCount * sizeof(NX_Mat4));
+
+    return skeleton;
+}
+
+inline NX_AnimationLib* ModelCacheReader::LoadAnimationLib()
+{
+    if (!IsValid()) {
+        return nullptr;
+    }
+
+    if (mHeader->animationCount == 0) {
+        NX_LOG(E, "RENDER: No animations found");
+        return nullptr;
+    }
+
+    const nxm::Animation* srcAnims = Get<nxm::Animation>(mHeader->animationOffset, mHeader->animationCount);
+    if (srcAnims == nullptr) {
+        NX_LOG(E, "RENDER: Invalid model cache; Corrupted animation table");
+        return nullptr;
+    }
+
+    NX_AnimationLib* animLib = INX_Pool.Create<NX_AnimationLib>();
+    if (animLib == nullptr) {
+        return nullptr;
+    }
+
+    animLib->animations = NX_Calloc<NX_Animation>(mHeader->animationCount);
+    if (animLib->animations == nullptr) {
+        NX_LOG(E, "RENDER: Unable to allocate memory for animations");
+        INX_Pool.Destroy(animLib);
+        return nullptr;
+    }
+
+    /* --- Copy animations, keys are owned by the library --- */
+
+    // NOTE: 'count' is incremented as animations are completed so that
+    //       NX_DestroyAnimationLib only releases what has been allocated
+
+    for (uint32_t i = 0; i < mHeader->animationCount; i++)
+    {
+        const nxm::Animation& src = srcAnims[i];
+        NX_Animation& anim = animLib->animations[i];
+
+        SDL_memcpy(anim.name, src.name, sizeof(anim.name));
+        anim.name[sizeof(anim.name) - 1] = '\0';
+        anim.ticksPerSecond = src.ticksPerSecond;
+        anim.duration = src.duration;
+        anim.boneCount = src.boneCount;
+
+        const nxm::Channel* channels = Get<nxm::Channel>(src.channelOffset, src.channelCount);
+        anim.channels = NX_Calloc<NX_AnimationChannel>(src.channelCount);
+        if (!channels || !anim.channels) {
+            NX_LOG(E, "RENDER: Failed to load cached animation '%s'", anim.name);
+            NX_Free(anim.channels), anim.channels = nullptr;
+            NX_DestroyAnimationLib(animLib);
+            return nullptr;
+        }
+
+        animLib->count++;
+
+        for (uint32_t j = 0; j < src.channelCount; j++)
+        {
+            const nxm::Channel& srcChan = channels[j];
+            NX_AnimationChannel& chan = anim.channels[j];
+
+            const NX_Vec3Key* positionKeys = Get<NX_Vec3Key>(srcChan.positionOffset, srcChan.positionKeyCount);
+            const NX_QuatKey* rotationKeys = Get<NX_QuatKey>(srcChan.rotationOffset, srcChan.rotationKeyCount);
+            const NX_Vec3Key* scaleKeys = Get<NX_Vec3Key>(srcChan.scaleOffset, srcChan.scaleKeyCount);
+
+            if ((srcChan.positionKeyCount && !positionKeys) ||
+                (srcChan.rotationKeyCount && !rotationKeys) ||
+                (srcChan.scaleKeyCount && !scaleKeys)) {
+                NX_LOG(E, "RENDER: Invalid model cache; Corrupted channel %u of '%s'", j, anim.name);
+                NX_DestroyAnimationLib(animLib);
+                return nullptr;
+            }
+
+            anim.channelCount++;
+            chan.boneIndex = srcChan.boneIndex;
+
+            if (srcChan.positionKeyCount > 0) {
+                chan.positionKeys = NX_Malloc<NX_Vec3Key>(srcChan.positionKeyCount);
+                if (chan.positionKeys) {
+                    SDL_memcpy(chan.positionKeys, positionKeys, srcChan.positionKeyCount * sizeof(NX_Vec3Key));
+                    chan.positionKeyCount = srcChan.positionKeyCount;
+                }
+            }
+
+            if (srcChan.rotationKeyCount > 0) {
+                chan.rotationKeys = NX_Malloc<NX_QuatKey>(srcChan.rotationKeyCount);
+                if (chan.rotationKeys) {
+                    SDL_memcpy(chan.rotationKeys, rotationKeys, srcChan.rotationKeyCount * sizeof(NX_QuatKey));
+                    chan.rotationKeyCount = srcChan.rotationKeyCount;
+                }
+            }
+
+            if (srcChan.scaleKeyCount > 0) {
+                chan.scaleKeys = NX_Malloc<NX_Vec3Key>(srcChan.scaleKeyCount);
+                if (chan.scaleKeys) {
+                    SDL_memcpy(chan.scaleKeys, scaleKeys, srcChan.scaleKeyCount * sizeof(NX_Vec3Key));
+                    chan.scaleKeyCount = srcChan.scaleKeyCount;
+                }
+            }
+        }
+    }
+
+    return animLib;
+}
+
+inline bool ModelCacheReader::IsValid() const
+{
+    return mHeader != nullptr;
+}
+
+/* === Private Implementation - Reader === */
+
+inline void ModelCacheReader::LoadMaterial(NX_Material* material, const nxm::Material& src)
+{
+    *material = NX_GetDefaultMaterial();
+
+    material->albedo.texture = LoadTexture(src.maps[TextureLoader::MAP_ALBEDO]);
+    material->albedo.color = src.albedoColor;
+
+    material->emission.texture = LoadTexture(src.maps[TextureLoader::MAP_EMISSION]);
+    material->emission.color = src.emissionColor;
+    material->emission.energy = src.emissionEnergy;
+
+    material->orm.texture = LoadTexture(src.maps[TextureLoader::MAP_ORM]);
+    material->orm.aoLightAffect = src.aoLightAffect;
+    material->orm.occlusion = src.occlusion;
+    material->orm.roughness = src.roughness;
+    material->orm.metalness = src.metalness;
+
+    material->normal.texture = LoadTexture(src.maps[TextureLoader::MAP_NORMAL]);
+    material->normal.scale = src.normalScale;
+
+    material->alphaCutOff = src.alphaCutOff;
+    material->shading = static_cast<NX_ShadingMode>(src.shading);
+    material->blend = static_cast<NX_BlendMode>(src.blend);
+    material->cull = static_cast<NX_CullMode>(src.cull);
+}
+
+inline NX_Texture* ModelCacheReader::LoadTexture(const nxm::Texture& src)
+{
+    if (src.pixelOffset == 0) {
+        return nullptr;
+    }
+
+    // NOTE: The stored key is the one of TextureLoader, so that textures
+    //       are shared with models imported from their source files
+    const uint64_t key = src.key;
+
+    if (NX_Texture* texture = INX_TextureCache_Acquire(key)) {
+        return texture;
+    }
+
+    const uint8_t* pixels = Get<uint8_t>(src.pixelOffset, src.pixelSize);
+    const uint64_t expected = NX_GetImageDataSize(src.width, src.height, static_cast<NX_PixelFormat>(src.format));
+
+    if (pixels == nullptr || src.width <= 0 || src.height <= 0 || src.pixelSize != expected) {
+        NX_LOG(W, "RENDER: Invalid model cache; Corrupted texture skipped");
+        return nullptr;
+    }
+
+    // NOTE: The image is only read during upload, it is not modified
+    NX_Image image{};
+    image.pixels = const_cast<uint8_t*>(pixels);
+    image.w = src.width;
+    image.h = src.height;
+    image.format = static_cast<NX_PixelFormat>(src.format);
+
+    NX_Texture* texture = NX_CreateTextureFromImageEx(
+        &image, static_cast<NX_TextureWrap>(src.wrap),
+        NX_GetDefaultTextureFilter()
+    );
+
+    if (texture != nullptr) {
+        INX_TextureCache_Insert(key, texture);
+    }
+
+    return texture;
+}
+
+template <typename T>
+const T* ModelCacheReader::Get(uint64_t offset, uint64_t count) const
+{
+    if (offset == 0 || offset > mSize || count > (mSize - offset) / sizeof(T)) {
+        return nullptr;
+    }
+    return reinterpret_cast<const T*>(mData + offset);
+}
+
+} // namespace import
+
+#endif // NX_IMPORT_MODEL_CACHE_HPP
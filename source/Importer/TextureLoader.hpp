@@ -2,6 +2,11 @@
 #define NX_IMPORT_DETAIL_TEXTURE_LOADER_HPP
 
 #include "../Detail/Util/DynamicArray.hpp"
+#include "../Detail/Util/Ranges.hpp"
+#include "../INX_ImageMipmaps.hpp"
+#include "../INX_JobSystem.hpp"
+#include "../NX_Texture.hpp"
+#include "../INX_Utils.hpp"
 #include "./SceneImporter.hpp"
 
 #include <NX/NX_Texture.h>
@@ -14,9 +19,12 @@
 #include <assimp/types.h>
 
 #include <condition_variable>
-#include <thread>
+#include <unordered_map>
+#include <cstring>
+#include <vector>
 #include <queue>
 #include <array>
+#include <bit>
 
 namespace import {
 
@@ -32,18 +40,43 @@ public:
         MAP_COUNT
     };
 
-public:
-    TextureLoader(const SceneImporter& importer);
-    NX_Texture* Get(int materialIndex, Map map);
-
-private:
     /** Temporary image data */
     struct Image {
         aiTextureMapMode wrap[2];
         NX_Image image;
         bool owned;
+        util::DynamicArray<NX_Image> mipmaps;   //< Levels following 'image', always owned
     };
 
+public:
+    /** If 'genMipmaps' is set, mip chains are generated by the decoding jobs when trilinear filtering is used */
+    TextureLoader(const SceneImporter& importer, bool genMipmaps = false);
+
+    /** Decodes all material images and uploads them as textures, shared through the texture cache */
+    void LoadTextures();
+    NX_Texture* Get(int materialIndex, Map map);
+
+    /**
+     * Decodes all material images on the job system without uploading them.
+     *
+     * Each material map with an image is identified by a key computed from its
+     * sources, maps sharing a key are decoded only once.
+     *
+     * 'onRequest(materialIndex, map, key)' is called first on the calling thread,
+     * it returns false if the image is not needed (e.g. already loaded).
+     *
+     * 'onReady(materialIndex, map, key, image)' is then called on the calling thread
+     * for each requested map as its image becomes available, the image is released
+     * once all maps sharing it have been served.
+     */
+    template <typename R, typename F>
+    void LoadImages(R&& onRequest, F&& onReady);
+
+    /** Helpers */
+    static NX_TextureWrap GetWrapMode(aiTextureMapMode wrap);
+    static util::DynamicArray<NX_Image> GetLevels(const Image& image);
+
+private:
     /** Material map array */
     using MaterialTextures = std::array<NX_Texture*, MAP_COUNT>;
     using MaterialImages = std::array<Image, MAP_COUNT>;
@@ -53,126 +86,265 @@ private:
     bool LoadImage(Image* image, const aiMaterial* material, aiTextureType type, uint32_t index, bool asData);
     bool LoadImage(Image* image, const aiMaterial* material, Map map);
 
+    /** Source keys, zero when the material has no image for this map */
+    uint64_t GetImageKey(const aiMaterial* material, Map map);
+    bool GetSourceKey(uint64_t* key, const aiMaterial* material, aiTextureType type, uint32_t index);
+
+    /** Mip chain generation, alpha tested albedo maps preserve their coverage */
+    void GenMipmaps(Image* image, const aiMaterial* material, Map map);
+    static float GetAlphaCutoff(const aiMaterial* material);
+
     /** Loading functions */
     bool LoadImageAlbedo(Image* image, const aiMaterial* material);
     bool LoadImageEmission(Image* image, const aiMaterial* material);
     bool LoadImageORM(Image* image, const aiMaterial* material);
     bool LoadImageNormal(Image* image, const aiMaterial* material);
 
-    /** Helpers */
-    static NX_TextureWrap GetWrapMode(aiTextureMapMode wrap);
-
 private:
     util::DynamicArray<MaterialTextures> mTextures;
     const SceneImporter& mImporter;
+    bool mGenMipmaps;
 };
 
 /* === Public Implementation === */
 
-inline TextureLoader::TextureLoader(const SceneImporter& importer)
-    : mImporter(importer)
+inline TextureLoader::TextureLoader(const SceneImporter& importer, bool genMipmaps)
+    : mImporter(importer), mGenMipmaps(genMipmaps)
+{ }
+
+inline void TextureLoader::LoadTextures()
 {
-    // REVIEW: This is a quick implementation, but it's at least faster than before.
-    //         Note that one of the current big issues is that if two materials use
-    //         the same texture, that texture will be loaded twice. I haven't
-    //         encountered a model where this happens yet, but it is possible!
+    mTextures.Resize(mImporter.GetMaterialCount());
+
+    LoadImages(
+        [this](int i, Map j, uint64_t key) {
+            mTextures[i][j] = INX_TextureCache_Acquire(key);
+            return mTextures[i][j] == nullptr;
+        },
+        [this](int i, Map j, uint64_t key, const Image& img) {
+            // NOTE: Maps sharing an image within this model are served by the cache after the first upload
+            mTextures[i][j] = INX_TextureCache_Acquire(key);
+            if (mTextures[i][j] != nullptr || img.image.pixels == nullptr) {
+                return;
+            }
+            util::DynamicArray<NX_Image> levels = GetLevels(img);
+            mTextures[i][j] = NX_CreateTextureFromMipmaps(
+                levels.GetData(), static_cast<int>(levels.GetSize()),
+                GetWrapMode(img.wrap[0]), NX_GetDefaultTextureFilter()
+            );
+            if (mTextures[i][j] != nullptr) {
+                INX_TextureCache_Insert(key, mTextures[i][j]);
+            }
+        }
+    );
+}
 
-    const int matCount = importer.GetMaterialCount();
-    mTextures.Resize(matCount);
+inline NX_Texture* TextureLoader::Get(int materialIndex, Map map)
+{
+    return mTextures[materialIndex][map];
+}
 
-    /* --- Temporary storage of images --- */
+template <typename R, typename F>
+void TextureLoader::LoadImages(R&& onRequest, F&& onReady)
+{
+    /* --- Collapse the requested maps into one job per image source --- */
 
-    util::DynamicArray<MaterialImages> images;
-    images.Resize(matCount);
+    struct Job {
+        uint64_t key;
+        Image image;
+        util::DynamicArray<int> users;  //< Encoded as 'materialIndex * MAP_COUNT + map'
+    };
 
-    /* --- Thread pool setup --- */
+    util::DynamicArray<Job> jobs;
+    std::unordered_map<uint64_t, size_t> jobByKey;
 
-    const int totalJobs = matCount * MAP_COUNT;
-    std::atomic<int> nextJob(0);
+    const int matCount = mImporter.GetMaterialCount();
 
-    const int numThreads = std::min((unsigned int)std::thread::hardware_concurrency(), (unsigned int)totalJobs);
-    std::vector<std::thread> pool;
-    pool.reserve(numThreads);
+    for (int i = 0; i < matCount; i++) {
+        const aiMaterial* material = mImporter.GetMaterial(i);
+        for (int j = 0; j < MAP_COUNT; j++) {
+            uint64_t key = GetImageKey(material, Map(j));
+            if (key == 0 || !onRequest(i, Map(j), key)) {
+                continue;
+            }
+            auto it = jobByKey.try_emplace(key, jobs.GetSize()).first;
+            if (it->second == jobs.GetSize()) {
+                jobs.PushBack(Job{ .key = key, .image = {}, .users = {} });
+            }
+            jobs[it->second].users.PushBack(i * MAP_COUNT + j);
+        }
+    }
 
-    /* --- Simple queue to store ready image indices --- */
+    /* --- Submit one decoding job per image source --- */
+
+    const int totalJobs = static_cast<int>(jobs.GetSize());
 
     std::mutex readyMutex;
     std::condition_variable readyCV;
-    std::queue<std::pair<int,int>> readyQueue;
+    std::queue<int> readyQueue;
 
-    /* --- Launch loading threads --- */
+    auto decode = [&](int jobIndex) {
+        // NOTE: All users share the same sources, the first one is used to decode
+        Job& job = jobs[jobIndex];
+        int user = job.users[0];
 
-    for (int t = 0; t < numThreads; ++t)
-    {
-        pool.emplace_back([&] {
-            while (true)
-            {
-                int jobIndex = nextJob.fetch_add(1);
-                if (jobIndex >= totalJobs) break;
+        const aiMaterial* material = mImporter.GetMaterial(user / MAP_COUNT);
+        LoadImage(&job.image, material, Map(user % MAP_COUNT));
+        if (mGenMipmaps) {
+            GenMipmaps(&job.image, material, Map(user % MAP_COUNT));
+        }
 
-                int i = jobIndex / MAP_COUNT;
-                int j = jobIndex % MAP_COUNT;
+        // Indicate that the image is ready to be consumed
+        {
+            std::lock_guard<std::mutex> lock(readyMutex);
+            readyQueue.push(jobIndex);
+        }
+        readyCV.notify_one();
+    };
 
-                LoadImage(&images[i][j], importer.GetMaterial(i), Map(j));
+    INX_JobCounter counter;
 
-                // Indicate that the image is ready for upload
-                {
-                    std::lock_guard<std::mutex> lock(readyMutex);
-                    readyQueue.push({i,j});
-                }
-                readyCV.notify_one();
-            }
-        });
+    for (int jobIndex = 0; jobIndex < totalJobs; jobIndex++) {
+        INX_Jobs.Submit([&decode, jobIndex]() { decode(jobIndex); }, &counter);
     }
 
-    /* --- Progressive upload loop --- */
+    /* --- Progressive consumption loop --- */
 
-    int uploadedCount = 0;
-    while (uploadedCount < totalJobs)
+    int consumedCount = 0;
+    while (consumedCount < totalJobs)
     {
-        std::pair<int,int> job;
+        int jobIndex = -1;
         {
             std::unique_lock<std::mutex> lock(readyMutex);
-            readyCV.wait(lock, [&]{ return !readyQueue.empty(); });
-            job = readyQueue.front();
-            readyQueue.pop();
+            if (!readyQueue.empty()) {
+                jobIndex = readyQueue.front();
+                readyQueue.pop();
+            }
         }
 
-        int i = job.first;
-        int j = job.second;
-        auto& img = images[i][j];
-
-        if (img.image.pixels) {
-            mTextures[i][j] = NX_CreateTextureFromImageEx(
-                &img.image, GetWrapMode(img.wrap[0]),
-                NX_GetDefaultTextureFilter()
-            );
-            if (img.owned) {
-                NX_DestroyImage(&img.image);
-                img.image.pixels = nullptr;
-                img.owned = false;
+        // Help decoding while nothing is ready, then wait for the jobs taken by workers
+        if (jobIndex < 0) {
+            if (!INX_Jobs.TryRunJob()) {
+                std::unique_lock<std::mutex> lock(readyMutex);
+                readyCV.wait(lock, [&]{ return !readyQueue.empty(); });
             }
+            continue;
         }
-        else {
-            mTextures[i][j] = nullptr;
+
+        Job& job = jobs[jobIndex];
+        Image& img = job.image;
+
+        for (int user : job.users) {
+            onReady(user / MAP_COUNT, Map(user % MAP_COUNT), job.key, img);
         }
 
-        uploadedCount++;
-    }
+        if (img.owned) {
+            NX_DestroyImage(&img.image);
+            img.image.pixels = nullptr;
+            img.owned = false;
+        }
 
-    /* --- Join threads --- */
+        for (NX_Image& level : img.mipmaps) {
+            NX_DestroyImage(&level);
+        }
+        img.mipmaps.Clear();
 
-    for (std::thread& t : pool) {
-        t.join();
+        consumedCount++;
     }
+
+    /* --- Wait for the last jobs to release the shared state --- */
+
+    INX_Jobs.Wait(counter);
 }
 
-inline NX_Texture* TextureLoader::Get(int materialIndex, Map map)
+/* === Private Implementation === */
+
+inline uint64_t TextureLoader::GetImageKey(const aiMaterial* material, Map map)
 {
-    return mTextures[materialIndex][map];
+    // NOTE: The source selection must follow the same fallbacks as the LoadImageXXX functions
+
+    uint64_t key = 0;
+
+    switch (map) {
+    case MAP_ALBEDO:
+        if (!GetSourceKey(&key, material, aiTextureType_BASE_COLOR, 0)) {
+            GetSourceKey(&key, material, aiTextureType_DIFFUSE, 0);
+        }
+        break;
+    case MAP_EMISSION:
+        GetSourceKey(&key, material, aiTextureType_EMISSIVE, 0);
+        break;
+    case MAP_ORM:
+        {
+            uint64_t occlusion = 0, roughness = 0, metalness = 0;
+            if (!GetSourceKey(&occlusion, material, aiTextureType_AMBIENT_OCCLUSION, 0)) {
+                GetSourceKey(&occlusion, material, aiTextureType_LIGHTMAP, 0);
+            }
+            if (!GetSourceKey(&roughness, material, aiTextureType_DIFFUSE_ROUGHNESS, 0)) {
+                if (GetSourceKey(&roughness, material, aiTextureType_SHININESS, 0)) {
+                    roughness = INX_HashCombine(roughness, aiTextureType_SHININESS);
+                }
+            }
+            bool hasMetalness = GetSourceKey(&metalness, material, aiTextureType_METALNESS, 0);
+            if (!hasMetalness && roughness == 0) {
+                if (GetSourceKey(&roughness, material, AI_MATKEY_GLTF_PBRMETALLICROUGHNESS_METALLICROUGHNESS_TEXTURE)) {
+                    metalness = roughness;
+                }
+            }
+            if (occlusion != 0 || roughness != 0 || metalness != 0) {
+                key = INX_HashCombine(INX_HashCombine(occlusion, roughness), metalness);
+            }
+        }
+        break;
+    case MAP_NORMAL:
+        GetSourceKey(&key, material, aiTextureType_NORMALS, 0);
+        break;
+    case MAP_COUNT:
+        NX_UNREACHABLE();
+        break;
+    }
+
+    // NOTE: The map defines how the image is decoded (color or data),
+    //       and the alpha cutoff how the mip chain of an albedo map is built
+    if (key != 0) {
+        key = INX_HashCombine(key, map);
+        key = INX_HashCombine(key, NX_GetDefaultTextureFilter());
+        if (map == MAP_ALBEDO) {
+            key = INX_HashCombine(key, std::bit_cast<uint32_t>(GetAlphaCutoff(material)));
+        }
+        key += (key == 0); //< Zero is reserved for 'no image'
+    }
+
+    return key;
 }
 
-/* === Private Implementation === */
+inline bool TextureLoader::GetSourceKey(uint64_t* key, const aiMaterial* material, aiTextureType type, uint32_t index)
+{
+    aiString path{};
+    aiTextureMapMode wrap[2]{};
+
+    if (material->GetTexture(type, index, &path, nullptr, nullptr, nullptr, nullptr, wrap) != AI_SUCCESS) {
+        return false;
+    }
+
+    uint64_t hash = 0;
+
+    if (path.data[0] == '*') {
+        // Embedded textures are keyed by content, so that they can be shared across models
+        const aiTexture* aiTex = mImporter.GetTexture(atoi(&path.data[1]));
+        size_t size = (aiTex->mHeight == 0) ? aiTex->mWidth : 4 * aiTex->mWidth * aiTex->mHeight;
+        hash = INX_HashBytes(aiTex->pcData, size);
+        hash = INX_HashCombine(hash, (uint64_t)aiTex->mWidth << 32 | aiTex->mHeight);
+    }
+    else {
+        // External textures are keyed by their path in the virtual file system
+        hash = INX_HashBytes(path.data, SDL_strlen(path.data));
+    }
+
+    *key = INX_HashCombine(hash, wrap[0]);
+
+    return true;
+}
 
 inline bool TextureLoader::LoadImage(Image* image, const aiMaterial* material, aiTextureType type, uint32_t index, bool asData)
 {
@@ -284,8 +456,12 @@ inline bool TextureLoader::LoadImageORM(Image* image, const aiMaterial* material
             AI_MATKEY_GLTF_PBRMETALLICROUGHNESS_METALLICROUGHNESS_TEXTURE, true
         );
         if (retRoughness) {
+            // NOTE: Mipmaps are only generated after composition, the image is shared as is
             retMetalness = retRoughness;
-            imMetalness = imRoughness;
+            imMetalness.wrap[0] = imRoughness.wrap[0];
+            imMetalness.wrap[1] = imRoughness.wrap[1];
+            imMetalness.image = imRoughness.image;
+            imMetalness.owned = imRoughness.owned;
         }
     }
 
@@ -341,6 +517,39 @@ inline bool TextureLoader::LoadImageNormal(Image* image, const aiMaterial* mater
     return LoadImage(image, material, aiTextureType_NORMALS, 0, true);
 }
 
+inline void TextureLoader::GenMipmaps(Image* image, const aiMaterial* material, Map map)
+{
+    const NX_Image& base = image->image;
+
+    if (base.pixels == nullptr || NX_IsPixelFormatCompressed(base.format) ||
+        NX_GetDefaultTextureFilter() != NX_TEXTURE_FILTER_TRILINEAR) {
+        return;
+    }
+
+    // NOTE: Color maps are filtered in linear space, the other maps hold data
+    const bool srgb = (map == MAP_ALBEDO || map == MAP_EMISSION);
+    const float alphaCutoff = (map == MAP_ALBEDO) ? GetAlphaCutoff(material) : 0.0f;
+
+    INX_GenImageMipmaps(base, NX_MIPMAP_FILTER_KAISER, srgb, alphaCutoff, &image->mipmaps);
+}
+
+inline float TextureLoader::GetAlphaCutoff(const aiMaterial* material)
+{
+    aiString alphaMode{};
+    if (material->Get(AI_MATKEY_GLTF_ALPHAMODE, alphaMode) != AI_SUCCESS) {
+        return 0.0f;
+    }
+
+    if (std::strcmp(alphaMode.C_Str(), "MASK") != 0) {
+        return 0.0f;
+    }
+
+    float alphaCutOff = 0.5f; //< glTF default
+    material->Get(AI_MATKEY_GLTF_ALPHACUTOFF, alphaCutOff);
+
+    return alphaCutOff;
+}
+
 inline NX_TextureWrap TextureLoader::GetWrapMode(aiTextureMapMode wrap)
 {
     NX_TextureWrap hpWrap = NX_TEXTURE_WRAP_CLAMP;
@@ -362,6 +571,15 @@ inline NX_TextureWrap TextureLoader::GetWrapMode(aiTextureMapMode wrap)
     return hpWrap;
 }
 
+inline util::DynamicArray<NX_Image> TextureLoader::GetLevels(const Image& image)
+{
+    util::DynamicArray<NX_Image> levels;
+    (void)levels.Reserve(1 + image.mipmaps.GetSize());
+    levels.PushBack(image.image);
+    levels.Insert(levels.End(), image.mipmaps.Begin(), image.mipmaps.End());
+    return levels;
+}
+
 } // import
 
 #endif // NX_IMPORT_DETAIL_TEXTURE_LOADER_HPP
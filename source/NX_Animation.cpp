@@ -12,6 +12,7 @@
 #include <NX/NX_Memory.h>
 
 #include "./Importer/AnimationImporter.hpp"
+#include "./Importer/ModelCache.hpp"
 
 // ============================================================================
 // PUBLIC API
@@ -33,6 +34,10 @@ NX_AnimationLib* NX_LoadAnimationLib(const char* filePath)
 
 NX_AnimationLib* NX_LoadAnimationLibFromData(const void* data, unsigned int size, const char* hint)
 {
+    if (import::ModelCacheReader::IsCache(data, size)) {
+        return import::ModelCacheReader(data, size).LoadAnimationLib();
+    }
+
     import::SceneImporter importer(data, size, hint);
     if (!importer.IsValid()) {
         return nullptr;
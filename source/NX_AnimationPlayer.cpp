@@ -3,6 +3,8 @@
 #include <NX/NX_Math.h>
 
 #include "./INX_GlobalPool.hpp"
+#include "./INX_JobSystem.hpp"
+#include "./NX_Render3D.hpp"
 
 // ============================================================================
 // INTERNAL INTERPOLATION FUNCTIONS
@@ -97,13 +99,12 @@ static const NX_AnimationChannel* INX_FindChannelForBone(const NX_Animation& ani
     return nullptr;
 }
 
-static void INX_ComputePose(NX_AnimationPlayer& player, float totalWeight)
+static void INX_ComputeLocalPose(NX_AnimationPlayer& player, float totalWeight, int boneBegin, int boneEnd)
 {
-    const int boneCount = player.skeleton->boneCount;
     const int animCount = player.animLib->count;
     NX_AnimationState* states = player.states;
 
-    for (int iBone = 0; iBone < boneCount; iBone++)
+    for (int iBone = boneBegin; iBone < boneEnd; iBone++)
     {
         NX_Transform blended{};
         bool isAnimated{false};
@@ -133,7 +134,26 @@ static void INX_ComputePose(NX_AnimationPlayer& player, float totalWeight)
         else {
             player.currentPose[iBone] = player.skeleton->bindLocal[iBone];
         }
+    }
+}
 
+static void INX_ComputePose(NX_AnimationPlayer& player, float totalWeight)
+{
+    // Minimum number of bones per job, smaller skeletons are evaluated on the calling thread
+    static constexpr int BoneGrainSize = 64;
+
+    const int boneCount = player.skeleton->boneCount;
+
+    /* --- Local transforms are independent, they can be evaluated in parallel --- */
+
+    INX_Jobs.ParallelFor(boneCount, BoneGrainSize, [&](int begin, int end) {
+        INX_ComputeLocalPose(player, totalWeight, begin, end);
+    });
+
+    /* --- Hierarchy traversal, parents are always stored before their children --- */
+
+    for (int iBone = 0; iBone < boneCount; iBone++)
+    {
         int parentIdx = player.skeleton->bones[iBone].parent;
         if (parentIdx >= 0) {
             player.currentPose[iBone] = NX_Mat4Mul(&player.currentPose[iBone], &player.currentPose[parentIdx]);
@@ -165,6 +185,8 @@ NX_AnimationPlayer* NX_CreateAnimationPlayer(const NX_Skeleton* skeleton, const
 
 void NX_DestroyAnimationPlayer(NX_AnimationPlayer* player)
 {
+    INX_Render3DState_ReleaseBonePalette(player);
+
     NX_Free(player->currentPose);
     NX_Free(player->states);
 
@@ -191,6 +213,8 @@ void NX_UpdateAnimationPlayer(NX_AnimationPlayer* player, float dt)
         INX_ComputePose(*player, totalWeight);
     }
 
+    player->poseVersion++;
+
     for (int iAnim = 0; iAnim < animCount; iAnim++)
     {
         const NX_Animation& anim = player->animLib->animations[iAnim];
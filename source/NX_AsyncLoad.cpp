@@ -0,0 +1,261 @@
+/* NX_AsyncLoad.cpp -- API definition for Nexium's asynchronous loading module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./NX_AsyncLoad.hpp"
+
+#include "./INX_GlobalPool.hpp"
+#include "./INX_JobSystem.hpp"
+
+#include <NX/NX_Log.h>
+
+#include <SDL3/SDL_timer.h>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+
+// ============================================================================
+// LOCAL STATE
+// ============================================================================
+
+/** Loads whose decode stage is finished, in submission order of completion */
+static std::deque<NX_AsyncLoad*> INX_UploadQueue;
+static std::mutex INX_UploadQueueMutex;
+
+/** Per-frame upload budget */
+static double INX_UploadBudgetMs = 2.0;
+static size_t INX_UploadBudgetBytes = 16 * 1024 * 1024;
+
+// ============================================================================
+// LOCAL FUNCTIONS
+// ============================================================================
+
+static void INX_ReleaseLoad(NX_AsyncLoad* load)
+{
+    if (--load->refCount == 0) {
+        INX_Pool.Destroy(load);
+    }
+}
+
+/** Performs one step of the upload stage, returns true once the load left the pipeline */
+static bool INX_UploadStep(NX_AsyncLoad* load, size_t* bytes)
+{
+    if (load->cancelled) {
+        return true;
+    }
+
+    if (load->decodeFailed) {
+        load->status = NX_ASYNC_FAILED;
+        return true;
+    }
+
+    size_t stepBytes = 0;
+    NX_AsyncStatus status = load->upload(&stepBytes, &load->result);
+    *bytes += stepBytes;
+
+    if (status == NX_ASYNC_PENDING) {
+        return false;
+    }
+
+    load->status = status;
+    return true;
+}
+
+static NX_AsyncLoad* INX_PeekQueue(size_t index)
+{
+    std::lock_guard<std::mutex> lock(INX_UploadQueueMutex);
+    return (index < INX_UploadQueue.size()) ? INX_UploadQueue[index] : nullptr;
+}
+
+static void INX_RemoveFromQueue(NX_AsyncLoad* load)
+{
+    {
+        std::lock_guard<std::mutex> lock(INX_UploadQueueMutex);
+        auto it = std::find(INX_UploadQueue.begin(), INX_UploadQueue.end(), load);
+        if (it != INX_UploadQueue.end()) {
+            INX_UploadQueue.erase(it);
+        }
+    }
+    INX_ReleaseLoad(load);
+}
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+NX_AsyncLoad* INX_AsyncLoad_Submit(
+    std::function<bool()> decode,
+    std::function<NX_AsyncStatus(size_t*, void**)> upload,
+    std::function<void(void*)> release)
+{
+    NX_AsyncLoad* load = INX_Pool.Create<NX_AsyncLoad>();
+    if (load == nullptr) {
+        NX_LOG(E, "CORE: Failed to create asynchronous load; Object pool issue");
+        return nullptr;
+    }
+
+    load->decode = std::move(decode);
+    load->upload = std::move(upload);
+    load->release = std::move(release);
+
+    // NOTE: The load is only read by the worker until it is queued,
+    //       from there it is exclusively handled by the main thread
+    INX_Jobs.Submit([load]() {
+        load->decodeFailed = load->cancelled || !load->decode();
+        // NOTE: The load can be finished and destroyed as soon as it is queued,
+        //       it must not be touched after the lock is released
+        std::lock_guard<std::mutex> lock(INX_UploadQueueMutex);
+        load->decoded = true;
+        INX_UploadQueue.push_back(load);
+    });
+
+    return load;
+}
+
+void* INX_AsyncLoad_Take(NX_AsyncLoad* load)
+{
+    if (load == nullptr || load->status != NX_ASYNC_READY) {
+        return nullptr;
+    }
+
+    void* result = load->result;
+    load->result = nullptr;
+
+    return result;
+}
+
+void INX_AsyncLoad_Update()
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+
+    auto getElapsedMs = [&]() {
+        return 1000.0 * (SDL_GetPerformanceCounter() - start) / frequency;
+    };
+
+    /* --- Without workers the decode stages are run here, under the same time budget --- */
+
+    if (INX_Jobs.GetWorkerCount() == 0) {
+        while (INX_Jobs.TryRunJob()) {
+            if (INX_UploadBudgetMs > 0.0 && getElapsedMs() >= INX_UploadBudgetMs) break;
+        }
+    }
+
+    /* --- Process the upload queue --- */
+
+    size_t bytes = 0;
+    size_t index = 0;
+    bool firstStep = true;
+
+    while (NX_AsyncLoad* load = INX_PeekQueue(index))
+    {
+        /* --- Check the budget, at least one step is performed to guarantee progress --- */
+
+        if (!firstStep) {
+            if (INX_UploadBudgetMs > 0.0 && getElapsedMs() >= INX_UploadBudgetMs) break;
+            if (INX_UploadBudgetBytes > 0 && bytes >= INX_UploadBudgetBytes) break;
+        }
+
+        /* --- Upload the next step of the oldest load that can progress --- */
+
+        firstStep = firstStep && (load->cancelled || load->decodeFailed);
+
+        const size_t prevBytes = bytes;
+
+        if (INX_UploadStep(load, &bytes)) {
+            INX_RemoveFromQueue(load);
+        }
+        else if (bytes == prevBytes) {
+            // NOTE: A pending step without transfer is usually waiting on a worker,
+            //       the next loads can progress meanwhile within the same budget
+            index++;
+        }
+    }
+}
+
+void INX_AsyncLoad_Quit()
+{
+    std::deque<NX_AsyncLoad*> queue;
+    {
+        std::lock_guard<std::mutex> lock(INX_UploadQueueMutex);
+        queue.swap(INX_UploadQueue);
+    }
+
+    for (NX_AsyncLoad* load : queue) {
+        load->status = NX_ASYNC_FAILED;
+        INX_ReleaseLoad(load);
+    }
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+NX_AsyncStatus NX_PollAsyncLoad(const NX_AsyncLoad* load)
+{
+    return (load != nullptr) ? load->status.load() : NX_ASYNC_FAILED;
+}
+
+NX_AsyncStatus NX_WaitAsyncLoad(NX_AsyncLoad* load)
+{
+    if (load == nullptr) {
+        return NX_ASYNC_FAILED;
+    }
+
+    if (!INX_Jobs.IsMainThread()) {
+        NX_LOG(E, "CORE: NX_WaitAsyncLoad must be called from the main thread");
+        return load->status;
+    }
+
+    /* --- Help the workers until the decode stage is done --- */
+
+    while (load->status == NX_ASYNC_PENDING && !load->decoded) {
+        if (!INX_Jobs.TryRunJob()) {
+            std::this_thread::yield();
+        }
+    }
+
+    /* --- Perform the remaining uploads immediately --- */
+
+    if (load->status == NX_ASYNC_PENDING) {
+        // NOTE: Texture copy jobs submitted from here sit in the main thread deque,
+        //       so keep running jobs while an upload waits on them
+        size_t bytes = 0;
+        while (!INX_UploadStep(load, &bytes)) {
+            if (!INX_Jobs.TryRunJob()) {
+                std::this_thread::yield();
+            }
+        }
+        INX_RemoveFromQueue(load);
+    }
+
+    return load->status;
+}
+
+void NX_DestroyAsyncLoad(NX_AsyncLoad* load)
+{
+    if (load == nullptr) {
+        return;
+    }
+
+    if (load->status == NX_ASYNC_PENDING) {
+        load->cancelled = true;
+    }
+    else if (load->result != nullptr) {
+        load->release(load->result);
+        load->result = nullptr;
+    }
+
+    INX_ReleaseLoad(load);
+}
+
+void NX_SetAsyncUploadBudget(double milliseconds, size_t bytes)
+{
+    INX_UploadBudgetMs = milliseconds;
+    INX_UploadBudgetBytes = bytes;
+}
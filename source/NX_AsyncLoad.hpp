@@ -0,0 +1,69 @@
+/* NX_AsyncLoad.hpp -- API definition for Nexium's asynchronous loading module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_ASYNC_LOAD_HPP
+#define NX_ASYNC_LOAD_HPP
+
+#include <NX/NX_AsyncLoad.h>
+
+#include <functional>
+#include <atomic>
+
+// ============================================================================
+// OPAQUE DEFINITION
+// ============================================================================
+
+struct NX_AsyncLoad {
+    /** Worker stage, file I/O and decoding, returns false on failure */
+    std::function<bool()> decode;
+
+    /**
+     * Main thread stage, performs one GPU creation step per call and writes the number
+     * of uploaded bytes. Returns NX_ASYNC_PENDING while steps remain, otherwise the final
+     * status, with the resource written to 'result' on success. A pending step that
+     * transfers nothing lets the following loads progress before being called again.
+     */
+    std::function<NX_AsyncStatus(size_t* bytes, void** result)> upload;
+
+    /** Destroys a resource that was never retrieved */
+    std::function<void(void*)> release;
+
+    std::atomic<NX_AsyncStatus> status{NX_ASYNC_PENDING};
+    std::atomic<bool> decoded{false};   //< Set by the worker once the load is in the upload queue
+    std::atomic<bool> cancelled{false}; //< Set when the user destroys a pending load
+    bool decodeFailed{false};
+
+    void* result{};
+    int refCount{2};                    //< Held by the user and by the loading pipeline, main thread only
+};
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+/**
+ * Creates a load and submits its decode stage to the job system.
+ * Stage states are owned by the closures, they are destroyed with the load
+ * on the main thread and must release any partial result they still hold.
+ */
+NX_AsyncLoad* INX_AsyncLoad_Submit(
+    std::function<bool()> decode,
+    std::function<NX_AsyncStatus(size_t*, void**)> upload,
+    std::function<void(void*)> release
+);
+
+/** Retrieves the resource of a ready load, returns nullptr if not ready or already retrieved */
+void* INX_AsyncLoad_Take(NX_AsyncLoad* load);
+
+/** Performs the queued GPU uploads within the frame budget, called by NX_FrameStep */
+void INX_AsyncLoad_Update();
+
+/** Drops all queued loads, should be called after the job system shutdown */
+void INX_AsyncLoad_Quit();
+
+#endif // NX_ASYNC_LOAD_HPP
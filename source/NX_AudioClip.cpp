@@ -12,10 +12,12 @@
 #include <NX/NX_AudioClip.h>
 #include <NX/NX_Log.h>
 
+#include "./Detail/Util/DynamicArray.hpp"
 #include "./Detail/Util/FixedArray.hpp"
 #include "./Detail/Util/Ranges.hpp"
 #include "./INX_AudioUtils.hpp"
 #include "./INX_GlobalPool.hpp"
+#include "./INX_JobSystem.hpp"
 
 #include <stb_vorbis.h>
 #include <dr_flac.h>
@@ -23,26 +25,8 @@
 #include <dr_mp3.h>
 #include <al.h>
 
-// ============================================================================
-// OPAQUE DEFINITION
-// ============================================================================
-
-NX_AudioClip::~NX_AudioClip()
-{
-    if (buffer > 0) {
-        for (ALuint source : sources) {
-            ALint state;
-            alGetSourcei(source, AL_SOURCE_STATE, &state);
-            if (state == AL_PLAYING || state == AL_PAUSED) {
-                alSourceStop(source);
-            }
-        }
-        alDeleteSources(sources.GetSize(), sources.GetData());
-        if (alIsBuffer(buffer)) {
-            alDeleteBuffers(1, &buffer);
-        }
-    }
-}
+#include <SDL3/SDL_timer.h>
+#include <algorithm>
 
 // ============================================================================
 // INTERNAL TYPES
@@ -215,111 +199,654 @@ void INX_DestroyAudioClip_RawData(INX_AudioClip_RawData& rawData)
     NX_Free(rawData.pcmData);
 }
 
+/** Decodes a whole file to 16-bit PCM, the result owns its samples */
+static bool INX_DecodeAudioClip(const void* data, size_t size, INX_AudioClip_RawData* result)
+{
+    switch (INX_GetAudioFormat(static_cast<const uint8_t*>(data), size)) {
+    case INX_AudioFormat::WAV:
+        *result = INX_LoadAudioClip_RawData_WAV(data, size);
+        break;
+    case INX_AudioFormat::FLAC:
+        *result = INX_LoadAudioClip_RawData_FLAC(data, size);
+        break;
+    case INX_AudioFormat::MP3:
+        *result = INX_LoadAudioClip_RawData_MP3(data, size);
+        break;
+    case INX_AudioFormat::OGG:
+        *result = INX_LoadAudioClip_RawData_OGG(data, size);
+        break;
+    default:
+        NX_LOG(E, "AUDIO: Unknown audio format");
+        return false;
+    }
+
+    return result->pcmData != nullptr;
+}
+
+/** Uploads decoded samples to a new OpenAL buffer, returns 0 on failure */
+static ALuint INX_CreateAudioClipBuffer(const INX_AudioClip_RawData& audioData)
+{
+    ALuint buffer = 0;
+    alGenBuffers(1, &buffer);
+    if (alGetError() != AL_NO_ERROR) {
+        NX_LOG(E, "AUDIO: Could not generate OpenAL buffer");
+        return 0;
+    }
+
+    alBufferData(buffer, audioData.format, audioData.pcmData, audioData.pcmDataSize, audioData.sampleRate);
+    if (alGetError() != AL_NO_ERROR) {
+        NX_LOG(E, "AUDIO: Could not buffer data to OpenAL");
+        alDeleteBuffers(1, &buffer);
+        return 0;
+    }
+
+    return buffer;
+}
+
+static double INX_GetAudioClipDuration(const INX_AudioClip_RawData& audioData)
+{
+    int channels = (audioData.format == AL_FORMAT_STEREO16) ? 2 : 1;
+    return static_cast<double>(audioData.pcmDataSize) / (channels * sizeof(int16_t) * audioData.sampleRate);
+}
+
+/** Creates the clip object, its channels are virtual voices sharing the real sources */
+static NX_AudioClip* INX_CreateAudioClip(int channelCount)
+{
+    NX_AudioClip* clip = INX_Pool.Create<NX_AudioClip>();
+    clip->voices = util::FixedArray<INX_AudioVoice>(channelCount, channelCount);
+
+    for (INX_AudioVoice& voice : clip->voices) {
+        voice.clip = clip;
+    }
+
+    return clip;
+}
+
 // ============================================================================
-// PUBLIC API
+// COMPRESSED CLIP CACHE
 // ============================================================================
 
-NX_AudioClip* NX_LoadAudioClip(const char* filePath, int channelCount)
+static util::DynamicArray<NX_AudioClip*> INX_ResidentClips;   //< Compressed clips with a decoded buffer
+static NX_AudioClipCacheStats INX_ClipCacheStats{};
+static size_t INX_ClipCacheBudget = 32 * 1024 * 1024;
+static uint64_t INX_ClipCacheClock = 0;
+
+static bool INX_IsAudioClipAudible(const NX_AudioClip* clip)
 {
-    if (channelCount <= 0) {
-        NX_LOG(E, "AUDIO: Invalid channel count %d", channelCount);
-        return nullptr;
+    for (const INX_AudioVoice& voice : clip->voices) {
+        if (voice.source >= 0) return true;
     }
+    return false;
+}
 
-    if (!filePath) {
-        NX_LOG(E, "AUDIO: Null file path");
-        return nullptr;
+static void INX_ReleaseClipBuffer(NX_AudioClip* clip)
+{
+    auto it = std::find(INX_ResidentClips.Begin(), INX_ResidentClips.End(), clip);
+    if (it != INX_ResidentClips.End()) {
+        INX_ResidentClips.Erase(it);
     }
 
-    /* --- Load file data --- */
+    alDeleteBuffers(1, &clip->buffer);
+    INX_ClipCacheStats.residentBytes -= clip->pcmSize;
+    clip->buffer = 0;
+    clip->pcmSize = 0;
+}
 
-    size_t fileSize = 0;
-    void* fileData = NX_LoadFile(filePath, &fileSize);
-    if (!fileData) {
-        NX_LOG(E, "AUDIO: Unable to load file '%s'", filePath);
-        return nullptr;
+/** Evicts the least recently played buffers until the budget is met, audible clips and 'keep' are kept */
+static void INX_EvictClipBuffers(const NX_AudioClip* keep = nullptr)
+{
+    while (INX_ClipCacheStats.residentBytes > INX_ClipCacheBudget)
+    {
+        NX_AudioClip* victim = nullptr;
+        for (NX_AudioClip* clip : INX_ResidentClips) {
+            if (clip == keep || INX_IsAudioClipAudible(clip)) continue;
+            if (victim == nullptr || clip->lastUse < victim->lastUse) {
+                victim = clip;
+            }
+        }
+
+        if (victim == nullptr) {
+            break;
+        }
+
+        INX_ReleaseClipBuffer(victim);
+        INX_ClipCacheStats.evictions++;
     }
+}
+
+/** Makes sure the clip has a decoded buffer, decoding a compressed clip if needed */
+static bool INX_AcquireClipBuffer(NX_AudioClip* clip)
+{
+    clip->lastUse = ++INX_ClipCacheClock;
+
+    if (clip->compressedData == nullptr) {
+        return clip->buffer != 0;
+    }
+
+    if (clip->buffer != 0) {
+        INX_ClipCacheStats.hits++;
+        return true;
+    }
+
+    /* --- Decode on demand, then make room for the new buffer --- */
 
-    /* --- Decode according to format --- */
+    INX_ClipCacheStats.misses++;
 
     INX_AudioClip_RawData audioData;
-    auto format = INX_GetAudioFormat(static_cast<const uint8_t*>(fileData), fileSize);
+    if (!INX_DecodeAudioClip(clip->compressedData.get(), clip->compressedSize, &audioData)) {
+        NX_LOG(E, "AUDIO: Failed to decode compressed clip");
+        return false;
+    }
 
-    switch (format) {
-        case INX_AudioFormat::WAV:
-            audioData = INX_LoadAudioClip_RawData_WAV(fileData, fileSize);
-            break;
-        case INX_AudioFormat::FLAC:
-            audioData = INX_LoadAudioClip_RawData_FLAC(fileData, fileSize);
-            break;
-        case INX_AudioFormat::MP3:
-            audioData = INX_LoadAudioClip_RawData_MP3(fileData, fileSize);
-            break;
-        case INX_AudioFormat::OGG:
-            audioData = INX_LoadAudioClip_RawData_OGG(fileData, fileSize);
-            break;
-        default:
-            NX_LOG(E, "AUDIO: Unknown audio format for '%s'", filePath);
-            NX_Free(fileData);
-            return nullptr;
+    clip->buffer = INX_CreateAudioClipBuffer(audioData);
+    clip->duration = INX_GetAudioClipDuration(audioData);
+    clip->pcmSize = audioData.pcmDataSize;
+
+    INX_DestroyAudioClip_RawData(audioData);
+
+    if (clip->buffer == 0) {
+        clip->pcmSize = 0;
+        return false;
     }
 
-    NX_Free(fileData);
+    INX_ResidentClips.PushBack(clip);
+    INX_ClipCacheStats.residentBytes += clip->pcmSize;
+    INX_EvictClipBuffers(clip);
+
+    return true;
+}
+
+// ============================================================================
+// VOICE MANAGER
+// ============================================================================
+
+/**
+ * Shares a bounded pool of real OpenAL sources between every clip channel.
+ *
+ * Playing voices that do not get a source are virtual: they keep advancing
+ * in time without being heard, and are given a source again at their current
+ * offset as soon as one frees up. When the pool is full, a new voice steals
+ * the source of the lowest priority voice, the oldest one first, provided its
+ * priority is not lower.
+ */
+class INX_VoiceManager {
+public:
+    static constexpr int DefaultVoiceLimit = 32;
+
+public:
+    void Play(INX_AudioVoice& voice);
+    void Pause(INX_AudioVoice& voice);
+    void Stop(INX_AudioVoice& voice);
+    bool IsPlaying(const INX_AudioVoice& voice) const;
+
+    void Update();
+    void Quit();
+
+    void SetVoiceLimit(int limit);
+    int GetVoiceLimit() const { return mVoiceLimit; }
+    NX_AudioVoiceStats GetStats() const;
+
+private:
+    struct RealSource {
+        ALuint source;
+        INX_AudioVoice* voice;
+    };
+
+private:
+    static uint64_t GetTicks();
+    double GetOffset(const INX_AudioVoice& voice) const;
+    bool IsFinished(const INX_AudioVoice& voice) const;
+
+    int FindFreeSource();
+    int FindVictim(int priority) const;
+    void Bind(INX_AudioVoice& voice, int index);
+    void Unbind(INX_AudioVoice& voice);
+    void Deactivate(INX_AudioVoice& voice);
+
+private:
+    util::DynamicArray<RealSource> mSources;
+    util::DynamicArray<INX_AudioVoice*> mActiveVoices;      //< Playing or paused
+    util::DynamicArray<INX_AudioVoice*> mWaitingVoices;     //< Scratch array of the update
+    int mVoiceLimit{DefaultVoiceLimit};
+    uint64_t mPlayCounter{};
+    uint64_t mSteals{};
+};
 
-    if (!audioData.pcmData) {
-        NX_LOG(E, "AUDIO: Failed to decode audio file '%s'", filePath);
-        return nullptr;
+static INX_VoiceManager INX_Voices;
+
+uint64_t INX_VoiceManager::GetTicks()
+{
+    return SDL_GetTicksNS();
+}
+
+double INX_VoiceManager::GetOffset(const INX_AudioVoice& voice) const
+{
+    switch (voice.state) {
+    case INX_AudioVoice::State::Playing:
+        if (voice.source >= 0) {
+            ALfloat offset = 0.0f;
+            alGetSourcef(mSources[voice.source].source, AL_SEC_OFFSET, &offset);
+            return offset;
+        }
+        return static_cast<double>(GetTicks() - voice.startTicks) / SDL_NS_PER_SECOND;
+    case INX_AudioVoice::State::Paused:
+        return voice.pausedOffset;
+    default:
+        return 0.0;
     }
+}
 
-    /* --- Create the OpenAL buffer --- */
+bool INX_VoiceManager::IsFinished(const INX_AudioVoice& voice) const
+{
+    if (voice.state != INX_AudioVoice::State::Playing) {
+        return false;
+    }
 
-    ALuint buffer = 0;
-    alGenBuffers(1, &buffer);
-    if (alGetError() != AL_NO_ERROR) {
-        NX_LOG(E, "AUDIO: Could not generate OpenAL buffer");
-        INX_DestroyAudioClip_RawData(audioData);
-        return nullptr;
+    if (voice.source >= 0) {
+        ALint state = 0;
+        alGetSourcei(mSources[voice.source].source, AL_SOURCE_STATE, &state);
+        return state == AL_STOPPED;
     }
 
-    /* --- Load data into the buffer --- */
+    return GetOffset(voice) >= voice.clip->duration;
+}
 
-    alBufferData(buffer, audioData.format, audioData.pcmData, audioData.pcmDataSize, audioData.sampleRate);
+int INX_VoiceManager::FindFreeSource()
+{
+    for (size_t i = 0; i < mSources.GetSize(); ++i) {
+        if (mSources[i].voice == nullptr) return static_cast<int>(i);
+    }
+
+    /* --- Grow the pool up to the limit, or until the driver refuses --- */
+
+    if (static_cast<int>(mSources.GetSize()) >= mVoiceLimit) {
+        return -1;
+    }
+
+    ALuint source = 0;
+    alGetError();
+    alGenSources(1, &source);
     if (alGetError() != AL_NO_ERROR) {
-        NX_LOG(E, "AUDIO: Could not buffer data to OpenAL");
-        INX_DestroyAudioClip_RawData(audioData);
-        alDeleteBuffers(1, &buffer);
-        return nullptr;
+        NX_LOG(W, "AUDIO: Voice limit reached at %i sources (driver limit)", static_cast<int>(mSources.GetSize()));
+        mVoiceLimit = static_cast<int>(mSources.GetSize());
+        return -1;
     }
 
-    /* --- Cleanup PCM data (no longer needed now) --- */
+    mSources.PushBack(RealSource{source, nullptr});
 
-    INX_DestroyAudioClip_RawData(audioData);
+    return static_cast<int>(mSources.GetSize()) - 1;
+}
 
-    /* --- Create the OpenAL sources --- */
+int INX_VoiceManager::FindVictim(int priority) const
+{
+    int victim = -1;
 
-    util::FixedArray<ALuint> sources(channelCount, channelCount);
-    alGenSources(channelCount, sources.GetData());
-    if (alGetError() != AL_NO_ERROR) {
-        NX_LOG(E, "AUDIO: Could not generate OpenAL sources");
-        alDeleteBuffers(1, &buffer);
-        return nullptr;
+    for (size_t i = 0; i < mSources.GetSize(); ++i) {
+        const INX_AudioVoice* voice = mSources[i].voice;
+        if (voice == nullptr || voice->clip->priority > priority) {
+            continue;
+        }
+        if (victim < 0) {
+            victim = static_cast<int>(i);
+            continue;
+        }
+        const INX_AudioVoice* best = mSources[victim].voice;
+        if (voice->clip->priority < best->clip->priority ||
+           (voice->clip->priority == best->clip->priority && voice->playOrder < best->playOrder)) {
+            victim = static_cast<int>(i);
+        }
+    }
+
+    return victim;
+}
+
+void INX_VoiceManager::Bind(INX_AudioVoice& voice, int index)
+{
+    double offset = GetOffset(voice);
+
+    ALuint source = mSources[index].source;
+    alSourcei(source, AL_BUFFER, voice.clip->buffer);
+    alSourcef(source, AL_SEC_OFFSET, static_cast<ALfloat>(offset));
+    alSourcePlay(source);
+
+    mSources[index].voice = &voice;
+    voice.source = index;
+}
+
+void INX_VoiceManager::Unbind(INX_AudioVoice& voice)
+{
+    if (voice.source < 0) {
+        return;
+    }
+
+    // NOTE: The offset is captured before the source is released so that a playing voice keeps advancing
+    if (voice.state == INX_AudioVoice::State::Playing) {
+        double offset = GetOffset(voice);
+        voice.startTicks = GetTicks() - static_cast<uint64_t>(offset * SDL_NS_PER_SECOND);
+    }
+
+    ALuint source = mSources[voice.source].source;
+    alSourceStop(source);
+    alSourcei(source, AL_BUFFER, 0);
+
+    mSources[voice.source].voice = nullptr;
+    voice.source = -1;
+}
+
+void INX_VoiceManager::Deactivate(INX_AudioVoice& voice)
+{
+    auto it = std::find(mActiveVoices.Begin(), mActiveVoices.End(), &voice);
+    if (it != mActiveVoices.End()) {
+        mActiveVoices.Erase(it);
+    }
+}
+
+void INX_VoiceManager::Play(INX_AudioVoice& voice)
+{
+    if (!INX_AcquireClipBuffer(voice.clip)) {
+        Stop(voice);
+        return;
     }
 
-    /* --- Attach buffer to all sources --- */
+    if (voice.state == INX_AudioVoice::State::Stopped) {
+        mActiveVoices.PushBack(&voice);
+    }
+
+    voice.state = INX_AudioVoice::State::Playing;
+    voice.startTicks = GetTicks();
+    voice.playOrder = ++mPlayCounter;
+
+    /* --- Restart on the source already held, if any --- */
+
+    if (voice.source >= 0) {
+        ALuint source = mSources[voice.source].source;
+        alSourceRewind(source);
+        alSourcePlay(source);
+        return;
+    }
 
-    for (int i = 0; i < channelCount; i++) {
-        alSourcei(sources[i], AL_BUFFER, buffer);
-        if (alGetError() != AL_NO_ERROR) {
-            NX_LOG(E, "AUDIO: Could not attach buffer to source %d", i);
-            alDeleteSources(channelCount, sources.GetData());
-            alDeleteBuffers(1, &buffer);
-            return nullptr;
+    /* --- Otherwise take a free source, or steal one, or stay virtual --- */
+
+    int index = FindFreeSource();
+    if (index < 0) {
+        index = FindVictim(voice.clip->priority);
+        if (index < 0) return;
+        Unbind(*mSources[index].voice);
+        mSteals++;
+    }
+
+    Bind(voice, index);
+}
+
+void INX_VoiceManager::Pause(INX_AudioVoice& voice)
+{
+    if (voice.state != INX_AudioVoice::State::Playing) {
+        return;
+    }
+
+    voice.pausedOffset = GetOffset(voice);
+    voice.state = INX_AudioVoice::State::Paused;
+
+    Unbind(voice);
+}
+
+void INX_VoiceManager::Stop(INX_AudioVoice& voice)
+{
+    if (voice.state == INX_AudioVoice::State::Stopped) {
+        return;
+    }
+
+    voice.state = INX_AudioVoice::State::Stopped;
+
+    Unbind(voice);
+    Deactivate(voice);
+}
+
+bool INX_VoiceManager::IsPlaying(const INX_AudioVoice& voice) const
+{
+    return voice.state == INX_AudioVoice::State::Playing && !IsFinished(voice);
+}
+
+void INX_VoiceManager::Update()
+{
+    /* --- Release the voices that reached their end --- */
+
+    for (size_t i = mActiveVoices.GetSize(); i > 0; --i) {
+        INX_AudioVoice& voice = *mActiveVoices[i - 1];
+        if (IsFinished(voice)) {
+            Stop(voice);
         }
     }
 
-    /* --- Push clip to the object pull and return pointer */
+    /* --- Give a source back to the virtual voices, highest priority and most recent first --- */
+
+    mWaitingVoices.Clear();
+    for (INX_AudioVoice* voice : mActiveVoices) {
+        if (voice->state == INX_AudioVoice::State::Playing && voice->source < 0) {
+            mWaitingVoices.PushBack(voice);
+        }
+    }
+
+    if (mWaitingVoices.IsEmpty()) {
+        return;
+    }
+
+    std::sort(mWaitingVoices.Begin(), mWaitingVoices.End(),
+        [](const INX_AudioVoice* a, const INX_AudioVoice* b) {
+            if (a->clip->priority != b->clip->priority) {
+                return a->clip->priority > b->clip->priority;
+            }
+            return a->playOrder > b->playOrder;
+        }
+    );
+
+    for (INX_AudioVoice* voice : mWaitingVoices) {
+        // NOTE: Only a strictly higher priority can take the source of an audible voice back
+        int index = FindFreeSource();
+        bool steal = (index < 0);
+        if (steal) {
+            index = FindVictim(voice->clip->priority - 1);
+            if (index < 0) break;
+        }
+        // The source is secured before acquiring, which may decode an evicted clip
+        if (!INX_AcquireClipBuffer(voice->clip)) {
+            continue;
+        }
+        if (steal) {
+            Unbind(*mSources[index].voice);
+            mSteals++;
+        }
+        Bind(*voice, index);
+    }
+}
+
+void INX_VoiceManager::Quit()
+{
+    for (INX_AudioVoice* voice : mActiveVoices) {
+        voice->state = INX_AudioVoice::State::Stopped;
+        voice->source = -1;
+    }
+
+    for (const RealSource& source : mSources) {
+        alSourceStop(source.source);
+        alDeleteSources(1, &source.source);
+    }
+
+    mSources.Clear();
+    mActiveVoices.Clear();
+    mWaitingVoices.Clear();
+}
+
+void INX_VoiceManager::SetVoiceLimit(int limit)
+{
+    mVoiceLimit = std::max(limit, 1);
+
+    /* --- Virtualize the voices beyond the new limit, then free their sources --- */
+
+    while (static_cast<int>(mSources.GetSize()) > mVoiceLimit) {
+        RealSource& last = mSources[mSources.GetSize() - 1];
+        if (last.voice != nullptr) {
+            Unbind(*last.voice);
+        }
+        alDeleteSources(1, &last.source);
+        mSources.PopBack();
+    }
+}
+
+NX_AudioVoiceStats INX_VoiceManager::GetStats() const
+{
+    NX_AudioVoiceStats stats{};
+
+    for (const INX_AudioVoice* voice : mActiveVoices) {
+        if (voice->state != INX_AudioVoice::State::Playing) continue;
+        stats.activeVoices++;
+        stats.audibleVoices += (voice->source >= 0);
+    }
+
+    stats.virtualVoices = stats.activeVoices - stats.audibleVoices;
+    stats.realSources = static_cast<int>(mSources.GetSize());
+    stats.steals = mSteals;
+
+    return stats;
+}
+
+// ============================================================================
+// OPAQUE DEFINITION
+// ============================================================================
+
+NX_AudioClip::~NX_AudioClip()
+{
+    for (INX_AudioVoice& voice : voices) {
+        INX_Voices.Stop(voice);
+    }
+
+    if (compressedData != nullptr) {
+        INX_ClipCacheStats.compressedBytes -= compressedSize;
+        if (buffer > 0) INX_ReleaseClipBuffer(this);
+    }
+    else if (buffer > 0 && alIsBuffer(buffer)) {
+        alDeleteBuffers(1, &buffer);
+    }
+}
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+void INX_AudioClip_Update()
+{
+    INX_Voices.Update();
+}
+
+void INX_AudioClip_Quit()
+{
+    INX_Voices.Quit();
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+NX_AudioClip* NX_LoadAudioClip(const char* filePath, int channelCount)
+{
+    return NX_LoadAudioClipEx(filePath, channelCount, NX_AUDIO_CLIP_DECODED);
+}
+
+NX_AudioClip* NX_LoadAudioClipEx(const char* filePath, int channelCount, NX_AudioClipMode mode)
+{
+    NX_AudioClip* clip = nullptr;
+    NX_LoadAudioClipBank(&filePath, 1, channelCount, mode, &clip);
+    return clip;
+}
+
+int NX_LoadAudioClipBank(const char* const* filePaths, int count, int channelCount, NX_AudioClipMode mode, NX_AudioClip** clips)
+{
+    for (int i = 0; i < count; i++) {
+        clips[i] = nullptr;
+    }
+
+    if (channelCount <= 0) {
+        NX_LOG(E, "AUDIO: Invalid channel count %d", channelCount);
+        return 0;
+    }
+
+    /* --- Read and decode the files on the workers --- */
+
+    struct Entry {
+        void* fileData;
+        size_t fileSize;
+        INX_AudioClip_RawData audioData;
+    };
+
+    util::FixedArray<Entry> entries(count, count, Entry{});
+
+    INX_Jobs.ParallelFor(count, 1, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            Entry& entry = entries[i];
+            if (filePaths[i] == nullptr) {
+                NX_LOG(E, "AUDIO: Null file path");
+                continue;
+            }
+            entry.fileData = NX_LoadFile(filePaths[i], &entry.fileSize);
+            if (entry.fileData == nullptr) {
+                NX_LOG(E, "AUDIO: Unable to load file '%s'", filePaths[i]);
+                continue;
+            }
+            if (INX_GetAudioFormat(static_cast<const uint8_t*>(entry.fileData), entry.fileSize) == INX_AudioFormat::Unknown) {
+                NX_LOG(E, "AUDIO: Unknown audio format for '%s'", filePaths[i]);
+                NX_Free(entry.fileData);
+                entry.fileData = nullptr;
+                continue;
+            }
+            if (mode == NX_AUDIO_CLIP_DECODED) {
+                if (!INX_DecodeAudioClip(entry.fileData, entry.fileSize, &entry.audioData)) {
+                    NX_LOG(E, "AUDIO: Failed to decode audio file '%s'", filePaths[i]);
+                }
+                NX_Free(entry.fileData);
+                entry.fileData = nullptr;
+            }
+        }
+    });
+
+    /* --- Create the clips, OpenAL buffers are only created on this thread --- */
+
+    int loadedCount = 0;
 
-    return INX_Pool.Create<NX_AudioClip>(std::move(sources), buffer);
+    for (int i = 0; i < count; i++)
+    {
+        Entry& entry = entries[i];
+
+        if (mode == NX_AUDIO_CLIP_COMPRESSED) {
+            if (entry.fileData == nullptr) continue;
+            NX_AudioClip* clip = INX_CreateAudioClip(channelCount);
+            clip->compressedData.reset(static_cast<uint8_t*>(entry.fileData));
+            clip->compressedSize = entry.fileSize;
+            INX_ClipCacheStats.compressedBytes += entry.fileSize;
+            clips[i] = clip;
+            loadedCount++;
+            continue;
+        }
+
+        if (entry.audioData.pcmData == nullptr) {
+            continue;
+        }
+
+        ALuint buffer = INX_CreateAudioClipBuffer(entry.audioData);
+        double duration = INX_GetAudioClipDuration(entry.audioData);
+        INX_DestroyAudioClip_RawData(entry.audioData);
+
+        if (buffer == 0) {
+            continue;
+        }
+
+        NX_AudioClip* clip = INX_CreateAudioClip(channelCount);
+        clip->buffer = buffer;
+        clip->duration = duration;
+        clips[i] = clip;
+        loadedCount++;
+    }
+
+    return loadedCount;
 }
 
 void NX_DestroyAudioClip(NX_AudioClip* clip)
@@ -329,15 +856,14 @@ void NX_DestroyAudioClip(NX_AudioClip* clip)
 
 int NX_PlayAudioClip(NX_AudioClip* clip, int channel)
 {
-    channel = std::min(channel, static_cast<int>(clip->sources.GetSize() - 1));
+    const int count = static_cast<int>(clip->voices.GetSize());
+    channel = std::min(channel, count - 1);
 
     /* --- Select a free channel if necessary --- */
 
     if (channel < 0) {
-        for (int i = 0; i < clip->sources.GetSize(); i++) {
-            ALint state = 0;
-            alGetSourcei(clip->sources[i], AL_SOURCE_STATE, &state);
-            if (state != AL_PLAYING) {
+        for (int i = 0; i < count; i++) {
+            if (!INX_Voices.IsPlaying(clip->voices[i])) {
                 channel = i;
                 break;
             }
@@ -347,60 +873,45 @@ int NX_PlayAudioClip(NX_AudioClip* clip, int channel)
         }
     }
 
-    /* --- Stop current playback on this channel if any --- */
-
-    ALint state;
-    alGetSourcei(clip->sources[channel], AL_SOURCE_STATE, &state);
-    if (state == AL_PLAYING || state == AL_PAUSED) {
-        alSourceRewind(clip->sources[channel]);
-    }
-
-    /* --- Play the sound on the specified channel --- */
+    /* --- Play the sound on the specified channel, from the start --- */
 
-    alSourcePlay(clip->sources[channel]);
-
-    /* --- Return used channel --- */
+    INX_Voices.Play(clip->voices[channel]);
 
     return channel;
 }
 
 void NX_PauseAudioClip(NX_AudioClip* clip, int channel)
 {
-    if (channel >= static_cast<int>(clip->sources.GetSize())) return;
-    if (channel >= 0) alSourcePause(clip->sources[channel]);
-    else alSourcePausev(clip->sources.GetSize(), clip->sources.GetData());
+    if (channel >= static_cast<int>(clip->voices.GetSize())) return;
+    if (channel >= 0) INX_Voices.Pause(clip->voices[channel]);
+    else for (INX_AudioVoice& voice : clip->voices) INX_Voices.Pause(voice);
 }
 
 void NX_StopAudioClip(NX_AudioClip* clip, int channel)
 {
-    if (channel >= static_cast<int>(clip->sources.GetSize())) return;
-    if (channel >= 0) alSourceStop(clip->sources[channel]);
-    else alSourceStopv(clip->sources.GetSize(), clip->sources.GetData());
+    if (channel >= static_cast<int>(clip->voices.GetSize())) return;
+    if (channel >= 0) INX_Voices.Stop(clip->voices[channel]);
+    else for (INX_AudioVoice& voice : clip->voices) INX_Voices.Stop(voice);
 }
 
-void NX_RewindAudioStream(NX_AudioClip* clip, int channel)
+void NX_RewindAudioClip(NX_AudioClip* clip, int channel)
 {
-    if (channel >= static_cast<int>(clip->sources.GetSize())) return;
-    if (channel >= 0) alSourceRewind(clip->sources[channel]);
-    else alSourceRewindv(clip->sources.GetSize(), clip->sources.GetData());
+    // NOTE: Like alSourceRewind, the channel goes back to its initial, non-playing state
+    NX_StopAudioClip(clip, channel);
 }
 
 bool NX_IsAudioClipPlaying(NX_AudioClip* clip, int channel)
 {
-    if (channel >= static_cast<int>(clip->sources.GetSize())) {
+    if (channel >= static_cast<int>(clip->voices.GetSize())) {
         return false;
     }
 
     if (channel >= 0) {
-        ALenum state = 0;
-        alGetSourcei(clip->sources[channel], AL_SOURCE_STATE, &state);
-        return (state == AL_PLAYING);
+        return INX_Voices.IsPlaying(clip->voices[channel]);
     }
 
-    for (ALuint source : clip->sources) {
-        ALenum state = 0;
-        alGetSourcei(source, AL_SOURCE_STATE, &state);
-        if (state == AL_PLAYING) return true;
+    for (const INX_AudioVoice& voice : clip->voices) {
+        if (INX_Voices.IsPlaying(voice)) return true;
     }
 
     return false;
@@ -408,6 +919,53 @@ bool NX_IsAudioClipPlaying(NX_AudioClip* clip, int channel)
 
 int NX_GetAudioClipChannelCount(NX_AudioClip* clip)
 {
-    return clip->sources.GetSize();
+    return clip->voices.GetSize();
+}
+
+void NX_SetAudioClipPriority(NX_AudioClip* clip, int priority)
+{
+    clip->priority = priority;
+}
+
+int NX_GetAudioClipPriority(const NX_AudioClip* clip)
+{
+    return clip->priority;
+}
+
+void NX_SetAudioVoiceLimit(int limit)
+{
+    INX_Voices.SetVoiceLimit(limit);
+}
+
+int NX_GetAudioVoiceLimit(void)
+{
+    return INX_Voices.GetVoiceLimit();
+}
+
+NX_AudioVoiceStats NX_GetAudioVoiceStats(void)
+{
+    return INX_Voices.GetStats();
+}
+
+void NX_SetAudioClipCacheBudget(size_t bytes)
+{
+    INX_ClipCacheBudget = bytes;
+    INX_EvictClipBuffers();
 }
 
+size_t NX_GetAudioClipCacheBudget(void)
+{
+    return INX_ClipCacheBudget;
+}
+
+NX_AudioClipCacheStats NX_GetAudioClipCacheStats(void)
+{
+    return INX_ClipCacheStats;
+}
+
+void NX_ResetAudioClipCacheStats(void)
+{
+    INX_ClipCacheStats.hits = 0;
+    INX_ClipCacheStats.misses = 0;
+    INX_ClipCacheStats.evictions = 0;
+}
@@ -9,13 +9,50 @@
 #ifndef NX_AUDIO_CLIP_HPP
 #define NX_AUDIO_CLIP_HPP
 
+#include <NX/NX_AudioClip.h>
+
 #include "./Detail/Util/FixedArray.hpp"
+#include "./Detail/Util/Memory.hpp"
 #include <al.h>
 
+/**
+ * Playback state of one clip channel. A voice only holds a real OpenAL
+ * source while it is audible, otherwise its position is tracked in time.
+ */
+struct INX_AudioVoice {
+    enum class State : uint8_t { Stopped, Playing, Paused };
+
+    NX_AudioClip* clip{};
+    int source{-1};             //< Index in the real source pool, -1 when virtual or stopped
+    State state{};
+    uint64_t startTicks{};      //< Ticks at which the playback offset was zero, while playing
+    double pausedOffset{};      //< Offset in seconds, while paused
+    uint64_t playOrder{};       //< Increases with every play, older voices are stolen first
+};
+
 struct NX_AudioClip {
-    util::FixedArray<ALuint> sources{};
+    util::FixedArray<INX_AudioVoice> voices{};
     ALuint buffer{};
+    double duration{};
+    int priority{};
+
+    // Compressed clips keep their file and decode it into 'buffer' on demand
+    util::UniquePtr<uint8_t> compressedData{};
+    size_t compressedSize{};
+    size_t pcmSize{};           //< Size of the decoded buffer, 0 while not resident
+    uint64_t lastUse{};
+
     ~NX_AudioClip();
 };
 
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+/** Should be called once per frame, reclaims finished voices and makes virtual ones audible again */
+void INX_AudioClip_Update();
+
+/** Should be called in NX_Quit(), after every clip has been destroyed */
+void INX_AudioClip_Quit();
+
 #endif // NX_AUDIO_CLIP_HPP
@@ -9,7 +9,8 @@
 #include <NX/NX_AudioStream.h>
 #include <NX/NX_Filesystem.h>
 
-#include "Detail/Util/DynamicArray.hpp"
+#include "./Detail/Util/DynamicArray.hpp"
+#include "./Detail/Util/SpscQueue.hpp"
 #include "./Detail/Util/Memory.hpp"
 #include "./INX_AudioUtils.hpp"
 #include "./NX_AudioStream.hpp"
@@ -17,45 +18,254 @@
 
 #include <SDL3/SDL_assert.h>
 
-#include <condition_variable>
 #include <algorithm>
+#include <semaphore>
 #include <thread>
 #include <atomic>
-#include <mutex>
+#include <chrono>
+#include <memory>
 #include <array>
 
+// ============================================================================
+// FILE CALLBACKS
+// ============================================================================
+
+/** Size of the PhysFS read-ahead buffer of the WAV, FLAC and MP3 streams */
+static constexpr PHYSFS_uint64 INX_ReadAheadSize = 16 * 1024;
+
+static size_t INX_ReadFile(void* userData, void* buffer, size_t bytes)
+{
+    PHYSFS_sint64 bytesRead = PHYSFS_readBytes(static_cast<PHYSFS_File*>(userData), buffer, bytes);
+    return (bytesRead > 0) ? static_cast<size_t>(bytesRead) : 0;
+}
+
+/** Shared by the dr_libs decoders, their seek origins are all start/current/end */
+template <typename Bool, typename Origin>
+static Bool INX_SeekFile(void* userData, int offset, Origin origin)
+{
+    PHYSFS_File* file = static_cast<PHYSFS_File*>(userData);
+
+    PHYSFS_sint64 base = 0;
+    switch (static_cast<int>(origin)) {
+    case 0: base = 0; break;
+    case 1: base = PHYSFS_tell(file); break;
+    case 2: base = PHYSFS_fileLength(file); break;
+    default: return 0;
+    }
+
+    if (base < 0 || base + offset < 0) {
+        return 0;
+    }
+
+    return PHYSFS_seek(file, static_cast<PHYSFS_uint64>(base + offset)) != 0;
+}
+
+static drmp3_bool32 INX_TellFile(void* userData, drmp3_int64* cursor)
+{
+    PHYSFS_sint64 position = PHYSFS_tell(static_cast<PHYSFS_File*>(userData));
+    if (position < 0) return DRMP3_FALSE;
+    *cursor = position;
+    return DRMP3_TRUE;
+}
+
+// ============================================================================
+// OGG PUSHDATA DECODER
+// ============================================================================
+
+/** Moves the unread bytes to the front of the window and fills the rest from the file */
+static bool INX_OggFillWindow(INX_OggDecoder& ogg, PHYSFS_File* file)
+{
+    if (ogg.begin > 0) {
+        SDL_memmove(ogg.window.get(), ogg.window.get() + ogg.begin, ogg.end - ogg.begin);
+        ogg.end -= ogg.begin;
+        ogg.begin = 0;
+    }
+
+    if (ogg.end == ogg.capacity) {
+        if (ogg.capacity >= INX_OggDecoder::MaxWindowSize) {
+            return false;
+        }
+        size_t capacity = 2 * ogg.capacity;
+        uint8_t* window = NX_Realloc(ogg.window.get(), capacity);
+        if (window == nullptr) {
+            return false;
+        }
+        ogg.window.release();
+        ogg.window.reset(window);
+        ogg.capacity = capacity;
+    }
+
+    size_t bytesRead = INX_ReadFile(file, ogg.window.get() + ogg.end, ogg.capacity - ogg.end);
+    ogg.end += bytesRead;
+
+    return bytesRead > 0;
+}
+
+/** Opens the vorbis decoder from the current file position, reading until the headers are complete */
+static bool INX_OggOpen(INX_OggDecoder& ogg, PHYSFS_File* file)
+{
+    ogg.begin = ogg.end = 0;
+    ogg.outputCount = ogg.outputOffset = 0;
+
+    while (true) {
+        int used = 0, error = 0;
+        ogg.vorbis = stb_vorbis_open_pushdata(ogg.window.get(), static_cast<int>(ogg.end), &used, &error, nullptr);
+        if (ogg.vorbis != nullptr) {
+            ogg.begin = used;
+            return true;
+        }
+        if (error != VORBIS_need_more_data || !INX_OggFillWindow(ogg, file)) {
+            return false;
+        }
+    }
+}
+
+/** Reads the granule position of the last page, which is the length of the stream in frames */
+static uint64_t INX_OggReadLength(PHYSFS_File* file)
+{
+    constexpr PHYSFS_sint64 tailSize = 64 * 1024;
+
+    PHYSFS_sint64 length = PHYSFS_fileLength(file);
+    PHYSFS_sint64 offset = std::max<PHYSFS_sint64>(length - tailSize, 0);
+    if (length < 0 || PHYSFS_seek(file, offset) == 0) {
+        return 0;
+    }
+
+    util::UniquePtr<uint8_t> tail = util::MakeUniqueArray<uint8_t>(length - offset);
+    size_t size = INX_ReadFile(file, tail.get(), length - offset);
+
+    uint64_t frames = 0;
+    for (size_t i = size; i >= 14; --i) {
+        const uint8_t* page = tail.get() + i - 14;
+        if (SDL_memcmp(page, "OggS", 4) == 0 && page[4] == 0) {
+            for (int j = 7; j >= 0; --j) frames = (frames << 8) | page[6 + j];
+            break;
+        }
+    }
+
+    PHYSFS_seek(file, 0);
+    return frames;
+}
+
+static INX_OggDecoder* INX_OggCreate(PHYSFS_File* file)
+{
+    INX_OggDecoder* ogg = NX_Malloc<INX_OggDecoder>();
+    new (ogg) INX_OggDecoder();
+
+    ogg->window = util::MakeUniqueArray<uint8_t>(INX_OggDecoder::WindowSize);
+    ogg->capacity = INX_OggDecoder::WindowSize;
+    ogg->totalFrames = INX_OggReadLength(file);
+
+    if (!INX_OggOpen(*ogg, file)) {
+        ogg->~INX_OggDecoder();
+        NX_Free(ogg);
+        return nullptr;
+    }
+
+    stb_vorbis_info info = stb_vorbis_get_info(ogg->vorbis);
+    ogg->channels = info.channels;
+    ogg->sampleRate = info.sample_rate;
+
+    return ogg;
+}
+
+static void INX_OggDestroy(INX_OggDecoder* ogg)
+{
+    if (ogg == nullptr) return;
+    if (ogg->vorbis) stb_vorbis_close(ogg->vorbis);
+    ogg->~INX_OggDecoder();
+    NX_Free(ogg);
+}
+
+static size_t INX_OggDecode(INX_OggDecoder& ogg, PHYSFS_File* file, int16_t* buffer, size_t frames)
+{
+    size_t framesRead = 0;
+
+    while (framesRead < frames)
+    {
+        /* --- Convert what remains of the last decoded frame --- */
+
+        if (ogg.outputOffset < ogg.outputCount) {
+            int count = std::min<int>(ogg.outputCount - ogg.outputOffset, static_cast<int>(frames - framesRead));
+            for (int i = 0; i < count; ++i) {
+                for (int c = 0; c < ogg.channels; ++c) {
+                    float sample = ogg.outputs[c][ogg.outputOffset + i] * 32767.0f;
+                    *buffer++ = static_cast<int16_t>(std::clamp(sample, -32768.0f, 32767.0f));
+                }
+            }
+            ogg.outputOffset += count;
+            framesRead += count;
+            continue;
+        }
+
+        /* --- Decode the next frame, reading more pages when it is incomplete --- */
+
+        int channels = 0, samples = 0;
+        int used = stb_vorbis_decode_frame_pushdata(
+            ogg.vorbis, ogg.window.get() + ogg.begin, static_cast<int>(ogg.end - ogg.begin),
+            &channels, &ogg.outputs, &samples
+        );
+
+        if (used == 0) {
+            if (!INX_OggFillWindow(ogg, file)) break;
+            continue;
+        }
+
+        ogg.begin += used;
+        ogg.outputCount = samples;
+        ogg.outputOffset = 0;
+    }
+
+    return framesRead;
+}
+
+static void INX_OggRewind(INX_OggDecoder& ogg, PHYSFS_File* file)
+{
+    // NOTE: Pushdata decoders cannot seek, the headers are parsed again from the start
+    stb_vorbis_close(ogg.vorbis);
+    ogg.vorbis = nullptr;
+
+    if (PHYSFS_seek(file, 0) == 0 || !INX_OggOpen(ogg, file)) {
+        NX_LOG(E, "AUDIO: Failed to rewind OGG stream");
+    }
+}
+
 // ============================================================================
 // DECODER HELPERS
 // ============================================================================
 
-static bool INX_InitDecoder(NX_AudioStream::Decoder* decoder, int* channels, const uint8_t* data, size_t size, INX_AudioFormat format)
+static bool INX_InitDecoder(NX_AudioStream::Decoder* decoder, int* channels, PHYSFS_File* file, INX_AudioFormat format)
 {
     SDL_assert(decoder != nullptr && channels != nullptr);
 
     switch (format) {
     case INX_AudioFormat::WAV:
         decoder->wav = NX_Malloc<drwav>();
-        if (!drwav_init_memory(decoder->wav, data, size, nullptr)) {
+        if (!drwav_init(decoder->wav, INX_ReadFile, INX_SeekFile<drwav_bool32, drwav_seek_origin>, file, nullptr)) {
+            NX_Free(decoder->wav);
+            decoder->wav = nullptr;
             return false;
         }
         *channels = decoder->wav->channels;
         break;
     case INX_AudioFormat::FLAC:
-        decoder->flac = drflac_open_memory(data, size, nullptr);
+        decoder->flac = drflac_open(INX_ReadFile, INX_SeekFile<drflac_bool32, drflac_seek_origin>, file, nullptr);
         if (!decoder->flac) return false;
         *channels = decoder->flac->channels;
         break;
     case INX_AudioFormat::MP3:
         decoder->mp3 = NX_Malloc<drmp3>();
-        if (!drmp3_init_memory(decoder->mp3, data, size, nullptr)) {
+        if (!drmp3_init(decoder->mp3, INX_ReadFile, INX_SeekFile<drmp3_bool32, drmp3_seek_origin>, INX_TellFile, nullptr, file, nullptr)) {
+            NX_Free(decoder->mp3);
+            decoder->mp3 = nullptr;
             return false;
         }
         *channels = decoder->mp3->channels;
         break;
     case INX_AudioFormat::OGG:
-        decoder->ogg = stb_vorbis_open_memory(data, size, nullptr, nullptr);
+        decoder->ogg = INX_OggCreate(file);
         if (!decoder->ogg) return false;
-        *channels = stb_vorbis_get_info(decoder->ogg).channels;
+        *channels = decoder->ogg->channels;
         break;
     default:
         return false;
@@ -68,42 +278,31 @@ static void INX_DestroyDecoder(NX_AudioStream::Decoder& decoder, INX_AudioFormat
 {
     switch (format) {
     case INX_AudioFormat::WAV:
-        drwav_uninit(decoder.wav);
+        if (decoder.wav) drwav_uninit(decoder.wav);
         NX_Free(decoder.wav);
         break;
     case INX_AudioFormat::FLAC:
         drflac_close(decoder.flac);
         break;
     case INX_AudioFormat::MP3:
-        drmp3_uninit(decoder.mp3);
+        if (decoder.mp3) drmp3_uninit(decoder.mp3);
         NX_Free(decoder.mp3);
         break;
     case INX_AudioFormat::OGG:
-        stb_vorbis_close(decoder.ogg);
+        INX_OggDestroy(decoder.ogg);
         break;
     default:
         break;
     }
 }
 
-static int INX_GetChannelCount(const NX_AudioStream& stream)
-{
-    switch (stream.audioFormat) {
-    case INX_AudioFormat::WAV:  return stream.decoder.wav->channels;
-    case INX_AudioFormat::FLAC: return stream.decoder.flac->channels;
-    case INX_AudioFormat::MP3:  return stream.decoder.mp3->channels;
-    case INX_AudioFormat::OGG:  return stb_vorbis_get_info(stream.decoder.ogg).channels;
-    default: return 0;
-    }
-}
-
 static int INX_GetSampleRate(const NX_AudioStream& stream)
 {
     switch (stream.audioFormat) {
     case INX_AudioFormat::WAV:  return stream.decoder.wav->sampleRate;
     case INX_AudioFormat::FLAC: return stream.decoder.flac->sampleRate;
     case INX_AudioFormat::MP3:  return stream.decoder.mp3->sampleRate;
-    case INX_AudioFormat::OGG:  return stb_vorbis_get_info(stream.decoder.ogg).sample_rate;
+    case INX_AudioFormat::OGG:  return stream.decoder.ogg->sampleRate;
     default: return 0;
     }
 }
@@ -117,14 +316,8 @@ static size_t INX_DecodeSamples(const NX_AudioStream& stream, void* buffer, size
         return drflac_read_pcm_frames_s16(stream.decoder.flac, samples, static_cast<drflac_int16*>(buffer));
     case INX_AudioFormat::MP3:
         return drmp3_read_pcm_frames_s16(stream.decoder.mp3, samples, static_cast<drmp3_int16*>(buffer));
-    case INX_AudioFormat::OGG: {
-        int channels = stb_vorbis_get_info(stream.decoder.ogg).channels;
-        return stb_vorbis_get_samples_short_interleaved(
-            stream.decoder.ogg, channels, 
-            static_cast<int16_t*>(buffer), 
-            samples * channels
-        );
-    }
+    case INX_AudioFormat::OGG:
+        return INX_OggDecode(*stream.decoder.ogg, stream.file, static_cast<int16_t*>(buffer), samples);
     default:
         return 0;
     }
@@ -136,237 +329,443 @@ static void INX_SeekToStart(const NX_AudioStream& stream)
     case INX_AudioFormat::WAV:  drwav_seek_to_pcm_frame(stream.decoder.wav, 0); break;
     case INX_AudioFormat::FLAC: drflac_seek_to_pcm_frame(stream.decoder.flac, 0); break;
     case INX_AudioFormat::MP3:  drmp3_seek_to_pcm_frame(stream.decoder.mp3, 0); break;
-    case INX_AudioFormat::OGG:  stb_vorbis_seek(stream.decoder.ogg, 0); break;
+    case INX_AudioFormat::OGG:  INX_OggRewind(*stream.decoder.ogg, stream.file); break;
     default: break;
     }
 }
 
 // ============================================================================
-// OPAQUE DEFINITION
+// STREAM PLAYER
 // ============================================================================
 
-NX_AudioStream::~NX_AudioStream()
-{
-    INX_DestroyDecoder(decoder, audioFormat);
-
-    if (source > 0) {
-        alDeleteSources(1, &source);
-        alDeleteBuffers(BufferCount, buffers.data());
-    }
-}
+/**
+ * Refills the OpenAL queues of the playing streams on a dedicated thread.
+ *
+ * The API thread never touches a submitted stream's decoder or source queue,
+ * it only pushes commands through a lock-free queue. The thread sleeps until
+ * the earliest playing buffer is expected to be consumed, or until a command
+ * arrives, instead of polling at a fixed rate.
+ *
+ * Decoding itself runs ahead on the job system workers, one job at a time per
+ * stream, so that the stream thread only moves ready samples into OpenAL.
+ * Any operation touching the decoder position waits for that job first.
+ */
+class INX_StreamPlayer {
+public:
+    enum class Command : uint8_t { Play, Pause, Stop, Rewind, Release };
 
-// ============================================================================
-// STREAM PLAYER
-// ============================================================================
+public:
+    INX_StreamPlayer();
+    ~INX_StreamPlayer();
 
-struct INX_StreamPlayer {
-    static constexpr size_t MaxDecodeBuffers = 32;
-    static constexpr size_t DecodeBufferSize = NX_AudioStream::BufferSize;
+    /** API thread */
+    void Submit(NX_AudioStream* stream, Command command);
+    void Release(NX_AudioStream* stream);
+    NX_AudioStreamStats GetStats() const;
+    void ResetStats();
 
-    std::thread streamThread;
-    std::mutex streamMutex;      // For activeStreams
-    std::mutex bufferMutex;      // For the buffer pool
-    std::condition_variable cv;
-    std::atomic<bool> shouldStop{false};
+    /** Queues the first buffers of a stream that is not playing, without any decode job in flight */
+    static void Prepare(NX_AudioStream* stream);
 
-    util::DynamicArray<NX_AudioStream*> activeStreams;
-    std::array<util::UniquePtr<uint8_t>, MaxDecodeBuffers> decodeBuffers;
-    std::array<bool, MaxDecodeBuffers> bufferAvailable;
+private:
+    struct Message {
+        NX_AudioStream* stream;
+        Command command;
+    };
 
-    INX_StreamPlayer();
-    ~INX_StreamPlayer();
+private:
+    static size_t Decode(NX_AudioStream* stream, int16_t* samples);
+    static void ResetQueue(NX_AudioStream* stream);
 
-    void addStream(NX_AudioStream* stream);
-    void removeStream(NX_AudioStream* stream);
-    void prepareStream(NX_AudioStream* stream);
+    void DecodeAhead(NX_AudioStream* stream);
+    void ScheduleDecode(NX_AudioStream* stream);
+    void WaitDecode(NX_AudioStream* stream);
 
-    uint8_t* requestBuffer();
-    void releaseBuffer(uint8_t* buffer);
+    void ThreadFunc();
+    void ProcessCommands();
+    void Deactivate(NX_AudioStream* stream);
+    float UpdateStreams();
+    float UpdateStream(NX_AudioStream* stream);
+    void WakeUp();
 
 private:
-    void threadFunc();
-    void updateStreams();
-    bool updateStream(NX_AudioStream* stream);
-    bool fillBuffer(NX_AudioStream* stream, ALuint buffer);
+    util::SpscQueue<Message, 256> mCommands;
+    util::DynamicArray<NX_AudioStream*> mActiveStreams;     //< Only touched by the stream thread
+    std::binary_semaphore mWakeUp{0};
+    std::atomic<bool> mWakePending{false};
+    std::atomic<bool> mShouldStop{false};
+    std::thread mThread;
+
+    /** Statistics */
+    std::atomic<int> mActiveCount{0};
+    std::atomic<uint64_t> mDecodedBuffers{0};
+    std::atomic<uint64_t> mUnderruns{0};
 };
 
 INX_StreamPlayer::INX_StreamPlayer()
 {
-    bufferAvailable.fill(true);
-    for (auto& buffer : decodeBuffers) {
-        buffer = util::MakeUniqueArray<uint8_t>(DecodeBufferSize);
-    }
-
-    streamThread = std::thread([this]() { threadFunc(); });
+    mThread = std::thread([this]() { ThreadFunc(); });
 }
 
 INX_StreamPlayer::~INX_StreamPlayer()
 {
-    shouldStop = true;
-    cv.notify_one();
+    mShouldStop = true;
+    mWakeUp.release();
+
+    if (mThread.joinable()) {
+        mThread.join();
+    }
 
-    if (streamThread.joinable()) {
-        streamThread.join();
+    for (size_t i = 0; i < mActiveStreams.GetSize(); ++i) {
+        NX_AudioStream* stream = mActiveStreams[i];
+        INX_Jobs.Wait(stream->decodeJob);   // Audio thread is joined, the main thread can help
+        alSourceStop(stream->source);
+        stream->isActive = false;
+        stream->isPlaying = false;
     }
 }
 
-void INX_StreamPlayer::addStream(NX_AudioStream* stream)
+void INX_StreamPlayer::Submit(NX_AudioStream* stream, Command command)
 {
-    std::lock_guard<std::mutex> lock(streamMutex);
+    stream->isSubmitted = true;
 
-    auto it = std::find(activeStreams.Begin(), activeStreams.End(), stream);
-    if (it == activeStreams.End()) {
-        activeStreams.PushBack(stream);
-        cv.notify_one();
+    while (!mCommands.TryPush(Message{stream, command})) {
+        WakeUp();
+        std::this_thread::yield();
     }
+    WakeUp();
+}
+
+void INX_StreamPlayer::Release(NX_AudioStream* stream)
+{
+    Submit(stream, Command::Release);
+    stream->isReleased.wait(false);
 }
 
-void INX_StreamPlayer::removeStream(NX_AudioStream* stream)
+NX_AudioStreamStats INX_StreamPlayer::GetStats() const
 {
-    std::lock_guard<std::mutex> lock(streamMutex);
+    return NX_AudioStreamStats {
+        .activeStreams = mActiveCount.load(std::memory_order_relaxed),
+        .decodedBuffers = mDecodedBuffers.load(std::memory_order_relaxed),
+        .underruns = mUnderruns.load(std::memory_order_relaxed)
+    };
+}
+
+void INX_StreamPlayer::ResetStats()
+{
+    mDecodedBuffers = 0;
+    mUnderruns = 0;
+}
 
-    auto it = std::find(activeStreams.Begin(), activeStreams.End(), stream);
-    if (it != activeStreams.End()) {
-        activeStreams.Erase(it);
+size_t INX_StreamPlayer::Decode(NX_AudioStream* stream, int16_t* samples)
+{
+    size_t framesRead = INX_DecodeSamples(*stream, samples, stream->bufferFrames);
+
+    if (framesRead == 0 && stream->shouldLoop) {
+        INX_SeekToStart(*stream);
+        framesRead = INX_DecodeSamples(*stream, samples, stream->bufferFrames);
     }
+
+    return framesRead;
 }
 
-void INX_StreamPlayer::prepareStream(NX_AudioStream* stream)
+void INX_StreamPlayer::Prepare(NX_AudioStream* stream)
 {
-    for (size_t i = 0; i < NX_AudioStream::BufferCount; ++i) {
-        fillBuffer(stream, stream->buffers[i]);
+    stream->readyHead = 0;
+    stream->readyTail = 0;
+    stream->decodeEnded = false;
+
+    for (int i = 0; i < stream->bufferCount; ++i) {
+        size_t frames = Decode(stream, stream->decodeBuffer.get());
+        if (frames == 0) break;
+        size_t dataSize = frames * stream->channels * sizeof(int16_t);
+        alBufferData(stream->buffers[i], stream->format, stream->decodeBuffer.get(), dataSize, stream->sampleRate);
+        alSourceQueueBuffers(stream->source, 1, &stream->buffers[i]);
     }
 }
 
-uint8_t* INX_StreamPlayer::requestBuffer()
+void INX_StreamPlayer::ResetQueue(NX_AudioStream* stream)
 {
-    std::lock_guard<std::mutex> lock(bufferMutex);
+    alSourceStop(stream->source);
 
-    for (size_t i = 0; i < MaxDecodeBuffers; ++i) {
-        if (bufferAvailable[i]) {
-            bufferAvailable[i] = false;
-            return decodeBuffers[i].get();
-        }
+    ALint queued = 0;
+    alGetSourcei(stream->source, AL_BUFFERS_QUEUED, &queued);
+    if (queued > 0) {
+        ALuint buffers[NX_AudioStream::MaxBufferCount];
+        alSourceUnqueueBuffers(stream->source, queued, buffers);
     }
 
-    return nullptr;
+    INX_SeekToStart(*stream);
+    Prepare(stream);
 }
 
-void INX_StreamPlayer::releaseBuffer(uint8_t* buffer)
+void INX_StreamPlayer::DecodeAhead(NX_AudioStream* stream)
 {
-    std::lock_guard<std::mutex> lock(bufferMutex);
+    uint32_t tail = stream->readyTail.load(std::memory_order_relaxed);
 
-    for (size_t i = 0; i < MaxDecodeBuffers; ++i) {
-        if (decodeBuffers[i].get() == buffer) {
-            bufferAvailable[i] = true;
-            break;
+    while (tail - stream->readyHead.load(std::memory_order_acquire) < NX_AudioStream::ReadyCount)
+    {
+        const int slot = tail % NX_AudioStream::ReadyCount;
+
+        size_t frames = Decode(stream, stream->readySamples[slot].get());
+        if (frames == 0) {
+            stream->decodeEnded.store(true, std::memory_order_release);
+            return;
         }
+
+        stream->readyFrames[slot] = frames;
+        stream->readyTail.store(++tail, std::memory_order_release);
+        mDecodedBuffers.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
-bool INX_StreamPlayer::fillBuffer(NX_AudioStream* stream, ALuint buffer)
+void INX_StreamPlayer::ScheduleDecode(NX_AudioStream* stream)
 {
-    uint8_t* decodeBuffer = requestBuffer();
-    if (!decodeBuffer) {
-        return false;
+    if (!stream->decodeJob.IsDone() || stream->decodeEnded.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    const uint32_t pending = stream->readyTail.load(std::memory_order_relaxed) - stream->readyHead.load(std::memory_order_relaxed);
+    if (pending >= NX_AudioStream::ReadyCount) {
+        return;
     }
 
-    int channels = INX_GetChannelCount(*stream);
-    int sampleRate = INX_GetSampleRate(*stream);
-    size_t samplesToRead = DecodeBufferSize / (channels * sizeof(int16_t));
+    // NOTE: Without workers, jobs would wait for the main thread, decode here instead
+    if (INX_Jobs.GetWorkerCount() == 0) {
+        DecodeAhead(stream);
+        return;
+    }
 
-    size_t samplesRead = INX_DecodeSamples(*stream, decodeBuffer, samplesToRead);
+    INX_Jobs.Submit([this, stream]() { DecodeAhead(stream); }, &stream->decodeJob);
+}
 
-    if (samplesRead == 0 && stream->shouldLoop) {
-        INX_SeekToStart(*stream);
-        samplesRead = INX_DecodeSamples(*stream, decodeBuffer, samplesToRead);
+void INX_StreamPlayer::WaitDecode(NX_AudioStream* stream)
+{
+    // NOTE: Only waits on the counter, helping the job system from the audio thread
+    //       could pick up long unrelated jobs (model or texture decodes) and starve
+    //       every other stream of refills while they run
+    while (!stream->decodeJob.IsDone()) {
+        std::this_thread::yield();
+    }
+}
+
+void INX_StreamPlayer::WakeUp()
+{
+    if (!mWakePending.exchange(true)) {
+        mWakeUp.release();
     }
+}
+
+void INX_StreamPlayer::Deactivate(NX_AudioStream* stream)
+{
+    if (!stream->isActive) return;
 
-    bool success = false;
-    if (samplesRead > 0) {
-        size_t dataSize = samplesRead * channels * sizeof(int16_t);
-        alBufferData(buffer, stream->format, decodeBuffer, dataSize, sampleRate);
-        alSourceQueueBuffers(stream->source, 1, &buffer);
-        success = true;
+    auto it = std::find(mActiveStreams.Begin(), mActiveStreams.End(), stream);
+    if (it != mActiveStreams.End()) {
+        mActiveStreams.Erase(it);
     }
 
-    releaseBuffer(decodeBuffer);
-    return success;
+    stream->isActive = false;
+    mActiveCount = static_cast<int>(mActiveStreams.GetSize());
 }
 
-bool INX_StreamPlayer::updateStream(NX_AudioStream* stream)
+void INX_StreamPlayer::ProcessCommands()
 {
-    if (stream->isPaused) {
-        return false;
+    Message message;
+    while (mCommands.TryPop(&message))
+    {
+        NX_AudioStream* stream = message.stream;
+
+        switch (message.command) {
+        case Command::Play:
+            if (!stream->isActive) {
+                mActiveStreams.PushBack(stream);
+                mActiveCount = static_cast<int>(mActiveStreams.GetSize());
+                stream->isActive = true;
+            }
+            stream->isHalted = false;
+            alSourcePlay(stream->source);
+            break;
+        case Command::Pause:
+            stream->isHalted = true;
+            alSourcePause(stream->source);
+            break;
+        case Command::Stop:
+            Deactivate(stream);
+            WaitDecode(stream);
+            stream->isHalted = false;
+            ResetQueue(stream);
+            break;
+        case Command::Rewind: {
+            ALint state = AL_STOPPED;
+            alGetSourcei(stream->source, AL_SOURCE_STATE, &state);
+            WaitDecode(stream);
+            ResetQueue(stream);
+            if (state == AL_PLAYING) alSourcePlay(stream->source);
+            break;
+        }
+        case Command::Release:
+            Deactivate(stream);
+            WaitDecode(stream);
+            alSourceStop(stream->source);
+            stream->isReleased = true;
+            stream->isReleased.notify_one();
+            break;
+        }
     }
+}
 
-    ALint sourceState;
-    alGetSourcei(stream->source, AL_SOURCE_STATE, &sourceState);
+float INX_StreamPlayer::UpdateStream(NX_AudioStream* stream)
+{
+    if (stream->isHalted) {
+        return -1.0f;
+    }
 
     ALint processed = 0;
     alGetSourcei(stream->source, AL_BUFFERS_PROCESSED, &processed);
 
+    /* --- Requeue the processed buffers with the samples decoded ahead --- */
+
     bool endOfStream = false;
+    bool starving = false;
+
+    while (processed > 0)
+    {
+        const uint32_t head = stream->readyHead.load(std::memory_order_relaxed);
+        const bool ready = (head != stream->readyTail.load(std::memory_order_acquire));
+
+        if (!ready && !stream->decodeEnded.load(std::memory_order_acquire)) {
+            starving = true;
+            break;
+        }
 
-    while (processed > 0 && !shouldStop) {
         ALuint buffer;
         alSourceUnqueueBuffers(stream->source, 1, &buffer);
-        if (!fillBuffer(stream, buffer)) endOfStream = true;
+
+        if (ready) {
+            const int slot = head % NX_AudioStream::ReadyCount;
+            size_t dataSize = stream->readyFrames[slot] * stream->channels * sizeof(int16_t);
+            alBufferData(buffer, stream->format, stream->readySamples[slot].get(), dataSize, stream->sampleRate);
+            alSourceQueueBuffers(stream->source, 1, &buffer);
+            stream->readyHead.store(head + 1, std::memory_order_release);
+        }
+        else {
+            endOfStream = true;
+        }
+
         processed--;
     }
 
+    ScheduleDecode(stream);
+
+    /* --- Handle the end of the stream and underruns --- */
+
     ALint queued = 0;
     alGetSourcei(stream->source, AL_BUFFERS_QUEUED, &queued);
 
     if (queued == 0 && endOfStream) {
+        Deactivate(stream);
+        WaitDecode(stream);
         INX_SeekToStart(*stream);
+        Prepare(stream);
         stream->isPlaying = false;
-        prepareStream(stream);
-        return true;
+        return -1.0f;
     }
-    else if (sourceState != AL_PLAYING && !stream->isPaused && queued > 0) {
+
+    ALint state = AL_STOPPED;
+    alGetSourcei(stream->source, AL_SOURCE_STATE, &state);
+    if (state != AL_PLAYING && queued > 0) {
+        mUnderruns.fetch_add(1, std::memory_order_relaxed);
         alSourcePlay(stream->source);
     }
 
-    return false;
+    if (starving) {
+        return 0.0f;
+    }
+
+    /* --- Time left before the buffer being played is consumed --- */
+
+    ALint offset = 0;
+    alGetSourcei(stream->source, AL_SAMPLE_OFFSET, &offset);
+
+    int framesLeft = stream->bufferFrames - (offset % stream->bufferFrames);
+    return static_cast<float>(framesLeft) / stream->sampleRate;
 }
 
-void INX_StreamPlayer::updateStreams()
+float INX_StreamPlayer::UpdateStreams()
 {
-    std::lock_guard<std::mutex> lock(streamMutex);
+    float wait = -1.0f;
 
-    for (size_t i = activeStreams.GetSize(); i > 0; --i) {
-        size_t idx = i - 1;
-        NX_AudioStream* stream = activeStreams[idx];
-        if (stream && updateStream(stream)) {
-            activeStreams.Erase(activeStreams.Begin() + idx);
+    for (size_t i = mActiveStreams.GetSize(); i > 0; --i) {
+        float streamWait = UpdateStream(mActiveStreams[i - 1]);
+        if (streamWait >= 0.0f && (wait < 0.0f || streamWait < wait)) {
+            wait = streamWait;
         }
     }
+
+    return wait;
 }
 
-void INX_StreamPlayer::threadFunc()
+void INX_StreamPlayer::ThreadFunc()
 {
-    while (!shouldStop)
+    // NOTE: Never sleep less than a millisecond, even when a buffer is about to run out
+    constexpr float minWait = 0.001f;
+
+    while (!mShouldStop)
     {
-        {
-            std::unique_lock<std::mutex> lock(streamMutex);
-            cv.wait(lock, [this]() { 
-                return !activeStreams.IsEmpty() || shouldStop.load(); 
-            });
+        mWakePending = false;
+        ProcessCommands();
 
-            if (shouldStop) break;
+        float wait = UpdateStreams();
+        if (wait < 0.0f) {
+            mWakeUp.acquire();
         }
+        else {
+            auto duration = std::chrono::duration<float>(std::max(wait, minWait));
+            (void)mWakeUp.try_acquire_for(duration);
+        }
+    }
+}
 
-        updateStreams();
+static std::unique_ptr<INX_StreamPlayer> INX_StreamPlayerInstance;
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(16));
+static INX_StreamPlayer& INX_GetStreamPlayer()
+{
+    if (INX_StreamPlayerInstance == nullptr) {
+        INX_StreamPlayerInstance = std::make_unique<INX_StreamPlayer>();
     }
+    return *INX_StreamPlayerInstance;
 }
 
-static INX_StreamPlayer& INX_GetStreamPlayer()
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+void INX_AudioStream_Quit()
+{
+    INX_StreamPlayerInstance.reset();
+}
+
+// ============================================================================
+// OPAQUE DEFINITION
+// ============================================================================
+
+NX_AudioStream::~NX_AudioStream()
 {
-    static INX_StreamPlayer player;
-    return player;
+    if (isSubmitted && INX_StreamPlayerInstance != nullptr) {
+        INX_StreamPlayerInstance->Release(this);
+    }
+
+    INX_DestroyDecoder(decoder, audioFormat);
+
+    if (file != nullptr) {
+        PHYSFS_close(file);
+    }
+
+    if (source > 0) {
+        alDeleteSources(1, &source);
+        alDeleteBuffers(bufferCount, buffers.data());
+    }
 }
 
 // ============================================================================
@@ -374,42 +773,59 @@ static INX_StreamPlayer& INX_GetStreamPlayer()
 // ============================================================================
 
 NX_AudioStream* NX_LoadAudioStream(const char* filePath)
+{
+    return NX_LoadAudioStreamEx(filePath, NX_AudioStream::DefaultBufferCount, NX_AudioStream::DefaultBufferFrames);
+}
+
+NX_AudioStream* NX_LoadAudioStreamEx(const char* filePath, int bufferCount, int bufferFrames)
 {
     if (!filePath) {
         NX_LOG(E, "AUDIO: File path is null");
         return nullptr;
     }
 
-    /* --- Load the file --- */
+    bufferCount = std::clamp(bufferCount, NX_AudioStream::MinBufferCount, NX_AudioStream::MaxBufferCount);
+    bufferFrames = std::clamp(bufferFrames, 256, 65536);
+
+    /* --- Open the file, only its header is read for now --- */
 
-    size_t fileSize = 0;
-    util::UniquePtr<uint8_t> fileData(static_cast<uint8_t*>(NX_LoadFile(filePath, &fileSize)));
-    if (!fileData) {
-        NX_LOG(E, "AUDIO: Failed to load file: %s", filePath);
+    PHYSFS_File* file = PHYSFS_openRead(filePath);
+    if (!file) {
+        NX_LOG(E, "AUDIO: Failed to open file: %s", filePath);
         return nullptr;
     }
 
+    std::array<uint8_t, 4096> header{};
+    size_t headerSize = INX_ReadFile(file, header.data(), header.size());
+
     /* --- Determine the format --- */
 
-    INX_AudioFormat audioFormat = INX_GetAudioFormat(fileData.get(), fileSize);
-    if (audioFormat == INX_AudioFormat::Unknown) {
+    INX_AudioFormat audioFormat = INX_GetAudioFormat(header.data(), headerSize);
+    if (audioFormat == INX_AudioFormat::Unknown || PHYSFS_seek(file, 0) == 0) {
         NX_LOG(E, "AUDIO: Unknown format: %s", filePath);
+        PHYSFS_close(file);
         return nullptr;
     }
 
     /* --- Initialize the decoder --- */
 
+    if (audioFormat != INX_AudioFormat::OGG) {
+        PHYSFS_setBuffer(file, INX_ReadAheadSize);
+    }
+
     NX_AudioStream::Decoder decoder{};
     int channels{};
 
-    if (!INX_InitDecoder(&decoder, &channels, fileData.get(), fileSize, audioFormat)) {
+    if (!INX_InitDecoder(&decoder, &channels, file, audioFormat)) {
         NX_LOG(E, "AUDIO: Failed to init audio stream decoder");
+        PHYSFS_close(file);
         return nullptr;
     }
 
     if (channels == 0 || channels > 2) {
         NX_LOG(E, "AUDIO: Unsupported channel count: %i", channels);
         INX_DestroyDecoder(decoder, audioFormat);
+        PHYSFS_close(file);
         return nullptr;
     }
 
@@ -417,11 +833,12 @@ NX_AudioStream* NX_LoadAudioStream(const char* filePath)
 
     ALenum format = (channels == 2) ? AL_FORMAT_STEREO16 : AL_FORMAT_MONO16;
     
-    std::array<ALuint, NX_AudioStream::BufferCount> buffers{};
-    alGenBuffers(NX_AudioStream::BufferCount, buffers.data());
+    std::array<ALuint, NX_AudioStream::MaxBufferCount> buffers{};
+    alGenBuffers(bufferCount, buffers.data());
     if (alGetError() != AL_NO_ERROR) {
         NX_LOG(E, "AUDIO: Failed to create buffers");
         INX_DestroyDecoder(decoder, audioFormat);
+        PHYSFS_close(file);
         return nullptr;
     }
 
@@ -429,8 +846,9 @@ NX_AudioStream* NX_LoadAudioStream(const char* filePath)
     alGenSources(1, &source);
     if (alGetError() != AL_NO_ERROR) {
         NX_LOG(E, "AUDIO: Failed to create source");
-        alDeleteBuffers(NX_AudioStream::BufferCount, buffers.data());
+        alDeleteBuffers(bufferCount, buffers.data());
         INX_DestroyDecoder(decoder, audioFormat);
+        PHYSFS_close(file);
         return nullptr;
     }
 
@@ -439,13 +857,21 @@ NX_AudioStream* NX_LoadAudioStream(const char* filePath)
     NX_AudioStream* stream = INX_Pool.Create<NX_AudioStream>();
     
     stream->buffers = buffers;
+    stream->bufferCount = bufferCount;
+    stream->bufferFrames = bufferFrames;
     stream->source = source;
     stream->format = format;
-    stream->audioData = std::move(fileData);
+    stream->file = file;
     stream->audioFormat = audioFormat;
+    stream->channels = channels;
     stream->decoder = decoder;
+    stream->sampleRate = INX_GetSampleRate(*stream);
+    stream->decodeBuffer = util::MakeUniqueArray<int16_t>(bufferFrames * channels);
+    for (auto& samples : stream->readySamples) {
+        samples = util::MakeUniqueArray<int16_t>(bufferFrames * channels);
+    }
 
-    INX_GetStreamPlayer().prepareStream(stream);
+    INX_StreamPlayer::Prepare(stream);
 
     return stream;
 }
@@ -457,15 +883,12 @@ void NX_DestroyAudioStream(NX_AudioStream* stream)
 
 void NX_PlayAudioStream(NX_AudioStream* stream)
 {
-    if (stream->isPaused && stream->isPlaying) {
-        alSourcePlay(stream->source);
-        stream->isPaused = false;
+    if (stream->isPlaying && !stream->isPaused) {
         return;
     }
 
-    INX_GetStreamPlayer().addStream(stream);
-    alSourcePlay(stream->source);
-    
+    INX_GetStreamPlayer().Submit(stream, INX_StreamPlayer::Command::Play);
+
     stream->isPaused = false;
     stream->isPlaying = true;
 }
@@ -473,7 +896,7 @@ void NX_PlayAudioStream(NX_AudioStream* stream)
 void NX_PauseAudioStream(NX_AudioStream* stream)
 {
     if (stream->isPlaying && !stream->isPaused) {
-        alSourcePause(stream->source);
+        INX_GetStreamPlayer().Submit(stream, INX_StreamPlayer::Command::Pause);
         stream->isPaused = true;
     }
 }
@@ -482,43 +905,15 @@ void NX_StopAudioStream(NX_AudioStream* stream)
 {
     if (!stream->isPlaying) return;
 
-    INX_GetStreamPlayer().removeStream(stream);
-    alSourceStop(stream->source);
-
-    ALint queued = 0;
-    alGetSourcei(stream->source, AL_BUFFERS_QUEUED, &queued);
-    if (queued > 0) {
-        ALuint buffers[NX_AudioStream::BufferCount];
-        alSourceUnqueueBuffers(stream->source, queued, buffers);
-    }
+    INX_GetStreamPlayer().Submit(stream, INX_StreamPlayer::Command::Stop);
 
-    INX_SeekToStart(*stream);
     stream->isPaused = false;
     stream->isPlaying = false;
-
-    INX_GetStreamPlayer().prepareStream(stream);
 }
 
 void NX_RewindAudioStream(NX_AudioStream* stream)
 {
-    bool wasPlaying = (stream->isPlaying && !stream->isPaused);
-
-    if (stream->isPaused) {
-        alSourceStop(stream->source);
-        ALint queued = 0;
-        alGetSourcei(stream->source, AL_BUFFERS_QUEUED, &queued);
-        if (queued > 0) {
-            ALuint buffers[NX_AudioStream::BufferCount];
-            alSourceUnqueueBuffers(stream->source, queued, buffers);
-        }
-    }
-
-    INX_SeekToStart(*stream);
-    INX_GetStreamPlayer().prepareStream(stream);
-
-    if (wasPlaying) {
-        alSourcePlay(stream->source);
-    }
+    INX_GetStreamPlayer().Submit(stream, INX_StreamPlayer::Command::Rewind);
 }
 
 bool NX_IsAudioStreamPlaying(NX_AudioStream* stream)
@@ -536,6 +931,21 @@ void NX_SetAudioStreamLoop(NX_AudioStream* stream, bool loop)
     stream->shouldLoop = loop;
 }
 
+NX_AudioStreamStats NX_GetAudioStreamStats(void)
+{
+    if (INX_StreamPlayerInstance == nullptr) {
+        return NX_AudioStreamStats{};
+    }
+    return INX_StreamPlayerInstance->GetStats();
+}
+
+void NX_ResetAudioStreamStats(void)
+{
+    if (INX_StreamPlayerInstance != nullptr) {
+        INX_StreamPlayerInstance->ResetStats();
+    }
+}
+
 float NX_GetAudioStreamDuration(const NX_AudioStream* stream)
 {
     switch (stream->audioFormat) {
@@ -552,9 +962,8 @@ float NX_GetAudioStreamDuration(const NX_AudioStream* stream)
         return static_cast<float>(totalFrames) / stream->decoder.mp3->sampleRate;
     }
     case INX_AudioFormat::OGG: {
-        int sampleRate = stb_vorbis_get_info(stream->decoder.ogg).sample_rate;
-        uint32_t totalSamples = stb_vorbis_stream_length_in_samples(stream->decoder.ogg);
-        return static_cast<float>(totalSamples) / sampleRate;
+        uint64_t totalFrames = stream->decoder.ogg->totalFrames;
+        return static_cast<float>(totalFrames) / stream->decoder.ogg->sampleRate;
     }
     default:
         return 0.0f;
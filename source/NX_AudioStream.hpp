@@ -11,40 +11,99 @@
 
 #include "./Detail/Util/Memory.hpp"
 #include "./INX_AudioUtils.hpp"
+#include "./INX_JobSystem.hpp"
 
 #include <stb_vorbis.h>
 #include <dr_flac.h>
 #include <dr_wav.h>
 #include <dr_mp3.h>
+#include <physfs.h>
+#include <atomic>
 #include <array>
 #include <al.h>
 
+/**
+ * OGG Vorbis decoder fed through the stb_vorbis pushdata API.
+ * Pages are read from the file into a small window, which only grows
+ * when a single packet does not fit in it.
+ */
+struct INX_OggDecoder {
+    static constexpr size_t WindowSize = 32 * 1024;
+    static constexpr size_t MaxWindowSize = 1024 * 1024;
+
+    stb_vorbis* vorbis{};
+    util::UniquePtr<uint8_t> window{};
+    size_t capacity{};
+    size_t begin{};
+    size_t end{};
+
+    // Last decoded frame, consumed across reads
+    float** outputs{};
+    int outputCount{};
+    int outputOffset{};
+
+    int channels{};
+    int sampleRate{};
+    uint64_t totalFrames{};
+};
+
 struct NX_AudioStream {
-    static constexpr size_t BufferCount = 3;
-    static constexpr size_t BufferSize = 256 * 32 * 2 * 2; // frames * blocks * channels * bytes
+    static constexpr int MinBufferCount = 2;
+    static constexpr int MaxBufferCount = 8;
+    static constexpr int DefaultBufferCount = 3;
+    static constexpr int DefaultBufferFrames = 8192;
+    static constexpr int ReadyCount = 2;
 
     // OpenAL resources
-    std::array<ALuint, BufferCount> buffers{};
+    std::array<ALuint, MaxBufferCount> buffers{};
+    int bufferCount{};
+    int bufferFrames{};
     ALuint source{};
     ALenum format{};
 
-    // Audio data and decoder
-    util::UniquePtr<uint8_t> audioData{};
+    // Source file and decoder, the file is read incrementally
+    PHYSFS_File* file{};
     INX_AudioFormat audioFormat{};
-    
+    int channels{};
+    int sampleRate{};
+
     union Decoder {
         drwav* wav;
         drflac* flac;
         drmp3* mp3;
-        stb_vorbis* ogg;
+        INX_OggDecoder* ogg;
     } decoder{};
 
-    // State flags
-    bool shouldLoop{};
+    // Decoded samples of one buffer, used when the queue is filled synchronously
+    util::UniquePtr<int16_t> decodeBuffer{};
+
+    // Buffers decoded ahead by a worker job, consumed in order by the stream thread
+    std::array<util::UniquePtr<int16_t>, ReadyCount> readySamples{};
+    std::array<size_t, ReadyCount> readyFrames{};
+    std::atomic<uint32_t> readyHead{};
+    std::atomic<uint32_t> readyTail{};
+    std::atomic<bool> decodeEnded{};
+    INX_JobCounter decodeJob{};
+
+    // State seen by the API thread
+    std::atomic<bool> shouldLoop{};
+    std::atomic<bool> isPlaying{};
+    bool isSubmitted{};
     bool isPaused{};
-    bool isPlaying{};
+
+    // State owned by the stream thread
+    bool isActive{};
+    bool isHalted{};
+    std::atomic<bool> isReleased{};
 
     ~NX_AudioStream();
 };
 
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+/** Should be called in NX_Quit(), before the job system is shut down */
+void INX_AudioStream_Quit();
+
 #endif // NX_AUDIO_STREAM_HPP
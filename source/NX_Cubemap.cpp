@@ -417,6 +417,11 @@ NX_Cubemap* NX_CreateCubemap(int size, NX_PixelFormat format)
 
 NX_Cubemap* NX_LoadCubemapFromData(const NX_Image* image)
 {
+    if (NX_IsPixelFormatCompressed(image->format)) {
+        NX_LOG(E, "RENDER: Cubemaps cannot be loaded from block compressed images");
+        return nullptr;
+    }
+
     NX_Cubemap* cubemap = INX_Pool.Create<NX_Cubemap>();
 
     /* --- Layout detection and cubemap loading --- */
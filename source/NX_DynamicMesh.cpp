@@ -8,10 +8,112 @@
 
 #include "./NX_DynamicMesh.hpp"
 
-#include "./Detail/Util/Ranges.hpp"
 #include "./INX_GlobalPool.hpp"
+
+#include <NX/NX_Platform.h>
+
+#include <algorithm>
 #include <cfloat>
 
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+static NX_BoundingBox3D INX_DynamicMesh_ComputeBounds(const NX_Vertex3D* vertices, size_t count)
+{
+    // NOTE: The position is the first member of NX_Vertex3D, so loading four floats
+    //       from it stays inside the vertex, the fourth lane is simply ignored
+
+    static_assert(offsetof(NX_Vertex3D, position) == 0 && sizeof(NX_Vertex3D) >= 4 * sizeof(float));
+
+    alignas(16) float min[4] = { +FLT_MAX, +FLT_MAX, +FLT_MAX, +FLT_MAX };
+    alignas(16) float max[4] = { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+#if defined(NX_HAS_SSE)
+
+    __m128 min0 = _mm_load_ps(min), min1 = min0;
+    __m128 max0 = _mm_load_ps(max), max1 = max0;
+
+    size_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        __m128 p0 = _mm_loadu_ps(&vertices[i].position.x);
+        __m128 p1 = _mm_loadu_ps(&vertices[i + 1].position.x);
+        min0 = _mm_min_ps(min0, p0); max0 = _mm_max_ps(max0, p0);
+        min1 = _mm_min_ps(min1, p1); max1 = _mm_max_ps(max1, p1);
+    }
+    if (i < count) {
+        __m128 p = _mm_loadu_ps(&vertices[i].position.x);
+        min0 = _mm_min_ps(min0, p); max0 = _mm_max_ps(max0, p);
+    }
+
+    _mm_store_ps(min, _mm_min_ps(min0, min1));
+    _mm_store_ps(max, _mm_max_ps(max0, max1));
+
+#elif defined(NX_HAS_NEON) || defined(NX_HAS_NEON_FMA)
+
+    float32x4_t min0 = vld1q_f32(min), min1 = min0;
+    float32x4_t max0 = vld1q_f32(max), max1 = max0;
+
+    size_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        float32x4_t p0 = vld1q_f32(&vertices[i].position.x);
+        float32x4_t p1 = vld1q_f32(&vertices[i + 1].position.x);
+        min0 = vminq_f32(min0, p0); max0 = vmaxq_f32(max0, p0);
+        min1 = vminq_f32(min1, p1); max1 = vmaxq_f32(max1, p1);
+    }
+    if (i < count) {
+        float32x4_t p = vld1q_f32(&vertices[i].position.x);
+        min0 = vminq_f32(min0, p); max0 = vmaxq_f32(max0, p);
+    }
+
+    vst1q_f32(min, vminq_f32(min0, min1));
+    vst1q_f32(max, vmaxq_f32(max0, max1));
+
+#else
+    for (size_t i = 0; i < count; i++) {
+        const NX_Vec3& p = vertices[i].position;
+        min[0] = std::min(min[0], p.x); max[0] = std::max(max[0], p.x);
+        min[1] = std::min(min[1], p.y); max[1] = std::max(max[1], p.y);
+        min[2] = std::min(min[2], p.z); max[2] = std::max(max[2], p.z);
+    }
+#endif
+
+    return { NX_VEC3(min[0], min[1], min[2]), NX_VEC3(max[0], max[1], max[2]) };
+}
+
+static void INX_DynamicMesh_Upload(NX_DynamicMesh* dynMesh, gpu::Buffer& dst, const void* data, size_t first, size_t count, size_t stride)
+{
+    const GLsizeiptr required = static_cast<GLsizeiptr>((first + count) * stride);
+
+    /* --- Grow geometrically, keeping the data already uploaded when appending --- */
+
+    if (required > dst.GetSize()) {
+        dst.Reserve(std::max(required, 2 * dst.GetSize()), first > 0);
+    }
+
+    if (count == 0) {
+        return;
+    }
+
+    /* --- Write to the staging ring and copy on the GPU --- */
+
+    // NOTE: The ring waits on the fence of a segment before reusing it, and the
+    //       copy is ordered after the draws still reading the destination, so
+    //       neither the CPU nor the driver has to stall on a buffer in use
+
+    const GLsizeiptr size = static_cast<GLsizeiptr>(count * stride);
+    const uint8_t* src = static_cast<const uint8_t*>(data) + first * stride;
+
+    gpu::RingBuffer::Range range = dynMesh->staging.Upload(src, size);
+    if (range.size == 0) {
+        NX_LOG(W, "RENDER: Dynamic mesh staging failed; Uploading directly");
+        dst.Upload(static_cast<GLintptr>(first * stride), size, src);
+        return;
+    }
+
+    dst.Copy(dynMesh->staging.GetBuffer(), range.offset, static_cast<GLintptr>(first * stride), size);
+}
+
 // ============================================================================
 // PUBLIC API
 // ============================================================================
@@ -24,7 +126,10 @@ NX_DynamicMesh* NX_CreateDynamicMesh(size_t initialCapacity)
         NX_LOG(E, "RENDER: Dynamic mesh vertex buffer memory reservation failed (requested: %zu vertices)", initialCapacity);
     }
 
-    dynMesh->buffer = INX_Pool.Create<NX_VertexBuffer3D>(nullptr, initialCapacity * sizeof(NX_Vertex3D), nullptr, 0);
+    dynMesh->buffer = INX_Pool.Create<NX_VertexBuffer3D>(nullptr, initialCapacity, nullptr, 0);
+    dynMesh->buffer->vertexCount = 0;
+
+    dynMesh->staging = gpu::RingBuffer(GL_COPY_READ_BUFFER, initialCapacity * sizeof(NX_Vertex3D));
 
     dynMesh->current = {
         .position = NX_VEC3_ZERO,
@@ -55,6 +160,9 @@ void NX_BeginDynamicMesh(NX_DynamicMesh* dynMesh, NX_PrimitiveType type, NX_Dyna
 {
     dynMesh->primitiveType = type;
     dynMesh->vertices.Clear();
+    dynMesh->indices.Clear();
+    dynMesh->firstDirtyVertex = 0;
+    dynMesh->firstDirtyIndex = 0;
     dynMesh->flags = flags;
     dynMesh->current = {
         .position = NX_VEC3_ZERO,
@@ -67,11 +175,27 @@ void NX_BeginDynamicMesh(NX_DynamicMesh* dynMesh, NX_PrimitiveType type, NX_Dyna
     };
 }
 
+void NX_AppendDynamicMesh(NX_DynamicMesh* dynMesh)
+{
+    dynMesh->firstDirtyVertex = dynMesh->vertices.GetSize();
+    dynMesh->firstDirtyIndex = dynMesh->indices.GetSize();
+}
+
 void NX_EndDynamicMesh(NX_DynamicMesh* dynMesh)
 {
+    const size_t firstVertex = dynMesh->firstDirtyVertex;
+    const size_t firstIndex = dynMesh->firstDirtyIndex;
+
+    const size_t vertexCount = dynMesh->vertices.GetSize() - firstVertex;
+    const size_t indexCount = dynMesh->indices.GetSize() - firstIndex;
+
+    /* --- Generate attributes for the recorded geometry only --- */
+
     NX_MeshData data{};
-    data.vertices = dynMesh->vertices.GetData();
-    data.vertexCount = dynMesh->vertices.GetSize();
+    data.vertices = dynMesh->vertices.GetData() + firstVertex;
+    data.vertexCount = static_cast<int>(vertexCount);
+    data.indices = dynMesh->indices.GetData() + firstIndex;
+    data.indexCount = static_cast<int>(indexCount);
 
     if (dynMesh->flags & NX_DYNAMIC_MESH_GEN_NORMALS) {
         NX_GenMeshDataNormals(&data);
@@ -81,19 +205,47 @@ void NX_EndDynamicMesh(NX_DynamicMesh* dynMesh)
         NX_GenMeshDataTangents(&data);
     }
 
-    dynMesh->buffer->Update(
-        data.vertices,
-        data.vertexCount,
-        nullptr, 0
-    );
+    // Indices are recorded relative to the first recorded vertex
+    if (firstVertex > 0) {
+        for (size_t i = 0; i < indexCount; i++) {
+            data.indices[i] += static_cast<uint32_t>(firstVertex);
+        }
+    }
+
+    /* --- Upload the dirty ranges --- */
+
+    NX_VertexBuffer3D* buffer = dynMesh->buffer;
 
-    dynMesh->aabb.min = NX_VEC3(+FLT_MAX, +FLT_MAX, +FLT_MAX);
-    dynMesh->aabb.max = NX_VEC3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    INX_DynamicMesh_Upload(dynMesh, buffer->vbo, dynMesh->vertices.GetData(), firstVertex, vertexCount, sizeof(NX_Vertex3D));
 
-    for (const NX_Vertex3D& vertex : dynMesh->vertices) {
-        dynMesh->aabb.min = NX_Vec3Min(dynMesh->aabb.min, vertex.position);
-        dynMesh->aabb.max = NX_Vec3Max(dynMesh->aabb.max, vertex.position);
+    if (!dynMesh->indices.IsEmpty())
+    {
+        if (!buffer->ebo.IsValid()) {
+            buffer->ebo = gpu::Buffer(GL_ELEMENT_ARRAY_BUFFER, dynMesh->indices.GetCapacity() * sizeof(uint32_t), nullptr, GL_DYNAMIC_DRAW);
+            buffer->vao.SetIndexBuffer(&buffer->ebo);
+        }
+        INX_DynamicMesh_Upload(dynMesh, buffer->ebo, dynMesh->indices.GetData(), firstIndex, indexCount, sizeof(uint32_t));
     }
+
+    buffer->vertexCount = static_cast<int>(dynMesh->vertices.GetSize());
+    buffer->indexCount = static_cast<int>(dynMesh->indices.GetSize());
+
+    /* --- Update the bounds, merging with the previous ones when appending --- */
+
+    NX_BoundingBox3D aabb = INX_DynamicMesh_ComputeBounds(data.vertices, vertexCount);
+
+    if (firstVertex > 0) {
+        dynMesh->aabb.min = NX_Vec3Min(dynMesh->aabb.min, aabb.min);
+        dynMesh->aabb.max = NX_Vec3Max(dynMesh->aabb.max, aabb.max);
+    }
+    else {
+        dynMesh->aabb = aabb;
+    }
+
+    /* --- Everything recorded so far is now on the GPU --- */
+
+    dynMesh->firstDirtyVertex = dynMesh->vertices.GetSize();
+    dynMesh->firstDirtyIndex = dynMesh->indices.GetSize();
 }
 
 void NX_SetDynamicMeshTexCoord(NX_DynamicMesh* dynMesh, NX_Vec2 texcoord)
@@ -122,6 +274,11 @@ void NX_AddDynamicMeshVertex(NX_DynamicMesh* dynMesh, NX_Vec3 position)
     dynMesh->vertices.PushBack(dynMesh->current);
 }
 
+void NX_AddDynamicMeshIndex(NX_DynamicMesh* dynMesh, uint32_t index)
+{
+    dynMesh->indices.PushBack(index);
+}
+
 void NX_SetDynamicMeshShadowCastMode(NX_DynamicMesh* dynMesh, NX_ShadowCastMode mode)
 {
     dynMesh->shadowCastMode = mode;
@@ -13,6 +13,7 @@
 #include <NX/NX_Shape.h>
 
 #include "./Detail/Util/DynamicArray.hpp"
+#include "./Detail/GPU/RingBuffer.hpp"
 #include "./NX_Vertex.hpp"
 
 // ============================================================================
@@ -22,10 +23,16 @@
 struct NX_DynamicMesh {
     /** Buffers and current state */
     util::DynamicArray<NX_Vertex3D> vertices{};
+    util::DynamicArray<uint32_t> indices{};
     NX_VertexBuffer3D* buffer{};
+    gpu::RingBuffer staging{};          //< Persistently mapped upload ring, copied into the buffers on the GPU
     NX_DynamicMeshFlags flags{};
     NX_Vertex3D current{};
 
+    /** Start of the geometry recorded since the last begin or append, not yet uploaded */
+    size_t firstDirtyVertex{};
+    size_t firstDirtyIndex{};
+
     /** Draw parameters */
     NX_ShadowCastMode shadowCastMode;
     NX_ShadowFaceMode shadowFaceMode;
@@ -8,11 +8,17 @@
 
 #include "./NX_Font.hpp"
 
+#include "./Detail/Util/DynamicArray.hpp"
 #include "./Detail/Util/FixedArray.hpp"
 #include "./Detail/Util/Memory.hpp"
+#include "./Detail/Util/Ranges.hpp"
 
 #include "./INX_GlobalAssets.hpp"
 #include "./INX_GlobalPool.hpp"
+#include "./INX_GlyphCache.hpp"
+#include "./INX_RectPacker.hpp"
+#include "./INX_JobSystem.hpp"
+#include "./INX_Utils.hpp"
 
 #include <NX/NX_Filesystem.h>
 #include <NX/NX_Codepoint.h>
@@ -21,6 +27,10 @@
 #include <NX/NX_Font.h>
 #include <NX/NX_Log.h>
 
+#include <algorithm>
+#include <numeric>
+#include <atomic>
+
 // ============================================================================
 // FREETYPE INCLUDES
 // ============================================================================
@@ -29,13 +39,6 @@
 #include FT_FREETYPE_H
 #include FT_GLYPH_H
 
-// ============================================================================
-// STB RECT PACK IMPLEMENTATION
-// ============================================================================
-
-#define STB_RECT_PACK_IMPLEMENTATION
-#include <stb_rect_pack.h>
-
 // ============================================================================
 // OPAQUE DEFINITION
 // ============================================================================
@@ -45,6 +48,42 @@ NX_Font::~NX_Font()
     NX_DestroyTexture(texture);
 }
 
+// ============================================================================
+// ATLAS CACHE
+// ============================================================================
+
+/**
+ * A cached atlas is a header followed by one record per glyph, in the order of
+ * the requested codepoints, then the R8 pixels of the atlas. Data is stored in
+ * the native layout of the platform, the key covers every input of the atlas
+ * generation so that a cache is never used for another font or configuration.
+ */
+constexpr char INX_FontCacheMagic[4] = { 'N', 'X', 'F', '\0' };
+constexpr uint32_t INX_FontCacheVersion = 1;
+
+struct INX_FontCacheHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t key;                   //< See INX_GetAtlasCacheKey
+    int32_t glyphCount;
+    int32_t atlasWidth;
+    int32_t atlasHeight;
+    int32_t reserved;
+};
+
+struct INX_FontCacheGlyph {
+    int32_t value;
+    int32_t xOffset;
+    int32_t yOffset;
+    int32_t xAdvance;
+    uint16_t xAtlas;
+    uint16_t yAtlas;
+    uint16_t wGlyph;
+    uint16_t hGlyph;
+};
+
+static char INX_FontCacheDir[256]{};   //< Empty when caching is disabled
+
 // ============================================================================
 // INTERNAL FUNCTIONS
 // ============================================================================
@@ -127,11 +166,74 @@ NX_Font* NX_LoadFontFromData(const void* fileData, size_t dataSize, NX_FontType
     return font;
 }
 
+NX_Font* NX_LoadDynamicFont(const char* filePath, NX_FontType type, int baseSize)
+{
+    size_t dataSize = 0;
+    void* fileData = NX_LoadFile(filePath, &dataSize);
+
+    NX_Font* font = NX_LoadDynamicFontFromData(fileData, dataSize, type, baseSize);
+    NX_Free(fileData);
+
+    return font;
+}
+
+NX_Font* NX_LoadDynamicFontFromData(const void* fileData, size_t dataSize, NX_FontType type, int baseSize)
+{
+#   define FONT_DYNAMIC_CHARS_PADDING   2
+
+    if (fileData == nullptr || dataSize == 0) {
+        NX_LOG(E, "RENDER: Failed to load dynamic font; No font data");
+        return nullptr;
+    }
+
+    /* --- Create the glyph cache, it keeps the face alive --- */
+
+    util::UniquePtr<INX_GlyphCache> cache = util::MakeUnique<INX_GlyphCache>();
+
+    if (cache == nullptr || !cache->Init(fileData, dataSize, type, baseSize, FONT_DYNAMIC_CHARS_PADDING)) {
+        NX_LOG(E, "RENDER: Failed to load dynamic font; Invalid font data or glyph cache creation failed");
+        return nullptr;
+    }
+
+    /* --- Returns object pushed into the pool --- */
+
+    NX_Font* font = INX_Pool.Create<NX_Font>();
+    if (font == nullptr) {
+        NX_LOG(E, "RENDER: Failed to load dynamic font; Object pool issue");
+        return nullptr;
+    }
+
+    font->baseSize = baseSize;
+    font->glyphPadding = FONT_DYNAMIC_CHARS_PADDING;
+    font->cache = std::move(cache);
+    font->type = type;
+
+    return font;
+}
+
 void NX_DestroyFont(NX_Font* font)
 {
     INX_Pool.Destroy(font);
 }
 
+void NX_SetFontCacheDir(const char* dirPath)
+{
+    if (dirPath == nullptr) {
+        INX_FontCacheDir[0] = '\0';
+        return;
+    }
+
+    if (SDL_strlcpy(INX_FontCacheDir, dirPath, sizeof(INX_FontCacheDir)) >= sizeof(INX_FontCacheDir)) {
+        NX_LOG(W, "RENDER: Font cache directory path is too long, caching disabled");
+        INX_FontCacheDir[0] = '\0';
+    }
+}
+
+const char* NX_GetFontCacheDir(void)
+{
+    return (INX_FontCacheDir[0] != '\0') ? INX_FontCacheDir : nullptr;
+}
+
 NX_FontType NX_GetFontType(const NX_Font* font)
 {
     return font->type;
@@ -162,10 +264,10 @@ NX_Vec2 NX_MeasureCodepoints(const NX_Font* font, const int* codepoints, int len
             textHeight += fontSize + spacing.y;
         }
         else {
-            int index = INX_GetGlyphIndex(font, letter);
-            float charWith = (font->glyphs[index].xAdvance > 0)
-                ? font->glyphs[index].xAdvance
-                : (font->glyphs[index].wGlyph + font->glyphs[index].xOffset);
+            const INX_Glyph& glyph = INX_GetFontGlyph(font, letter);
+            float charWith = (glyph.xAdvance > 0)
+                ? glyph.xAdvance
+                : (glyph.wGlyph + glyph.xOffset);
 
             currentWidth += charWith;
             currentCharsInLine++;
@@ -210,10 +312,10 @@ NX_Vec2 NX_MeasureText(const NX_Font* font, const char* text, float fontSize, NX
             textHeight += fontSize + spacing.y;
         }
         else {
-            int index = INX_GetGlyphIndex(font, letter);
-            float charWith = (font->glyphs[index].xAdvance > 0)
-                ? font->glyphs[index].xAdvance
-                : (font->glyphs[index].wGlyph + font->glyphs[index].xOffset);
+            const INX_Glyph& glyph = INX_GetFontGlyph(font, letter);
+            float charWith = (glyph.xAdvance > 0)
+                ? glyph.xAdvance
+                : (glyph.wGlyph + glyph.xOffset);
 
             currentWidth += charWith;
             currentCharsInLine++;
@@ -259,9 +361,245 @@ int INX_GetGlyphIndex(const NX_Font* font, int codepoint)
 
 const INX_Glyph& INX_GetFontGlyph(const NX_Font* font, int codepoint)
 {
+    if (font->cache != nullptr) {
+        return font->cache->GetGlyph(codepoint);
+    }
     return font->glyphs[INX_GetGlyphIndex(font, codepoint)];
 }
 
+const NX_Texture* INX_GetFontTexture(const NX_Font* font, int page)
+{
+    if (font->cache != nullptr) {
+        return font->cache->GetPageTexture(page);
+    }
+    return font->texture;
+}
+
+void INX_CommitFontCache(NX_Font* font)
+{
+    if (font->cache != nullptr) {
+        font->cache->Commit();
+    }
+}
+
+static bool INX_OpenFace(const uint8_t* fileData, int dataSize, int baseSize, FT_Library* library, FT_Face* face)
+{
+    if (FT_Init_FreeType(library) != 0) {
+        return false;
+    }
+
+    if (FT_New_Memory_Face(*library, fileData, dataSize, 0, face) != 0) {
+        FT_Done_FreeType(*library);
+        return false;
+    }
+
+    if (FT_Set_Pixel_Sizes(*face, 0, baseSize) != 0) {
+        FT_Done_Face(*face);
+        FT_Done_FreeType(*library);
+        return false;
+    }
+
+    return true;
+}
+
+static uint64_t INX_GetAtlasCacheKey(const uint8_t* fileData, int dataSize, NX_FontType fontType, int baseSize,
+                                     const int* codepoints, int codepointCount, int padding)
+{
+    uint64_t key = INX_HashBytes(fileData, dataSize);
+    key = INX_HashBytes(codepoints, codepointCount * sizeof(int), key);
+    key = INX_HashCombine(key, static_cast<uint64_t>(fontType));
+    key = INX_HashCombine(key, static_cast<uint64_t>(baseSize));
+    key = INX_HashCombine(key, static_cast<uint64_t>(padding));
+    return key;
+}
+
+static bool INX_LoadAtlasCache(const char* cachePath, uint64_t key, NX_Image* atlas, util::FixedArray<INX_Glyph>* outGlyphs)
+{
+    if (!NX_FileExists(cachePath)) {
+        return false;
+    }
+
+    size_t dataSize = 0;
+    util::UniquePtr<uint8_t> data(static_cast<uint8_t*>(NX_LoadFile(cachePath, &dataSize)));
+    if (data == nullptr || dataSize < sizeof(INX_FontCacheHeader)) {
+        NX_LOG(W, "RENDER: Ignoring font atlas cache '%s'; Missing or truncated header", cachePath);
+        return false;
+    }
+
+    /* --- Validate the header --- */
+
+    INX_FontCacheHeader header{};
+    SDL_memcpy(&header, data.get(), sizeof(header));
+
+    if (SDL_memcmp(header.magic, INX_FontCacheMagic, sizeof(INX_FontCacheMagic)) != 0
+        || header.version != INX_FontCacheVersion || header.key != key) {
+        NX_LOG(W, "RENDER: Ignoring font atlas cache '%s'; Outdated or mismatching cache", cachePath);
+        return false;
+    }
+
+    if (header.glyphCount <= 0 || header.atlasWidth <= 0 || header.atlasHeight <= 0) {
+        NX_LOG(W, "RENDER: Ignoring font atlas cache '%s'; Invalid header", cachePath);
+        return false;
+    }
+
+    const size_t glyphBytes = header.glyphCount * sizeof(INX_FontCacheGlyph);
+    const size_t pixelBytes = static_cast<size_t>(header.atlasWidth) * header.atlasHeight;
+
+    if (sizeof(header) + glyphBytes + pixelBytes != dataSize) {
+        NX_LOG(W, "RENDER: Ignoring font atlas cache '%s'; Unexpected file size", cachePath);
+        return false;
+    }
+
+    /* --- Read the glyph metrics --- */
+
+    util::FixedArray<INX_Glyph> glyphs(header.glyphCount, header.glyphCount);
+    if (glyphs.GetData() == nullptr) {
+        return false;
+    }
+
+    const uint8_t* records = data.get() + sizeof(header);
+
+    for (int i = 0; i < header.glyphCount; i++) {
+        INX_FontCacheGlyph record{};
+        SDL_memcpy(&record, records + i * sizeof(INX_FontCacheGlyph), sizeof(record));
+        glyphs[i].value = record.value;
+        glyphs[i].xOffset = record.xOffset;
+        glyphs[i].yOffset = record.yOffset;
+        glyphs[i].xAdvance = record.xAdvance;
+        glyphs[i].xAtlas = record.xAtlas;
+        glyphs[i].yAtlas = record.yAtlas;
+        glyphs[i].wGlyph = record.wGlyph;
+        glyphs[i].hGlyph = record.hGlyph;
+    }
+
+    /* --- Read the atlas pixels --- */
+
+    atlas->pixels = NX_Malloc(pixelBytes);
+    if (atlas->pixels == nullptr) {
+        return false;
+    }
+
+    SDL_memcpy(atlas->pixels, records + glyphBytes, pixelBytes);
+    atlas->w = header.atlasWidth;
+    atlas->h = header.atlasHeight;
+    atlas->format = NX_PIXEL_FORMAT_R8;
+
+    *outGlyphs = std::move(glyphs);
+
+    return true;
+}
+
+static void INX_SaveAtlasCache(const char* cachePath, uint64_t key, const NX_Image& atlas, const util::FixedArray<INX_Glyph>& glyphs)
+{
+    const int glyphCount = glyphs.GetSize();
+    const size_t glyphBytes = glyphCount * sizeof(INX_FontCacheGlyph);
+    const size_t pixelBytes = static_cast<size_t>(atlas.w) * atlas.h;
+    const size_t dataSize = sizeof(INX_FontCacheHeader) + glyphBytes + pixelBytes;
+
+    util::UniquePtr<uint8_t> data = util::MakeUniqueArray<uint8_t>(dataSize);
+    if (data == nullptr) {
+        return;
+    }
+
+    /* --- Write the header --- */
+
+    INX_FontCacheHeader header{};
+    SDL_memcpy(header.magic, INX_FontCacheMagic, sizeof(INX_FontCacheMagic));
+    header.version = INX_FontCacheVersion;
+    header.key = key;
+    header.glyphCount = glyphCount;
+    header.atlasWidth = atlas.w;
+    header.atlasHeight = atlas.h;
+
+    SDL_memcpy(data.get(), &header, sizeof(header));
+
+    /* --- Write the glyph metrics and the atlas pixels --- */
+
+    uint8_t* records = data.get() + sizeof(header);
+
+    for (int i = 0; i < glyphCount; i++) {
+        const INX_FontCacheGlyph record {
+            .value = glyphs[i].value,
+            .xOffset = glyphs[i].xOffset,
+            .yOffset = glyphs[i].yOffset,
+            .xAdvance = glyphs[i].xAdvance,
+            .xAtlas = glyphs[i].xAtlas,
+            .yAtlas = glyphs[i].yAtlas,
+            .wGlyph = glyphs[i].wGlyph,
+            .hGlyph = glyphs[i].hGlyph
+        };
+        SDL_memcpy(records + i * sizeof(INX_FontCacheGlyph), &record, sizeof(record));
+    }
+
+    SDL_memcpy(records + glyphBytes, atlas.pixels, pixelBytes);
+
+    /* --- Write the file --- */
+
+    NX_CreateDirectory(INX_FontCacheDir);
+
+    if (!NX_WriteFile(cachePath, data.get(), dataSize)) {
+        NX_LOG(W, "RENDER: Failed to write font atlas cache '%s'", cachePath);
+        return;
+    }
+
+    NX_LOG(V, "RENDER: Font atlas cache '%s' written (%zu bytes)", cachePath, dataSize);
+}
+
+static bool INX_PackAtlas(util::FixedArray<INX_Glyph>* glyphs, int padding, int* atlasW, int* atlasH)
+{
+#   define FONT_ATLAS_MAX_SIZE 16384
+
+    const int glyphCount = glyphs->GetSize();
+
+    // NOTE: MaxRects wastes less space when the tallest glyphs are placed first
+    util::DynamicArray<int> order(glyphCount);
+    if (order.GetSize() != static_cast<size_t>(glyphCount)) {
+        NX_LOG(E, "RENDER: Failed to pack font atlas; Out of memory");
+        return false;
+    }
+
+    std::iota(order.Begin(), order.End(), 0);
+    std::sort(order.Begin(), order.End(), [glyphs](int a, int b) {
+        const INX_Glyph& ga = (*glyphs)[a];
+        const INX_Glyph& gb = (*glyphs)[b];
+        return (ga.hGlyph != gb.hGlyph) ? ga.hGlyph > gb.hGlyph : ga.wGlyph > gb.wGlyph;
+    });
+
+    INX_RectPacker packer{};
+
+    while (true)
+    {
+        packer.Reset(*atlasW, *atlasH);
+        bool packed = true;
+
+        for (int index : order) {
+            INX_Glyph& glyph = (*glyphs)[index];
+            if (glyph.wGlyph == 0 || glyph.hGlyph == 0) {
+                continue;
+            }
+            INX_RectPacker::Rect rect{};
+            if (!packer.Insert(glyph.wGlyph + 2 * padding, glyph.hGlyph + 2 * padding, &rect)) {
+                packed = false;
+                break;
+            }
+            glyph.xAtlas = rect.x + padding;
+            glyph.yAtlas = rect.y + padding;
+        }
+
+        if (packed) {
+            return true;
+        }
+
+        // Grow the smallest side and pack again
+        if (*atlasW >= FONT_ATLAS_MAX_SIZE && *atlasH >= FONT_ATLAS_MAX_SIZE) {
+            NX_LOG(E, "RENDER: Failed to pack font atlas; Glyphs exceed %ix%i pixels", FONT_ATLAS_MAX_SIZE, FONT_ATLAS_MAX_SIZE);
+            return false;
+        }
+        if (*atlasH < *atlasW) *atlasH *= 2;
+        else *atlasW *= 2;
+    }
+}
+
 bool INX_GenerateAtlas(NX_Image* atlas, const uint8_t* fileData, int dataSize,
                        NX_FontType fontType, int baseSize, const int* codepoints,
                        int codepointCount, int padding, util::FixedArray<INX_Glyph>* outGlyphs)
@@ -270,60 +608,23 @@ bool INX_GenerateAtlas(NX_Image* atlas, const uint8_t* fileData, int dataSize,
 
     /* --- Some basic initialization --- */
 
-    FT_Render_Mode ftRenderMode{};
-    FT_Int32 ftGlyphFlags = FT_LOAD_RENDER | FT_LOAD_NO_AUTOHINT;
-
     switch (fontType) {
     case NX_FONT_NORMAL:
-        ftRenderMode = FT_RENDER_MODE_NORMAL;
-        ftGlyphFlags |= FT_LOAD_TARGET_NORMAL;
-        break;
     case NX_FONT_LIGHT:
-        ftRenderMode = FT_RENDER_MODE_LIGHT;
-        ftGlyphFlags |= FT_LOAD_TARGET_LIGHT;
-        break;
     case NX_FONT_MONO:
-        ftRenderMode = FT_RENDER_MODE_MONO;
-        ftGlyphFlags |= FT_LOAD_TARGET_MONO;
-        break;
     case NX_FONT_SDF:
-        ftRenderMode = FT_RENDER_MODE_SDF;
-        ftGlyphFlags |= FT_LOAD_TARGET_NORMAL;
         break;
     default:
         NX_LOG(E, "RENDER: Faild to load font; Invalid font type (%i)", fontType);
         return false;
     }
 
-    /* --- Font validation and init --- */
+    /* --- Font validation --- */
 
     if (!fileData) {
         return false;
     }
 
-    FT_Library ftLibrary;
-    if (FT_Init_FreeType(&ftLibrary) != 0) {
-        return false;
-    }
-
-    FT_Face ftFace;
-    if (FT_New_Memory_Face(ftLibrary, fileData, dataSize, 0, &ftFace) != 0) {
-        FT_Done_FreeType(ftLibrary);
-        return false;
-    }
-
-    if (FT_Set_Pixel_Sizes(ftFace, 0, baseSize) != 0) {
-        FT_Done_Face(ftFace);
-        FT_Done_FreeType(ftLibrary);
-        return false;
-    }
-
-    /* --- Get font metrics --- */
-
-    int ascent  = ftFace->size->metrics.ascender  >> 6;
-  //int descent = ftFace->size->metrics.descender >> 6;
-  //int lineGap = (ftFace->size->metrics.height >> 6) - (ascent - descent);
-
     /* --- Generate default codepoints if needed --- */
 
     util::UniquePtr<int> defaultCodepoints;
@@ -332,8 +633,6 @@ bool INX_GenerateAtlas(NX_Image* atlas, const uint8_t* fileData, int dataSize,
         codepointCount = (codepointCount > 0) ? codepointCount : 95;
         defaultCodepoints = util::MakeUniqueArray<int>(codepointCount);
         if (!defaultCodepoints) {
-            FT_Done_Face(ftFace);
-            FT_Done_FreeType(ftLibrary);
             return false;
         }
         // Generate ASCII printable characters (32-126)
@@ -343,110 +642,74 @@ bool INX_GenerateAtlas(NX_Image* atlas, const uint8_t* fileData, int dataSize,
         codepoints = defaultCodepoints.get();
     }
 
-    /* --- Allocate working buffers --- */
+    /* --- Try the atlas cache first --- */
 
-    util::UniquePtr<stbrp_rect> packRects = util::MakeUniqueArray<stbrp_rect>(codepointCount);
-    if (packRects == nullptr) {
-        FT_Done_Face(ftFace);
-        FT_Done_FreeType(ftLibrary);
-        return false;
+    char cachePath[512]{};
+    uint64_t cacheKey = 0;
+
+    if (INX_FontCacheDir[0] != '\0') {
+        cacheKey = INX_GetAtlasCacheKey(fileData, dataSize, fontType, baseSize, codepoints, codepointCount, padding);
+        SDL_snprintf(cachePath, sizeof(cachePath), "%s/%016llx.nxf", INX_FontCacheDir, static_cast<unsigned long long>(cacheKey));
+        if (INX_LoadAtlasCache(cachePath, cacheKey, atlas, outGlyphs)) {
+            return true;
+        }
     }
 
+    /* --- Allocate the glyph array --- */
+
     util::FixedArray<INX_Glyph> glyphs(codepointCount, codepointCount);
     if (glyphs.GetData() == nullptr) {
-        FT_Done_Face(ftFace);
-        FT_Done_FreeType(ftLibrary);
         return false;
     }
 
-    /* --- Generate glyphs and calculate dimensions --- */
+    /* --- Rasterize the glyphs in parallel --- */
 
-    int totalArea = 0;
+    // NOTE: FreeType objects cannot be shared between threads,
+    //       each range opens its own face from the same font data
+    std::atomic<bool> faceFailed{false};
 
-    for (int i = 0; i < codepointCount; i++)
+    INX_Jobs.ParallelFor(codepointCount, 16, [&](int begin, int end)
     {
-        INX_Glyph& glyph = glyphs[i];
-        int ch = codepoints[i];
-        glyph.value = ch;
+        FT_Library ftLibrary{};
+        FT_Face ftFace{};
 
-        // Get the glyph index and load it
-        FT_UInt glyphIndex = FT_Get_Char_Index(ftFace, ch);
-        if (glyphIndex == 0) {
-            continue;
-        }
-        if (FT_Load_Glyph(ftFace, glyphIndex, ftGlyphFlags) != 0) {
-            continue;
-        }
-
-        // Space character
-        if (ch == 32) {
-            glyph.xAdvance = (int)(ftFace->glyph->advance.x >> 6);
-            glyph.xOffset = glyph.yOffset = 0;
-            glyph.wGlyph = glyph.xAdvance;
-            glyph.hGlyph = baseSize;
+        if (!INX_OpenFace(fileData, dataSize, baseSize, &ftLibrary, &ftFace)) {
+            faceFailed.store(true, std::memory_order_relaxed);
+            return;
         }
 
-        // Regular character
-        else {
-            // Rendering the glyph
-            if (FT_Render_Glyph(ftFace->glyph, ftRenderMode) != 0) {
-                continue;
+        for (int i = begin; i < end; i++) {
+            INX_Glyph& glyph = glyphs[i];
+            glyph = INX_Glyph{};
+            glyph.value = codepoints[i];
+            if (!INX_RasterizeGlyph(ftFace, fontType, baseSize, codepoints[i], &glyph)) {
+                glyph.wGlyph = glyph.hGlyph = 0;
             }
+        }
 
-            // Get glyph and bitmap references
-            const FT_GlyphSlot ftGlyph = ftFace->glyph;
-            const FT_Bitmap& ftBitmap = ftGlyph->bitmap;
-
-            // Calculating the number of pixels in the bitmap
-            int pixelCount = ftBitmap.width * ftBitmap.rows;
-            if (pixelCount == 0) continue;
-
-            // Allocation to keep the bitmap in our glyph cache
-            glyph.pixels = util::MakeUniqueArray<uint8_t>(pixelCount);
-            if (glyph.pixels == nullptr) continue;
+        FT_Done_Face(ftFace);
+        FT_Done_FreeType(ftLibrary);
+    });
 
-            // Copying the rasterized bitmap to our glyph cache
-            if (fontType != NX_FONT_MONO) {
-                SDL_memcpy(glyph.pixels.get(), ftBitmap.buffer, pixelCount);
-            }
-            else {
-                const FT_Bitmap &bm = ftBitmap;
-                for (unsigned int y = 0; y < bm.rows; ++y) {
-                    for (unsigned int x = 0; x < bm.width; ++x) {
-                        int byteIndex = y * bm.pitch + (x >> 3);
-                        int bitIndex = 7 - (x & 7);
-                        bool pixelOn = (bm.buffer[byteIndex] >> bitIndex) & 1;
-                        glyph.pixels.get()[y * bm.width + x] = pixelOn ? 255 : 0;
-                    }
-                }
-            }
+    if (faceFailed.load(std::memory_order_relaxed)) {
+        return false;
+    }
 
-            // Get horizontal advance
-            glyph.xAdvance = (int)(ftGlyph->advance.x >> 6);
+    /* --- Calculate Atlas Dimensions --- */
 
-            // Calculate the offset needed to draw the glyph
-            glyph.xOffset = ftGlyph->bitmap_left;
-            glyph.yOffset = ascent - ftGlyph->bitmap_top;
+    int totalArea = 0;
 
-            // Keeps the pixel dimensions of the glyph
-            glyph.wGlyph = ftBitmap.width;
-            glyph.hGlyph = ftBitmap.rows;
+    for (int i = 0; i < codepointCount; i++) {
+        if (glyphs[i].wGlyph > 0 && glyphs[i].hGlyph > 0) {
+            totalArea += (glyphs[i].wGlyph + 2 * padding) * (glyphs[i].hGlyph + 2 * padding);
         }
-
-        packRects.get()[i].id = i;
-        packRects.get()[i].w = glyph.wGlyph + 2 * padding;
-        packRects.get()[i].h = glyph.hGlyph + 2 * padding;
-        totalArea += packRects.get()[i].w * packRects.get()[i].h;
     }
 
-    /* --- Calculate Atlas Dimensions --- */
-
-    // NOTE: This naive method is currently the most stable and provides
-    //       the best size efficiency across various configurations,
-    //       though it can be significantly improved...
+    // NOTE: The estimate only gives the starting size,
+    //       the atlas grows if the glyphs do not fit in it
 
     int estimatedArea = (int)(totalArea * 1.3f); // 30% safety margin
-    int atlasSize = (int)roundf(sqrtf((float)estimatedArea));
+    int atlasSize = std::max((int)roundf(sqrtf((float)estimatedArea)), 1);
 
     // Get next po2 if necessary
     if (!NX_IsPowerOfTwo(atlasSize)) {
@@ -454,51 +717,35 @@ bool INX_GenerateAtlas(NX_Image* atlas, const uint8_t* fileData, int dataSize,
     }
 
     // Try rectangle first (wider than tall)
-    atlas->w = atlasSize;
-    atlas->h = atlasSize / 2;
+    int atlasW = atlasSize;
+    int atlasH = std::max(atlasSize / 2, 1);
 
     // Use square if rectangle is too small
-    if (totalArea > atlas->w * atlas->h) {
-        atlas->h = atlasSize;
+    if (totalArea > atlasW * atlasH) {
+        atlasH = atlasSize;
     }
 
-    /* --- Create Atlas Image --- */
+    /* --- Pack the glyphs --- */
 
-    atlas->pixels = NX_Calloc(atlas->w * atlas->h, 1);
-    if (!atlas->pixels) {
-        FT_Done_Face(ftFace);
-        FT_Done_FreeType(ftLibrary);
+    if (!INX_PackAtlas(&glyphs, padding, &atlasW, &atlasH)) {
         return false;
     }
-    atlas->format = NX_PIXEL_FORMAT_R8;
 
-    /* --- Rectangle Packing Setup --- */
-
-    util::UniquePtr<stbrp_context> packContext = util::MakeUnique<stbrp_context>();
-    util::UniquePtr<stbrp_node> packNodes = util::MakeUniqueArray<stbrp_node>(atlas->w);
+    /* --- Create Atlas Image --- */
 
-    if (!packContext || !packNodes) {
-        NX_Free(atlas->pixels);
-        FT_Done_Face(ftFace);
-        FT_Done_FreeType(ftLibrary);
-        SDL_memset(atlas, 0, sizeof(*atlas));
+    atlas->pixels = NX_Calloc(atlasW * atlasH, 1);
+    if (!atlas->pixels) {
         return false;
     }
-
-    stbrp_init_target(packContext.get(), atlas->w, atlas->h, packNodes.get(), atlas->w);
-    stbrp_pack_rects(packContext.get(), packRects.get(), codepointCount);
+    atlas->w = atlasW;
+    atlas->h = atlasH;
+    atlas->format = NX_PIXEL_FORMAT_R8;
 
     /* --- Copy Stored INX_Glyph Pixels to Atlas --- */
 
     for (int i = 0; i < codepointCount; i++)
     {
-        if (!packRects.get()[i].was_packed) {
-            continue;
-        }
-
         INX_Glyph* glyph = &glyphs[i];
-        glyph->xAtlas = packRects.get()[i].x + padding;
-        glyph->yAtlas = packRects.get()[i].y + padding;
 
         // Skip spaces and null pixels
         if (!glyph->pixels || glyph->value == 32) {
@@ -513,16 +760,20 @@ bool INX_GenerateAtlas(NX_Image* atlas, const uint8_t* fileData, int dataSize,
             SDL_memcpy(atlasLine, glyphData, glyph->wGlyph);
             atlasLine += atlas->w, glyphData += glyph->wGlyph;
         }
+
+        // The atlas now holds the pixels
+        glyph->pixels.reset();
     }
 
-    /* --- Keeps the generated glyph array --- */
+    /* --- Save the atlas for the next loads --- */
 
-    *outGlyphs = std::move(glyphs);
+    if (cachePath[0] != '\0') {
+        INX_SaveAtlasCache(cachePath, cacheKey, *atlas, glyphs);
+    }
 
-    /* --- Cleanup --- */
+    /* --- Keeps the generated glyph array --- */
 
-    FT_Done_Face(ftFace);
-    FT_Done_FreeType(ftLibrary);
+    *outGlyphs = std::move(glyphs);
 
     return true;
 }
@@ -19,6 +19,8 @@
 // OPAQUE DEFINITION
 // ============================================================================
 
+class INX_GlyphCache;
+
 struct INX_Glyph {
     util::UniquePtr<uint8_t> pixels;    //< Pixels of the glyph (R8 unorm)
     int value;                          //< Unicode codepoint value
@@ -29,6 +31,7 @@ struct INX_Glyph {
     uint16_t yAtlas;                    //< Y-coordinate position in texture atlas
     uint16_t wGlyph;                    //< Width in pixels of the glyph (this also applies to the atlas)
     uint16_t hGlyph;                    //< Height in pixels of the glyph (this also applies to the atlas)
+    uint16_t page{0};                   //< Atlas page of the glyph, always zero for static fonts
 };
 
 struct NX_Font {
@@ -37,6 +40,7 @@ struct NX_Font {
     NX_Texture* texture{};                //< Texture atlas containing all glyph images
     util::FixedArray<INX_Glyph> glyphs{}; //< Array of glyph information structures
     NX_FontType type{};                   //< Font rendering type used during text rendering
+    util::UniquePtr<INX_GlyphCache> cache{}; //< Only set for dynamic fonts, glyphs are then empty
     ~NX_Font();
 };
 
@@ -45,5 +49,7 @@ struct NX_Font {
 // ============================================================================
 
 const INX_Glyph& INX_GetFontGlyph(const NX_Font* font, int codepoint);
+const NX_Texture* INX_GetFontTexture(const NX_Font* font, int page);
+void INX_CommitFontCache(NX_Font* font);
 
 #endif // NX_FONT_HPP
@@ -11,6 +11,12 @@
 #include <NX/NX_Math.h>
 #include <NX/NX_Log.h>
 
+#include "./INX_BlockCompression.hpp"
+#include "./INX_ImageContainer.hpp"
+#include "./INX_ImageMipmaps.hpp"
+#include "./INX_JobSystem.hpp"
+#include "./Detail/Util/Ranges.hpp"
+
 #include <SDL3/SDL_stdinc.h>
 #include <fp16.h>
 
@@ -98,6 +104,21 @@ static NX_Image INX_DecodeImage(const void* data, size_t size, int reqChannels)
     return image;
 }
 
+/** Keeps the first level of a DDS or KTX2 container */
+static NX_Image INX_DecodeContainer(const void* data, size_t size)
+{
+    util::DynamicArray<NX_Image> levels;
+    if (!INX_LoadImageContainer(data, size, &levels)) {
+        return NX_Image{};
+    }
+
+    for (size_t i = 1; i < levels.GetSize(); i++) {
+        NX_DestroyImage(&levels[i]);
+    }
+
+    return levels[0];
+}
+
 static NX_PixelFormat INX_GetBestFormat(std::initializer_list<NX_Color> colors, int count)
 {
     auto fitsInHalf = [](float f) -> bool {
@@ -137,12 +158,12 @@ NX_Image NX_CreateImage(int w, int h, NX_PixelFormat format)
         return image;
     }
 
-    int bytesPerPixel = NX_GetPixelBytes(format);
-    if (bytesPerPixel == 0) {
+    size_t size = NX_GetImageDataSize(w, h, format);
+    if (size == 0) {
         return image;
     }
 
-    void* pixels = SDL_calloc(w * h, bytesPerPixel);
+    void* pixels = SDL_calloc(1, size);
     if (!pixels) {
         return image;
     }
@@ -192,6 +213,10 @@ NX_Image NX_CreateImageFromData(const void* pixels, int w, int h, NX_PixelFormat
 
 NX_Image NX_LoadImageFromData(const void* data, size_t size)
 {
+    if (INX_IsImageContainer(data, size)) {
+        return INX_DecodeContainer(data, size);
+    }
+
     int channels;
     stbi_info_from_memory((const unsigned char*)data, size, NULL, NULL, &channels);
 
@@ -200,6 +225,10 @@ NX_Image NX_LoadImageFromData(const void* data, size_t size)
 
 NX_Image NX_LoadImageRawFromData(const void* data, size_t size)
 {
+    if (INX_IsImageContainer(data, size)) {
+        return INX_DecodeContainer(data, size);
+    }
+
     return INX_DecodeImage(data, size, 0);
 }
 
@@ -471,6 +500,15 @@ NX_Image NX_CopyImage(const NX_Image* image, NX_PixelFormat format)
         return result;
     }
 
+    if (NX_IsPixelFormatCompressed(image->format)) {
+        NX_LOG(E, "IMAGE: Cannot convert a block compressed image");
+        return result;
+    }
+
+    if (NX_IsPixelFormatCompressed(format)) {
+        return NX_CompressImage(image, format);
+    }
+
     size_t size = image->w * image->h;
     size_t bpp = NX_GetPixelBytes(format);
 
@@ -502,6 +540,13 @@ NX_Image NX_ComposeImagesRGB(const NX_Image* sources[3], NX_Color defaultColor)
 {
     NX_Image image{};
 
+    for (int i = 0; i < 3; i++) {
+        if (sources[i] && NX_IsPixelFormatCompressed(sources[i]->format)) {
+            NX_LOG(E, "IMAGE: Cannot compose block compressed images");
+            return image;
+        }
+    }
+
     /* --- Determine dimensions --- */
 
     int w = 0, h = 0;
@@ -597,14 +642,16 @@ NX_Image NX_ComposeImagesRGB(const NX_Image* sources[3], NX_Color defaultColor)
 
 void NX_SetImagePixel(const NX_Image* image, int x, int y, NX_Color color)
 {
-    if (image && image->pixels && x >= 0 && x < image->w && y >= 0 && y < image->h) {
+    if (image && image->pixels && !NX_IsPixelFormatCompressed(image->format) &&
+        x >= 0 && x < image->w && y >= 0 && y < image->h) {
         NX_WritePixel(image->pixels, y * image->w + x, image->format, color);
     }
 }
 
 NX_Color NX_GetImagePixel(const NX_Image* image, int x, int y)
 {
-    if (image && image->pixels && x >= 0 && x < image->w && y >= 0 && y < image->h) {
+    if (image && image->pixels && !NX_IsPixelFormatCompressed(image->format) &&
+        x >= 0 && x < image->w && y >= 0 && y < image->h) {
         return NX_ReadPixel(image->pixels, y * image->w + x, image->format);
     }
     return NX_BLANK;
@@ -616,6 +663,15 @@ void NX_ConvertImage(NX_Image* image, NX_PixelFormat format)
         return;
     }
 
+    if (NX_IsPixelFormatCompressed(image->format) || NX_IsPixelFormatCompressed(format)) {
+        NX_Image converted = NX_CopyImage(image, format);
+        if (converted.pixels != NULL) {
+            NX_DestroyImage(image);
+            *image = converted;
+        }
+        return;
+    }
+
     size_t size = image->w * image->h;
     size_t bpp = NX_GetPixelBytes(format);
 
@@ -642,6 +698,11 @@ void NX_InvertImage(const NX_Image* image)
         return;
     }
 
+    if (NX_IsPixelFormatCompressed(image->format)) {
+        NX_LOG(E, "IMAGE: Cannot invert a block compressed image");
+        return;
+    }
+
     NX_PixelFormat format = image->format;
     void* pixels = image->pixels;
 
@@ -665,6 +726,11 @@ void NX_BlitImage(
         return;
     }
 
+    if (NX_IsPixelFormatCompressed(src->format) || NX_IsPixelFormatCompressed(dst->format)) {
+        NX_LOG(E, "IMAGE: Cannot blit block compressed images");
+        return;
+    }
+
     if (srcX < 0) { srcW += srcX; srcX = 0; }
     if (srcY < 0) { srcH += srcY; srcY = 0; }
     if (srcX + srcW > src->w) srcW = src->w - srcX;
@@ -705,6 +771,152 @@ void NX_BlitImage(
     }
 }
 
+NX_Image* NX_GenImageMipmaps(const NX_Image* image, NX_MipmapFilter filter, bool srgb, float alphaCutoff, int* levelCount)
+{
+    *levelCount = 0;
+
+    if (image == NULL || image->pixels == NULL || image->w <= 0 || image->h <= 0) {
+        NX_LOG(E, "IMAGE: Failed to generate mipmaps; Source image is invalid");
+        return NULL;
+    }
+
+    if (NX_IsPixelFormatCompressed(image->format)) {
+        NX_LOG(E, "IMAGE: Failed to generate mipmaps; Block compressed images are not supported");
+        return NULL;
+    }
+
+    util::DynamicArray<NX_Image> mipmaps;
+    if (!INX_GenImageMipmaps(*image, filter, srgb, alphaCutoff, &mipmaps)) {
+        NX_LOG(E, "IMAGE: Failed to generate mipmaps; Out of memory");
+        return NULL;
+    }
+
+    const int count = 1 + static_cast<int>(mipmaps.GetSize());
+
+    const size_t baseSize = NX_GetImageDataSize(image->w, image->h, image->format);
+
+    NX_Image* levels = static_cast<NX_Image*>(SDL_malloc(count * sizeof(NX_Image)));
+    if (levels != NULL) {
+        levels[0] = *image;
+        levels[0].pixels = SDL_malloc(baseSize);
+    }
+
+    if (levels == NULL || levels[0].pixels == NULL) {
+        NX_LOG(E, "IMAGE: Failed to generate mipmaps; Out of memory");
+        for (NX_Image& level : mipmaps) NX_DestroyImage(&level);
+        SDL_free(levels);
+        return NULL;
+    }
+
+    SDL_memcpy(levels[0].pixels, image->pixels, baseSize);
+    std::copy(mipmaps.Begin(), mipmaps.End(), levels + 1);
+    *levelCount = count;
+
+    return levels;
+}
+
+void NX_DestroyImageMipmaps(NX_Image* levels, int levelCount)
+{
+    if (levels == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < levelCount; i++) {
+        NX_DestroyImage(&levels[i]);
+    }
+
+    SDL_free(levels);
+}
+
+NX_Image NX_CompressImage(const NX_Image* image, NX_PixelFormat format)
+{
+    NX_Image result{};
+
+    const int blockBytes = INX_GetBlockBytes(format);
+    if (blockBytes == 0) {
+        NX_LOG(E, "IMAGE: Failed to compress image; Target format is not block compressed");
+        return result;
+    }
+
+    if (image == NULL || image->pixels == NULL || image->w <= 0 || image->h <= 0) {
+        NX_LOG(E, "IMAGE: Failed to compress image; Source image is invalid");
+        return result;
+    }
+
+    if (NX_IsPixelFormatCompressed(image->format)) {
+        NX_LOG(E, "IMAGE: Failed to compress image; Source image is already compressed");
+        return result;
+    }
+
+    /* --- Blocks are encoded from RGBA8 --- */
+
+    NX_Image converted{};
+    const NX_Image* source = image;
+
+    if (image->format != NX_PIXEL_FORMAT_RGBA8) {
+        converted = NX_CopyImage(image, NX_PIXEL_FORMAT_RGBA8);
+        if (converted.pixels == NULL) return result;
+        source = &converted;
+    }
+
+    const int xBlocks = (image->w + 3) / 4;
+    const int yBlocks = (image->h + 3) / 4;
+    const size_t size = static_cast<size_t>(xBlocks) * yBlocks * blockBytes;
+
+    uint8_t* blocks = static_cast<uint8_t*>(SDL_malloc(size));
+    if (blocks == NULL) {
+        NX_LOG(E, "IMAGE: failed to allocate %zu bytes for image compression", size);
+        NX_DestroyImage(&converted);
+        return result;
+    }
+
+    /* --- Encode the rows of blocks in parallel, edges are clamped --- */
+
+    const uint8_t* pixels = static_cast<const uint8_t*>(source->pixels);
+    const int w = image->w, h = image->h;
+
+    INX_Jobs.ParallelFor(yBlocks, 4, [&](int begin, int end) {
+        uint8_t block[64];
+        for (int by = begin; by < end; by++) {
+            for (int bx = 0; bx < xBlocks; bx++) {
+                for (int i = 0; i < 16; i++) {
+                    int x = std::min(4 * bx + (i & 3), w - 1);
+                    int y = std::min(4 * by + (i >> 2), h - 1);
+                    SDL_memcpy(block + 4 * i, pixels + 4 * (static_cast<size_t>(y) * w + x), 4);
+                }
+                INX_EncodeBlock(format, block, blocks + (static_cast<size_t>(by) * xBlocks + bx) * blockBytes);
+            }
+        }
+    });
+
+    NX_DestroyImage(&converted);
+
+    result.pixels = blocks;
+    result.w = image->w;
+    result.h = image->h;
+    result.format = format;
+
+    return result;
+}
+
+bool NX_IsPixelFormatCompressed(NX_PixelFormat format)
+{
+    return INX_GetBlockBytes(format) > 0;
+}
+
+size_t NX_GetImageDataSize(int w, int h, NX_PixelFormat format)
+{
+    if (w <= 0 || h <= 0) {
+        return 0;
+    }
+
+    if (int blockBytes = INX_GetBlockBytes(format)) {
+        return static_cast<size_t>((w + 3) / 4) * ((h + 3) / 4) * blockBytes;
+    }
+
+    return static_cast<size_t>(w) * h * NX_GetPixelBytes(format);
+}
+
 int NX_GetPixelBytes(NX_PixelFormat format)
 {
     switch (format) {
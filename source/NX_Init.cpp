@@ -14,12 +14,17 @@
 #include "./INX_GlobalAssets.hpp"
 #include "./INX_GlobalState.hpp"
 #include "./INX_GlobalPool.hpp"
+#include "./INX_JobSystem.hpp"
 
 #include "./NX_Render3D.hpp"
 #include "./NX_Render2D.hpp"
+#include "./NX_Texture.hpp"
+#include "./NX_AudioStream.hpp"
+#include "./NX_AudioClip.hpp"
 #include "./NX_Audio.hpp"
 
 #include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_cpuinfo.h>
 #include <SDL3/SDL_stdinc.h>
 #include <SDL3/SDL_error.h>
 #include <SDL3/SDL_video.h>
@@ -109,6 +114,15 @@ static bool INX_PhysFS_Init()
     return true;
 }
 
+static bool INX_JobSystem_Init(NX_AppDesc* desc)
+{
+    if (desc->jobs.workerCount == 0) {
+        desc->jobs.workerCount = NX_MAX(SDL_GetNumLogicalCPUCores() - 1, 0);
+    }
+
+    return INX_Jobs.Init(NX_MAX(desc->jobs.workerCount, 0));
+}
+
 static SDL_WindowFlags INX_GetWindowFlags(NX_Flags flags)
 {
     SDL_WindowFlags windowFlags = 0;
@@ -321,6 +335,10 @@ bool NX_InitEx(const char* title, int w, int h, NX_AppDesc* desc)
         return false;
     }
 
+    if (!INX_JobSystem_Init(desc)) {
+        return false;
+    }
+
     /* --- Init each modules --- */
 
     if (!INX_DisplayState_Init(title, w, h, *desc)) {
@@ -350,13 +368,21 @@ bool NX_InitEx(const char* title, int w, int h, NX_AppDesc* desc)
 
 void NX_Quit()
 {
+    INX_AudioStream_Quit();
+    INX_Jobs.Quit();
+    INX_AsyncLoad_Quit();
+    INX_TextureStreaming_Quit();
+
     INX_Programs.UnloadAll();
     INX_Assets.UnloadAll();
+    INX_TextureCache_Clear();
+    INX_TextureUpload_Quit();
     INX_Pool.UnloadAll();
 
     INX_Render3DState_Quit();
     INX_Render2DState_Quit();
     INX_DisplayState_Quit();
+    INX_AudioClip_Quit();
     INX_AudioState_Quit();
 
     INX_KeyboardState_Quit();
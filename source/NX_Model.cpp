@@ -13,15 +13,304 @@
 #include "./Importer/SkeletonImporter.hpp"
 #include "./Importer/SceneImporter.hpp"
 #include "./Importer/MeshImporter.hpp"
+#include "./Importer/ModelCache.hpp"
 #include "./INX_Utils.hpp"
 
 #include "./INX_GlobalPool.hpp"
+#include "./NX_AsyncLoad.hpp"
+#include "./NX_Texture.hpp"
+
 #include <NX/NX_Filesystem.h>
 #include <NX/NX_Material.h>
 #include <NX/NX_Skeleton.h>
 #include <NX/NX_Memory.h>
 #include <NX/NX_Log.h>
 
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <string>
+#include <array>
+
+// ============================================================================
+// ASYNCHRONOUS LOADING
+// ============================================================================
+
+/**
+ * State shared by the stages of an asynchronous model load.
+ * Everything up to the images is produced by the worker, the GPU objects
+ * are then created one by one on the main thread.
+ */
+struct INX_AsyncModel {
+    using MaterialKeys = std::array<uint64_t, import::TextureLoader::MAP_COUNT>;
+
+    /** Source file, consumed in place when it is a model cache */
+    std::string filePath;
+    void* fileData{};
+    size_t fileSize{};
+    bool isCache{};
+
+    /** Decoded scene */
+    std::unique_ptr<import::SceneImporter> importer;
+    std::vector<NX_MeshData> meshData;
+    std::vector<NX_BoundingBox3D> meshAABBs;
+    std::vector<int> meshMaterials;
+    std::vector<NX_Material> materials;
+    std::vector<MaterialKeys> materialKeys;
+    std::vector<std::pair<uint64_t, import::TextureLoader::Image>> images;
+
+    /** Upload progress, textures hold one reference until the materials are assigned */
+    std::unordered_map<uint64_t, NX_Texture*> textures;
+    std::unique_ptr<INX_TextureUpload> textureUpload;
+    util::DynamicArray<NX_Image> uploadLevels;
+    NX_Model* model{};
+    int step{};
+
+    ~INX_AsyncModel();
+
+    bool Decode();
+    NX_AsyncStatus Upload(size_t* bytes, void** result);
+};
+
+INX_AsyncModel::~INX_AsyncModel()
+{
+    // NOTE: Must be released before the images, its staging copy may still read them
+    textureUpload.reset();
+
+    for (auto& [key, texture] : textures) {
+        NX_DestroyTexture(texture);
+    }
+
+    for (auto& [key, image] : images) {
+        if (image.owned) NX_DestroyImage(&image.image);
+        for (NX_Image& level : image.mipmaps) NX_DestroyImage(&level);
+    }
+
+    for (NX_MeshData& data : meshData) {
+        NX_DestroyMeshData(&data);
+    }
+
+    NX_DestroyModel(model);
+    NX_Free(fileData);
+}
+
+bool INX_AsyncModel::Decode()
+{
+    /* --- Read the file --- */
+
+    fileData = NX_LoadFile(filePath.c_str(), &fileSize);
+    if (fileData == nullptr || fileSize == 0) {
+        NX_LOG(E, "RENDER: Failed to load model data: %s", filePath.c_str());
+        return false;
+    }
+
+    // NOTE: Model caches are GPU-ready, everything is done during the upload
+    isCache = import::ModelCacheReader::IsCache(fileData, fileSize);
+    if (isCache) {
+        return true;
+    }
+
+    /* --- Import the scene --- */
+
+    importer = std::make_unique<import::SceneImporter>(fileData, fileSize, INX_GetFileExt(filePath.c_str()));
+    if (!importer->IsValid()) {
+        return false;
+    }
+
+    /* --- Process the meshes --- */
+
+    const int meshCount = importer->GetMeshCount();
+
+    meshData.resize(meshCount);
+    meshAABBs.resize(meshCount);
+    meshMaterials.resize(meshCount);
+
+    if (!import::MeshImporter(*importer).LoadMeshData(meshData.data(), meshAABBs.data(), meshMaterials.data())) {
+        return false;
+    }
+
+    /* --- Load the material parameters --- */
+
+    const int materialCount = importer->GetMaterialCount();
+
+    materials.resize(materialCount);
+    materialKeys.resize(materialCount);
+
+    import::MaterialImporter materialImporter(*importer);
+    for (int i = 0; i < materialCount; i++) {
+        materialImporter.LoadParameters(&materials[i], i);
+        materialKeys[i].fill(0);
+    }
+
+    /* --- Decode the images, each one is kept once with the ownership of its pixels --- */
+
+    // NOTE: The texture cache can only be queried from the main thread,
+    //       images already in the cache are decoded anyway and dropped during upload
+    import::TextureLoader(*importer, true).LoadImages(
+        [this](int i, import::TextureLoader::Map j, uint64_t key) {
+            materialKeys[i][j] = key;
+            return true;
+        },
+        [this](int i, import::TextureLoader::Map j, uint64_t key, import::TextureLoader::Image& img) {
+            if (img.image.pixels == nullptr) return;
+            for (const auto& entry : images) {
+                if (entry.first == key) return;
+            }
+            // NOTE: Moving the image also takes its mipmaps
+            images.emplace_back(key, std::move(img));
+            img.owned = false;
+        }
+    );
+
+    return true;
+}
+
+NX_AsyncStatus INX_AsyncModel::Upload(size_t* bytes, void** result)
+{
+    /* --- Model caches are uploaded in a single step --- */
+
+    if (isCache) {
+        *bytes = fileSize;
+        *result = import::ModelCacheReader(fileData, fileSize).LoadModel();
+        return (*result != nullptr) ? NX_ASYNC_READY : NX_ASYNC_FAILED;
+    }
+
+    const int meshCount = static_cast<int>(meshData.size());
+    const int imageCount = static_cast<int>(images.size());
+    const int index = step++;
+
+    /* --- First step, create the model with its CPU-side arrays --- */
+
+    if (index == 0) {
+        model = INX_Pool.Create<NX_Model>();
+        if (model == nullptr) {
+            NX_LOG(E, "RENDER: Failed to load model; Object pool issue");
+            return NX_ASYNC_FAILED;
+        }
+
+        const int materialCount = static_cast<int>(materials.size());
+
+        NX_Mesh** meshes = NX_Calloc<NX_Mesh*>(meshCount);
+        int* indices = NX_Malloc<int>(meshCount);
+        NX_Material* mats = NX_Malloc<NX_Material>(materialCount);
+
+        if (!meshes || !indices || !mats) {
+            NX_LOG(E, "RENDER: Unable to allocate memory for model arrays; The model will be invalid");
+            NX_Free(meshes);
+            NX_Free(indices);
+            NX_Free(mats);
+            return NX_ASYNC_FAILED;
+        }
+
+        SDL_memcpy(indices, meshMaterials.data(), meshCount * sizeof(int));
+        SDL_memcpy(mats, materials.data(), materialCount * sizeof(NX_Material));
+
+        model->meshes = meshes;
+        model->meshMaterials = indices;
+        model->materials = mats;
+        model->meshCount = meshCount;
+        model->materialCount = materialCount;
+
+        return NX_ASYNC_PENDING;
+    }
+
+    /* --- One step per mesh --- */
+
+    if (index <= meshCount) {
+        const int i = index - 1;
+        model->meshes[i] = NX_CreateMesh(NX_PRIMITIVE_TRIANGLES, &meshData[i], &meshAABBs[i]);
+        if (model->meshes[i] == nullptr) {
+            NX_LOG(E, "RENDER: Unable to load mesh [%d]; The model will be invalid", i);
+            return NX_ASYNC_FAILED;
+        }
+        *bytes = meshData[i].vertexCount * sizeof(NX_Vertex3D) + meshData[i].indexCount * sizeof(uint32_t);
+        NX_DestroyMeshData(&meshData[i]);
+        return NX_ASYNC_PENDING;
+    }
+
+    /* --- Staged upload per image, shared through the texture cache --- */
+
+    if (index <= meshCount + imageCount) {
+        auto& [key, img] = images[index - meshCount - 1];
+
+        NX_Texture* texture = nullptr;
+        if (textureUpload == nullptr) {
+            texture = INX_TextureCache_Acquire(key);
+            if (texture == nullptr) {
+                uploadLevels = import::TextureLoader::GetLevels(img);
+                textureUpload = std::make_unique<INX_TextureUpload>(
+                    uploadLevels.GetData(), static_cast<int>(uploadLevels.GetSize()),
+                    import::TextureLoader::GetWrapMode(img.wrap[0]),
+                    NX_GetDefaultTextureFilter()
+                );
+            }
+        }
+
+        // NOTE: Staged uploads take several steps, the image stays current until done
+        if (textureUpload != nullptr) {
+            if (textureUpload->Step(bytes) == NX_ASYNC_PENDING) {
+                step--;
+                return NX_ASYNC_PENDING;
+            }
+            texture = textureUpload->Take();
+            textureUpload.reset();
+            uploadLevels.Clear();
+            if (texture != nullptr) {
+                INX_TextureCache_Insert(key, texture);
+            }
+        }
+
+        if (texture != nullptr) {
+            textures.emplace(key, texture);
+        }
+
+        if (img.owned) {
+            NX_DestroyImage(&img.image);
+            img.owned = false;
+        }
+        img.image.pixels = nullptr;
+
+        for (NX_Image& level : img.mipmaps) {
+            NX_DestroyImage(&level);
+        }
+        img.mipmaps.Clear();
+
+        return NX_ASYNC_PENDING;
+    }
+
+    /* --- Last step, assign the textures and finalize the model --- */
+
+    auto getTexture = [this](uint64_t key) -> NX_Texture* {
+        auto it = textures.find(key);
+        return (it != textures.end()) ? NX_RetainTexture(it->second) : nullptr;
+    };
+
+    for (int i = 0; i < model->materialCount; i++) {
+        NX_Material& material = model->materials[i];
+        const MaterialKeys& keys = materialKeys[i];
+        material.albedo.texture = getTexture(keys[import::TextureLoader::MAP_ALBEDO]);
+        material.emission.texture = getTexture(keys[import::TextureLoader::MAP_EMISSION]);
+        material.orm.texture = getTexture(keys[import::TextureLoader::MAP_ORM]);
+        material.normal.texture = getTexture(keys[import::TextureLoader::MAP_NORMAL]);
+        if (material.emission.texture != nullptr) {
+            material.emission.energy = 1.0f;
+        }
+    }
+
+    for (auto& [key, texture] : textures) {
+        NX_DestroyTexture(texture);
+    }
+    textures.clear();
+
+    NX_UpdateModelAABB(model);
+    model->skeleton = import::SkeletonImporter(*importer).ProcessSkeleton();
+
+    *result = model;
+    model = nullptr;
+
+    return NX_ASYNC_READY;
+}
+
 // ============================================================================
 // PUBLIC API
 // ============================================================================
@@ -43,6 +332,10 @@ NX_Model* NX_LoadModel(const char* filePath)
 
 NX_Model* NX_LoadModelFromData(const void* data, size_t size, const char* hint)
 {
+    if (import::ModelCacheReader::IsCache(data, size)) {
+        return import::ModelCacheReader(data, size).LoadModel();
+    }
+
     import::SceneImporter importer(data, size, hint);
     if (!importer.IsValid()) {
         return nullptr;
@@ -69,6 +362,56 @@ NX_Model* NX_LoadModelFromData(const void* data, size_t size, const char* hint)
     return model;
 }
 
+NX_AsyncLoad* NX_LoadModelAsync(const char* filePath)
+{
+    auto state = std::make_shared<INX_AsyncModel>();
+    state->filePath = filePath;
+
+    return INX_AsyncLoad_Submit(
+        [state]() { return state->Decode(); },
+        [state](size_t* bytes, void** result) { return state->Upload(bytes, result); },
+        [](void* result) { NX_DestroyModel(static_cast<NX_Model*>(result)); }
+    );
+}
+
+NX_Model* NX_GetAsyncModel(NX_AsyncLoad* load)
+{
+    return static_cast<NX_Model*>(INX_AsyncLoad_Take(load));
+}
+
+bool NX_SaveModelCache(const char* filePath, const char* cachePath)
+{
+    return NX_SaveModelCacheEx(filePath, cachePath, false);
+}
+
+bool NX_SaveModelCacheEx(const char* filePath, const char* cachePath, bool compressTextures)
+{
+    size_t fileSize = 0;
+    void* fileData = NX_LoadFile(filePath, &fileSize);
+    if (fileData == nullptr || fileSize == 0) {
+        NX_LOG(E, "RENDER: Failed to load model data: %s", filePath);
+        return false;
+    }
+
+    if (import::ModelCacheReader::IsCache(fileData, fileSize)) {
+        NX_LOG(E, "RENDER: Failed to save model cache; '%s' is already a model cache", filePath);
+        NX_Free(fileData);
+        return false;
+    }
+
+    bool success = false;
+    {
+        import::SceneImporter importer(fileData, fileSize, INX_GetFileExt(filePath));
+        if (importer.IsValid()) {
+            success = import::ModelCacheWriter(importer, compressTextures).Save(cachePath);
+        }
+    }
+
+    NX_Free(fileData);
+
+    return success;
+}
+
 void NX_DestroyModel(NX_Model* model)
 {
     if (model == nullptr) return;
@@ -0,0 +1,280 @@
+/* NX_Path2D.cpp -- API definition for Nexium's 2D path module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./NX_Path2D.hpp"
+
+#include <NX/NX_Log.h>
+
+#include "./INX_GlobalPool.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+static void INX_Path2D_AddPoint(NX_Path2D* path, NX_Vec2 point)
+{
+    if (path->points.IsEmpty()) {
+        path->boundsMin = path->boundsMax = point;
+    }
+    else {
+        path->boundsMin = NX_Vec2Min(path->boundsMin, point);
+        path->boundsMax = NX_Vec2Max(path->boundsMax, point);
+    }
+
+    (void)path->points.PushBack(point);
+    path->subPaths.GetBack()->count++;
+}
+
+static void INX_Path2D_BeginSubPath(NX_Path2D* path, NX_Vec2 point)
+{
+    // NOTE: A sub-path reduced to its start point is replaced rather than kept,
+    //       the bounds may still include the dropped point which is harmless for culling
+    INX_SubPath2D* current = path->subPaths.GetBack();
+    if (current != nullptr && current->count == 1 && !current->closed) {
+        path->points.PopBack();
+        current->count = 0;
+    }
+    else {
+        (void)path->subPaths.PushBack(INX_SubPath2D {
+            .first = static_cast<int>(path->points.GetSize()),
+            .count = 0,
+            .closed = false
+        });
+    }
+
+    INX_Path2D_AddPoint(path, point);
+}
+
+static NX_Vec2 INX_Path2D_GetLastPoint(NX_Path2D* path)
+{
+    // NOTE: Drawing after a close continues from the start of the closed sub-path
+    INX_SubPath2D* current = path->subPaths.GetBack();
+    if (current->closed) {
+        NX_Vec2 start = path->points[current->first];
+        INX_Path2D_BeginSubPath(path, start);
+        return start;
+    }
+    return *path->points.GetBack();
+}
+
+static bool INX_Path2D_EnsureStarted(NX_Path2D* path, NX_Vec2 point)
+{
+    if (path->subPaths.IsEmpty()) {
+        INX_Path2D_BeginSubPath(path, point);
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+NX_Path2D* NX_CreatePath2D(void)
+{
+    NX_Path2D* path = INX_Pool.Create<NX_Path2D>();
+    if (path == nullptr) {
+        NX_LOG(E, "RENDER: Failed to create 2D path; Object pool issue");
+        return nullptr;
+    }
+
+    return path;
+}
+
+void NX_DestroyPath2D(NX_Path2D* path)
+{
+    INX_Pool.Destroy(path);
+}
+
+void NX_ClearPath2D(NX_Path2D* path)
+{
+    path->points.Clear();
+    path->subPaths.Clear();
+    path->boundsMin = path->boundsMax = NX_VEC2_ZERO;
+}
+
+void NX_PathMoveTo2D(NX_Path2D* path, NX_Vec2 point)
+{
+    INX_Path2D_BeginSubPath(path, point);
+}
+
+void NX_PathLineTo2D(NX_Path2D* path, NX_Vec2 point)
+{
+    if (INX_Path2D_EnsureStarted(path, point)) {
+        (void)INX_Path2D_GetLastPoint(path);
+        INX_Path2D_AddPoint(path, point);
+    }
+}
+
+void NX_PathBezierQuadTo2D(NX_Path2D* path, NX_Vec2 control, NX_Vec2 point, int segments)
+{
+    if (path->subPaths.IsEmpty()) {
+        NX_LOG(W, "RENDER: Quadratic bezier added to an empty path; Starting the path at its end point instead");
+        INX_Path2D_BeginSubPath(path, point);
+        return;
+    }
+
+    if (segments < 1) segments = 20;
+
+    NX_Vec2 p0 = INX_Path2D_GetLastPoint(path);
+    (void)path->points.Reserve(path->points.GetSize() + segments);
+
+    /* --- Forward differencing, evaluated once when the curve is added --- */
+
+    float dt = 1.0f / segments;
+    float dt2 = dt * dt;
+
+    NX_Vec2 p = p0;
+    NX_Vec2 d1 = (control - p0) * (2.0f * dt);
+    NX_Vec2 d2 = (p0 - control * 2.0f + point) * (2.0f * dt2);
+    NX_Vec2 hd2 = d2 * 0.5f;
+
+    for (int i = 1; i < segments; i++) {
+        p = p + d1 + hd2;
+        d1 = d1 + d2;
+        INX_Path2D_AddPoint(path, p);
+    }
+
+    // NOTE: The end point is added as given to avoid accumulated drift
+    INX_Path2D_AddPoint(path, point);
+}
+
+void NX_PathBezierCubicTo2D(NX_Path2D* path, NX_Vec2 control0, NX_Vec2 control1, NX_Vec2 point, int segments)
+{
+    if (path->subPaths.IsEmpty()) {
+        NX_LOG(W, "RENDER: Cubic bezier added to an empty path; Starting the path at its end point instead");
+        INX_Path2D_BeginSubPath(path, point);
+        return;
+    }
+
+    if (segments < 1) segments = 30;
+
+    NX_Vec2 p0 = INX_Path2D_GetLastPoint(path);
+    (void)path->points.Reserve(path->points.GetSize() + segments);
+
+    /* --- Forward differencing, evaluated once when the curve is added --- */
+
+    float dt = 1.0f / segments;
+    float dt2 = dt * dt;
+    float dt3 = dt2 * dt;
+
+    NX_Vec2 a = (control0 - control1) * 3.0f + point - p0;
+    NX_Vec2 b = (p0 - control0 * 2.0f + control1) * 3.0f;
+    NX_Vec2 c = (control0 - p0) * 3.0f;
+
+    NX_Vec2 p = p0;
+    NX_Vec2 d1 = c * dt + b * dt2 + a * dt3;
+    NX_Vec2 d2 = b * (2.0f * dt2) + a * (6.0f * dt3);
+    NX_Vec2 d3 = a * (6.0f * dt3);
+
+    for (int i = 1; i < segments; i++) {
+        p = p + d1;
+        d1 = d1 + d2;
+        d2 = d2 + d3;
+        INX_Path2D_AddPoint(path, p);
+    }
+
+    // NOTE: The end point is added as given to avoid accumulated drift
+    INX_Path2D_AddPoint(path, point);
+}
+
+void NX_PathArc2D(NX_Path2D* path, NX_Vec2 center, float radius, float startAngle, float endAngle, int segments)
+{
+    if (segments < 1) segments = 16;
+
+    // NOTE: The sweep is clamped rather than wrapped, a full turn must stay a full circle
+    float angleDiff = NX_CLAMP(endAngle - startAngle, -NX_TAU, NX_TAU);
+
+    NX_Vec2 start = center + NX_VEC2(std::cos(startAngle), std::sin(startAngle)) * radius;
+    NX_PathLineTo2D(path, start);
+
+    (void)path->points.Reserve(path->points.GetSize() + segments);
+
+    /* --- Rotate the radius vector by a constant step --- */
+
+    float step = angleDiff / segments;
+    float cosStep = std::cos(step);
+    float sinStep = std::sin(step);
+
+    NX_Vec2 r = start - center;
+    for (int i = 1; i <= segments; i++) {
+        r = NX_VEC2(r.x * cosStep - r.y * sinStep, r.x * sinStep + r.y * cosStep);
+        INX_Path2D_AddPoint(path, center + r);
+    }
+}
+
+void NX_PathRectRounded2D(NX_Path2D* path, float x, float y, float w, float h, float radius, int segments)
+{
+    radius = std::max(std::min(radius, std::min(w * 0.5f, h * 0.5f)), 0.0f);
+
+    if (radius <= 0.0f) {
+        NX_PathMoveTo2D(path, NX_VEC2(x, y));
+        NX_PathLineTo2D(path, NX_VEC2(x + w, y));
+        NX_PathLineTo2D(path, NX_VEC2(x + w, y + h));
+        NX_PathLineTo2D(path, NX_VEC2(x, y + h));
+        NX_ClosePath2D(path);
+        return;
+    }
+
+    if (segments < 1) segments = 1;
+
+    /* --- Corners from the top-left one, clockwise on screen --- */
+
+    NX_Vec2 centers[4] = {
+        NX_VEC2(x + radius, y + radius),
+        NX_VEC2(x + w - radius, y + radius),
+        NX_VEC2(x + w - radius, y + h - radius),
+        NX_VEC2(x + radius, y + h - radius)
+    };
+
+    INX_Path2D_BeginSubPath(path, centers[0] + NX_VEC2(-radius, 0.0f));
+    (void)path->points.Reserve(path->points.GetSize() + 4 * (segments + 1));
+
+    // NOTE: The quarter is computed once and rotated by 90 degree steps for each corner
+    float step = 0.5f * NX_PI / segments;
+    float cosStep = std::cos(step);
+    float sinStep = std::sin(step);
+
+    for (int corner = 0; corner < 4; corner++) {
+        NX_Vec2 r = NX_VEC2(-radius, 0.0f);
+        for (int turn = 0; turn < corner; turn++) {
+            r = NX_VEC2(-r.y, r.x);
+        }
+        if (corner > 0) {
+            INX_Path2D_AddPoint(path, centers[corner] + r);
+        }
+        for (int i = 1; i <= segments; i++) {
+            r = NX_VEC2(r.x * cosStep - r.y * sinStep, r.x * sinStep + r.y * cosStep);
+            INX_Path2D_AddPoint(path, centers[corner] + r);
+        }
+    }
+
+    NX_ClosePath2D(path);
+}
+
+void NX_ClosePath2D(NX_Path2D* path)
+{
+    INX_SubPath2D* current = path->subPaths.GetBack();
+    if (current != nullptr) {
+        current->closed = true;
+    }
+}
+
+int NX_GetPath2DPointCount(const NX_Path2D* path)
+{
+    return static_cast<int>(path->points.GetSize());
+}
+
+void NX_GetPath2DBounds(const NX_Path2D* path, NX_Vec2* min, NX_Vec2* max)
+{
+    if (min != nullptr) *min = path->boundsMin;
+    if (max != nullptr) *max = path->boundsMax;
+}
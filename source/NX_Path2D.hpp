@@ -0,0 +1,33 @@
+/* NX_Path2D.hpp -- API definition for Nexium's 2D path module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_PATH_2D_HPP
+#define NX_PATH_2D_HPP
+
+#include <NX/NX_Path2D.h>
+
+#include "./Detail/Util/DynamicArray.hpp"
+
+// ============================================================================
+// OPAQUE DEFINITION
+// ============================================================================
+
+struct INX_SubPath2D {
+    int first;                      //< Index of the first point in the path
+    int count;                      //< Number of points, the closing point is not repeated
+    bool closed;
+};
+
+struct NX_Path2D {
+    util::DynamicArray<NX_Vec2> points{};
+    util::DynamicArray<INX_SubPath2D> subPaths{};
+    NX_Vec2 boundsMin{};
+    NX_Vec2 boundsMax{};
+};
+
+#endif // NX_PATH_2D_HPP
@@ -17,14 +17,18 @@
 #include "./INX_GPUProgramCache.hpp"
 #include "./INX_GlobalAssets.hpp"
 #include "./INX_GlobalPool.hpp"
+#include "./NX_TextLayout.hpp"
 #include "./NX_Shader2D.hpp"
+#include "./NX_Path2D.hpp"
 #include "./NX_Texture.hpp"
 
+#include "./Detail/Util/DynamicArray.hpp"
 #include "./Detail/Util/StaticArray.hpp"
 #include "./Detail/Util/Memory.hpp"
 #include "./Detail/Util/Ranges.hpp"
 
 #include "./Detail/GPU/VertexArray.hpp"
+#include "./Detail/GPU/RingBuffer.hpp"
 #include "./Detail/GPU/Pipeline.hpp"
 #include "./Detail/GPU/Buffer.hpp"
 #include "NX/NX_Math.h"
@@ -32,6 +36,9 @@
 #include <shaders/screen.vert.h>
 #include <shaders/overlay.frag.h>
 
+#include <algorithm>
+#include <cfloat>
+
 // ============================================================================
 // INTERNAL TYPES
 // ============================================================================
@@ -40,15 +47,30 @@ enum class INX_DrawMode2D {
     SHAPE, TEXT
 };
 
+struct INX_Quad2D {
+    NX_Vec2 origin;             //< Transformed top-left corner
+    NX_Vec2 axisX, axisY;       //< Transformed width and height edges
+    uint16_t texRect[4];        //< Normalized min and max texture coordinates
+    NX_Color color;             //< Same float color as the vertices, never clamped
+};
+
+static_assert(sizeof(INX_Quad2D) == 48);
+
 struct INX_DrawCall2D {
     /** Constructors */
     INX_DrawCall2D() = default;
-    INX_DrawCall2D(NX_Shader2D* s, const NX_Texture* t, size_t o);
-    INX_DrawCall2D(NX_Shader2D* s, const NX_Font* f, size_t o);
+    INX_DrawCall2D(NX_Shader2D* s, const NX_Texture* t, size_t o, int l, bool i);
+    INX_DrawCall2D(NX_Shader2D* s, const NX_Font* f, int p, size_t o, int l, bool i);
+
+    /** Returns the texture or the font depending on the mode */
+    const void* GetDrawable() const;
+
+    /** Returns true if both calls can be submitted as a single draw */
+    bool HasSameState(const INX_DrawCall2D& other) const;
 
     /** Shader related data */
-    NX_Shader2D::TextureArray shaderTextures;
-    int shaderDynamicRangeIndex;
+    NX_Shader2D::TextureArray shaderTextures{};
+    int shaderDynamicRangeIndex{-1};
     NX_Shader2D* shader;
 
     /** Drawable */
@@ -56,14 +78,27 @@ struct INX_DrawCall2D {
         const NX_Texture* texture;
         const NX_Font* font;
     };
+    int page;                   //< Glyph atlas page of the font, always zero for shapes
 
     /** Draw call info */
-    size_t offset, count;       //< Offset and count in the index buffer (in number of indices)
+    size_t offset, count;       //< Offset and count in the index buffer, or in the quads when instanced
     INX_DrawMode2D mode;
+    int layer;                  //< Sort key of the sorted batch mode, always zero otherwise
+    bool instanced;             //< Draws one instance per quad rather than indexed triangles
+    size_t group{0};            //< State group assigned by the sorted batch mode
 };
 
-inline INX_DrawCall2D::INX_DrawCall2D(NX_Shader2D* s, const NX_Texture* t, size_t o)
-    : shader(s), texture(t), offset(o), count(0), mode(INX_DrawMode2D::SHAPE)
+inline INX_DrawCall2D::INX_DrawCall2D(NX_Shader2D* s, const NX_Texture* t, size_t o, int l, bool i)
+    : shader(s), texture(t), page(0), offset(o), count(0), mode(INX_DrawMode2D::SHAPE), layer(l), instanced(i)
+{
+    if (s != nullptr) {
+        shaderTextures = s->GetTextures();
+        shaderDynamicRangeIndex = s->GetDynamicRangeIndex();
+    }
+}
+
+inline INX_DrawCall2D::INX_DrawCall2D(NX_Shader2D* s, const NX_Font* f, int p, size_t o, int l, bool i)
+    : shader(s), font(f), page(p), offset(o), count(0), mode(INX_DrawMode2D::TEXT), layer(l), instanced(i)
 {
     if (s != nullptr) {
         shaderTextures = s->GetTextures();
@@ -71,14 +106,45 @@ inline INX_DrawCall2D::INX_DrawCall2D(NX_Shader2D* s, const NX_Texture* t, size_
     }
 }
 
-inline INX_DrawCall2D::INX_DrawCall2D(NX_Shader2D* s, const NX_Font* f, size_t o)
-    : shader(s), font(f), offset(o), count(0), mode(INX_DrawMode2D::TEXT)
-{ }
+inline const void* INX_DrawCall2D::GetDrawable() const
+{
+    switch (mode) {
+    case INX_DrawMode2D::SHAPE:
+        return texture;
+    case INX_DrawMode2D::TEXT:
+        return font;
+    }
+    return nullptr;
+}
+
+inline bool INX_DrawCall2D::HasSameState(const INX_DrawCall2D& other) const
+{
+    return shader == other.shader
+        && mode == other.mode
+        && instanced == other.instanced
+        && GetDrawable() == other.GetDrawable()
+        && page == other.page
+        && shaderDynamicRangeIndex == other.shaderDynamicRangeIndex
+        && shaderTextures == other.shaderTextures;
+}
+
+struct INX_SortGroup2D {
+    NX_Vec2 min, max;           //< Screen bounds of every call of the group
+    size_t call;                //< First call of the group, holds its state
+};
 
 struct INX_VertexBuffer2D {
     gpu::VertexArray vao{};
-    gpu::Buffer vbo{};
-    gpu::Buffer ebo{};
+    gpu::RingBuffer vbo{};
+    gpu::RingBuffer ebo{};
+    GLuint vboID{0};            //< Buffer names the vertex array was built with,
+    GLuint eboID{0};            //< they change when the rings grow
+};
+
+struct INX_QuadBuffer2D {
+    gpu::VertexArray vao{};
+    gpu::RingBuffer ibo{};      //< Instance ring, one INX_Quad2D per quad
+    GLuint iboID{0};
 };
 
 struct INX_FrameUniform2D {
@@ -86,24 +152,139 @@ struct INX_FrameUniform2D {
     alignas(4) float time;
 };
 
+// ============================================================================
+// TESSELLATION TABLES
+// ============================================================================
+
+/**
+ * Unit circle points and spline weights shared by every shape drawn with the
+ * same segment count, so that tessellating a shape costs no trigonometry.
+ * Tables are built on first use and kept, counts above MaxCachedSegments are
+ * rare and rebuilt in a scratch table each time.
+ */
+class INX_ShapeTables2D {
+public:
+    static constexpr int MaxCachedSegments = 256;
+
+public:
+    /** Full unit circle from angle zero, 'segments + 1' points, the last one closes the loop */
+    const NX_Vec2* GetCircle(int segments);
+
+    /** First quadrant of the unit circle from angle zero to pi/2, 'segments + 1' points */
+    const NX_Vec2* GetQuarter(int segments);
+
+    /** Catmull-Rom weights of the 'segments' points following the start of a span */
+    const NX_Vec4* GetCatmullRom(int segments);
+
+private:
+    /** Cached table of a segment count, or the scratch table above the limit */
+    template <typename T>
+    static util::DynamicArray<T>& Select(util::DynamicArray<T>* tables, util::DynamicArray<T>& scratch, int segments);
+
+private:
+    util::DynamicArray<NX_Vec2> mCircles[MaxCachedSegments + 1]{};
+    util::DynamicArray<NX_Vec2> mQuarters[MaxCachedSegments + 1]{};
+    util::DynamicArray<NX_Vec4> mCatmullRoms[MaxCachedSegments + 1]{};
+    util::DynamicArray<NX_Vec2> mCircleScratch{};
+    util::DynamicArray<NX_Vec2> mQuarterScratch{};
+    util::DynamicArray<NX_Vec4> mCatmullRomScratch{};
+};
+
+template <typename T>
+inline util::DynamicArray<T>& INX_ShapeTables2D::Select(util::DynamicArray<T>* tables, util::DynamicArray<T>& scratch, int segments)
+{
+    SDL_assert(segments > 0);
+    return (segments <= MaxCachedSegments) ? tables[segments] : scratch;
+}
+
+// NOTE: The size of a table identifies its segment count,
+//       which tells whether the scratch table can be reused as is
+
+inline const NX_Vec2* INX_ShapeTables2D::GetCircle(int segments)
+{
+    util::DynamicArray<NX_Vec2>& table = Select(mCircles, mCircleScratch, segments);
+    if (table.GetSize() == static_cast<size_t>(segments) + 1) {
+        return table.GetData();
+    }
+
+    (void)table.Resize(segments + 1);
+    for (int i = 0; i < segments; i++) {
+        float angle = NX_TAU * i / segments;
+        table[i] = NX_VEC2(std::cos(angle), std::sin(angle));
+    }
+    table[segments] = table[0];
+
+    return table.GetData();
+}
+
+inline const NX_Vec2* INX_ShapeTables2D::GetQuarter(int segments)
+{
+    util::DynamicArray<NX_Vec2>& table = Select(mQuarters, mQuarterScratch, segments);
+    if (table.GetSize() == static_cast<size_t>(segments) + 1) {
+        return table.GetData();
+    }
+
+    (void)table.Resize(segments + 1);
+    for (int i = 1; i < segments; i++) {
+        float angle = 0.5f * NX_PI * i / segments;
+        table[i] = NX_VEC2(std::cos(angle), std::sin(angle));
+    }
+    table[0] = NX_VEC2(1.0f, 0.0f);
+    table[segments] = NX_VEC2(0.0f, 1.0f);
+
+    return table.GetData();
+}
+
+inline const NX_Vec4* INX_ShapeTables2D::GetCatmullRom(int segments)
+{
+    util::DynamicArray<NX_Vec4>& table = Select(mCatmullRoms, mCatmullRomScratch, segments);
+    if (table.GetSize() == static_cast<size_t>(segments)) {
+        return table.GetData();
+    }
+
+    (void)table.Resize(segments);
+    for (int j = 1; j <= segments; j++) {
+        float t = static_cast<float>(j) / segments;
+        float t2 = t * t;
+        float t3 = t2 * t;
+        table[j - 1] = NX_VEC4(
+            -0.5f * t3 + t2 - 0.5f * t,
+             1.5f * t3 - 2.5f * t2 + 1.0f,
+            -1.5f * t3 + 2.0f * t2 + 0.5f * t,
+             0.5f * t3 - 0.5f * t2
+        );
+    }
+
+    return table.GetData();
+}
+
 // ============================================================================
 // LOCAL STATE
 // ============================================================================
 
 struct INX_Render2DState {
     /** Constants */
-    static constexpr int MaxDrawCalls = 128;
-    static constexpr int MaxVertices = 4096;
-    static constexpr int MaxIndices = 6144;
-
-    /** CPU Buffers */
-    util::StaticArray<INX_DrawCall2D, MaxDrawCalls> drawCalls{};
-    util::StaticArray<NX_Vertex2D, MaxVertices> vertices{};
-    util::StaticArray<uint16_t, MaxIndices> indices{};
+    static constexpr int InitialDrawCalls = 128;
+    static constexpr int InitialVertices = 16384;
+    static constexpr int InitialIndices = 24576;
+    static constexpr int InitialQuads = 4096;
+    static constexpr int MaxShortIndexVertices = 65536;  //< Above this, the batch is uploaded with 32-bit indices
+    static constexpr int MaxSortLookBack = 32;          //< Groups a call can move back past in sorted mode
+
+    /** CPU Buffers, grown on demand and kept across frames */
+    util::DynamicArray<INX_DrawCall2D> drawCalls{};
+    util::DynamicArray<NX_Vertex2D> vertices{};
+    util::DynamicArray<uint32_t> indices{};
+    util::DynamicArray<uint32_t> sortedIndices{};       //< Indices reordered by the sorted batch mode
+    util::DynamicArray<INX_Quad2D> quads{};
+    util::DynamicArray<INX_Quad2D> sortedQuads{};       //< Quads reordered by the sorted batch mode
+    util::DynamicArray<INX_SortGroup2D> sortGroups{};   //< Scratch groups of the sorted batch mode
     util::StaticArray<NX_Mat3, 16> matrixStack{};
+    INX_ShapeTables2D shapeTables{};
 
     /** GPU Buffers */
     INX_VertexBuffer2D vertexBuffer{};
+    INX_QuadBuffer2D quadBuffer{};
     gpu::Buffer uniformBuffer{};
 
     /** Framebuffer */
@@ -114,8 +295,15 @@ struct INX_Render2DState {
     NX_Color currentColor{NX_WHITE};
     NX_Shader2D* currentShader{nullptr};
     const NX_Font* currentFont{nullptr};
+    int currentFontPage{0};                             //< Page of the glyphs being pushed, set along with the font
     const NX_Texture* currentTexture{nullptr};
     const NX_RenderTexture* currentTarget{nullptr};
+    NX_Vec2 targetSize{};                               //< Screen bounds primitives are culled against
+    NX_BatchMode2D batchMode{NX_BATCH_2D_IMMEDIATE};
+    int currentLayer{0};
+
+    /** Statistics */
+    NX_Render2DStats stats{};
 };
 
 static util::UniquePtr<INX_Render2DState> INX_Render2D{};
@@ -124,40 +312,13 @@ static util::UniquePtr<INX_Render2DState> INX_Render2D{};
 // INTERNAL FUNCTIONS
 // ============================================================================
 
-bool INX_Render2DState_Init(NX_AppDesc* desc)
+static void INX_Render2D_CreateVertexArray()
 {
-    INX_Render2D = util::MakeUnique<INX_Render2DState>();
-    if (INX_Render2D == nullptr) {
-        return false;
-    }
-
-    /* --- Set default app descrition values --- */
-
-    if (desc->render2D.resolution < NX_IVEC2_ONE) {
-        desc->render2D.resolution = NX_GetDisplaySize();
-    }
-
-    if (desc->render2D.sampleCount < 1) {
-        desc->render2D.sampleCount = 1;
-    }
-
-    /* --- Push first transform matrix --- */
-
-    INX_Render2D->matrixStack.PushBack(NX_MAT3_IDENTITY);
-
-    /* --- Create the vertex buffer --- */
-
     INX_VertexBuffer2D& vertexBuffer = INX_Render2D->vertexBuffer;
 
-    size_t vboSize = INX_Render2DState::MaxVertices * sizeof(NX_Vertex2D);
-    size_t eboSize = INX_Render2DState::MaxIndices * sizeof(uint16_t);
-
-    vertexBuffer.vbo = gpu::Buffer(GL_ARRAY_BUFFER, vboSize, nullptr, GL_DYNAMIC_DRAW);
-    vertexBuffer.ebo = gpu::Buffer(GL_ELEMENT_ARRAY_BUFFER, eboSize, nullptr, GL_DYNAMIC_DRAW);
-
-    vertexBuffer.vao = gpu::VertexArray(&vertexBuffer.ebo, {
+    vertexBuffer.vao = gpu::VertexArray(&vertexBuffer.ebo.GetBuffer(), {
         gpu::VertexBufferDesc {
-            .buffer = &vertexBuffer.vbo,
+            .buffer = &vertexBuffer.vbo.GetBuffer(),
             .attributes = {
                 gpu::VertexAttribute {
                     .location = 0,
@@ -190,6 +351,121 @@ bool INX_Render2DState_Init(NX_AppDesc* desc)
         }
     });
 
+    vertexBuffer.vboID = vertexBuffer.vbo.GetBuffer().GetID();
+    vertexBuffer.eboID = vertexBuffer.ebo.GetBuffer().GetID();
+}
+
+static void INX_Render2D_CreateQuadArray()
+{
+    INX_QuadBuffer2D& quadBuffer = INX_Render2D->quadBuffer;
+
+    quadBuffer.vao = gpu::VertexArray({
+        gpu::VertexBufferDesc {
+            .buffer = &quadBuffer.ibo.GetBuffer(),
+            .attributes = {
+                gpu::VertexAttribute {
+                    .location = 0,
+                    .size = 2,
+                    .type = GL_FLOAT,
+                    .normalized = false,
+                    .stride = sizeof(INX_Quad2D),
+                    .offset = offsetof(INX_Quad2D, origin),
+                    .divisor = 1
+                },
+                gpu::VertexAttribute {
+                    .location = 1,
+                    .size = 4,
+                    .type = GL_FLOAT,
+                    .normalized = false,
+                    .stride = sizeof(INX_Quad2D),
+                    .offset = offsetof(INX_Quad2D, axisX),
+                    .divisor = 1
+                },
+                gpu::VertexAttribute {
+                    .location = 2,
+                    .size = 4,
+                    .type = GL_UNSIGNED_SHORT,
+                    .normalized = true,
+                    .stride = sizeof(INX_Quad2D),
+                    .offset = offsetof(INX_Quad2D, texRect),
+                    .divisor = 1
+                },
+                gpu::VertexAttribute {
+                    .location = 3,
+                    .size = 4,
+                    .type = GL_FLOAT,
+                    .normalized = false,
+                    .stride = sizeof(INX_Quad2D),
+                    .offset = offsetof(INX_Quad2D, color),
+                    .divisor = 1
+                }
+            }
+        }
+    });
+
+    quadBuffer.iboID = quadBuffer.ibo.GetBuffer().GetID();
+}
+
+bool INX_Render2DState_Init(NX_AppDesc* desc)
+{
+    INX_Render2D = util::MakeUnique<INX_Render2DState>();
+    if (INX_Render2D == nullptr) {
+        return false;
+    }
+
+    /* --- Set default app descrition values --- */
+
+    if (desc->render2D.resolution < NX_IVEC2_ONE) {
+        desc->render2D.resolution = NX_GetDisplaySize();
+    }
+
+    if (desc->render2D.sampleCount < 1) {
+        desc->render2D.sampleCount = 1;
+    }
+
+    /* --- Push first transform matrix --- */
+
+    INX_Render2D->matrixStack.PushBack(NX_MAT3_IDENTITY);
+
+    /* --- Reserve the CPU buffers --- */
+
+    if (!INX_Render2D->drawCalls.Reserve(INX_Render2DState::InitialDrawCalls) ||
+        !INX_Render2D->vertices.Reserve(INX_Render2DState::InitialVertices) ||
+        !INX_Render2D->indices.Reserve(INX_Render2DState::InitialIndices) ||
+        !INX_Render2D->quads.Reserve(INX_Render2DState::InitialQuads)) {
+        NX_LOG(E, "RENDER: Failed to allocate 2D batch buffers");
+        return false;
+    }
+
+    /* --- Create the vertex buffer --- */
+
+    INX_VertexBuffer2D& vertexBuffer = INX_Render2D->vertexBuffer;
+
+    // NOTE: A segment receives all the 2D geometry of a frame in a single upload.
+    //       The rings grow when a frame overflows them, the vertex array is then
+    //       rebuilt on the next flush. Offsets are aligned on whole vertices and
+    //       on 32-bit indices so they can be used as base vertex and first index.
+
+    static_assert((sizeof(NX_Vertex2D) & (sizeof(NX_Vertex2D) - 1)) == 0);
+
+    size_t vboSize = INX_Render2DState::InitialVertices * sizeof(NX_Vertex2D);
+    size_t eboSize = INX_Render2DState::InitialIndices * sizeof(uint32_t);
+
+    vertexBuffer.vbo = gpu::RingBuffer(GL_ARRAY_BUFFER, vboSize, sizeof(NX_Vertex2D), true);
+    vertexBuffer.ebo = gpu::RingBuffer(GL_ELEMENT_ARRAY_BUFFER, eboSize, sizeof(uint32_t), true);
+
+    INX_Render2D_CreateVertexArray();
+
+    /* --- Create the quad instance buffer --- */
+
+    // NOTE: Instances are drawn from an offset in the ring by shifting the
+    //       attributes, base instance being unavailable on OpenGL ES 3.2
+
+    size_t iboSize = INX_Render2DState::InitialQuads * sizeof(INX_Quad2D);
+    INX_Render2D->quadBuffer.ibo = gpu::RingBuffer(GL_ARRAY_BUFFER, iboSize, sizeof(uint32_t), true);
+
+    INX_Render2D_CreateQuadArray();
+
     /* --- Create the uniform buffer --- */
 
     INX_Render2D->uniformBuffer = gpu::Buffer(
@@ -237,52 +513,278 @@ void INX_Render2DState_Quit()
     INX_Render2D.reset();
 }
 
-static void INX_Render2D_Flush()
+static void INX_Render2D_GetCallBounds(const INX_DrawCall2D& call, NX_Vec2* min, NX_Vec2* max)
+{
+    *min = NX_VEC2(FLT_MAX, FLT_MAX);
+    *max = NX_VEC2(-FLT_MAX, -FLT_MAX);
+
+    if (call.instanced) {
+        const INX_Quad2D* quads = INX_Render2D->quads.GetData() + call.offset;
+        for (size_t i = 0; i < call.count; i++) {
+            const INX_Quad2D& quad = quads[i];
+            NX_Vec2 corners[4] = {
+                quad.origin, quad.origin + quad.axisX,
+                quad.origin + quad.axisY, quad.origin + quad.axisX + quad.axisY
+            };
+            for (const NX_Vec2& corner : corners) {
+                *min = NX_Vec2Min(*min, corner);
+                *max = NX_Vec2Max(*max, corner);
+            }
+        }
+    }
+    else {
+        const uint32_t* indices = INX_Render2D->indices.GetData() + call.offset;
+        const NX_Vertex2D* vertices = INX_Render2D->vertices.GetData();
+        for (size_t i = 0; i < call.count; i++) {
+            const NX_Vec2& position = vertices[indices[i]].position;
+            *min = NX_Vec2Min(*min, position);
+            *max = NX_Vec2Max(*max, position);
+        }
+    }
+}
+
+static void INX_Render2D_SortDrawCalls()
 {
-    if (INX_Render2D->drawCalls.IsEmpty() || INX_Render2D->vertices.IsEmpty()) {
+    util::DynamicArray<INX_DrawCall2D>& calls = INX_Render2D->drawCalls;
+    util::DynamicArray<uint32_t>& indices = INX_Render2D->indices;
+    util::DynamicArray<uint32_t>& sorted = INX_Render2D->sortedIndices;
+    util::DynamicArray<INX_Quad2D>& quads = INX_Render2D->quads;
+    util::DynamicArray<INX_Quad2D>& sortedQuads = INX_Render2D->sortedQuads;
+    util::DynamicArray<INX_SortGroup2D>& groups = INX_Render2D->sortGroups;
+
+    /* --- Order by layer, keeping submission order inside each layer --- */
+
+    std::stable_sort(calls.GetData(), calls.GetData() + calls.GetSize(),
+        [](const INX_DrawCall2D& a, const INX_DrawCall2D& b) {
+            return a.layer < b.layer;
+        }
+    );
+
+    // NOTE: The sorted calls can already be drawn as they are, grouping them
+    //       and rewriting the indices only serves to merge calls
+    groups.Clear();
+    if (!groups.Reserve(calls.GetSize())) {
         return;
     }
 
-    /* --- Upload to vertex buffer --- */
+    /* --- Group the calls of a layer by state, a call only moves back past the groups it does not overlap --- */
 
-    INX_Render2D->vertexBuffer.vbo.Upload(
-        0, INX_Render2D->vertices.GetSize() * sizeof(NX_Vertex2D),
-        INX_Render2D->vertices.GetData()
-    );
+    size_t layerFirstGroup = 0;
+
+    for (size_t i = 0; i < calls.GetSize(); i++)
+    {
+        INX_DrawCall2D& call = calls[i];
+
+        if (i > 0 && call.layer != calls[i - 1].layer) {
+            layerFirstGroup = groups.GetSize();
+        }
+
+        NX_Vec2 min, max;
+        INX_Render2D_GetCallBounds(call, &min, &max);
+
+        size_t target = groups.GetSize();
+        size_t lookBack = 0;
+
+        for (size_t g = groups.GetSize(); g > layerFirstGroup && lookBack < INX_Render2DState::MaxSortLookBack; g--, lookBack++) {
+            const INX_SortGroup2D& group = groups[g - 1];
+            if (calls[group.call].HasSameState(call)) {
+                target = g - 1;
+                break;
+            }
+            // NOTE: Touching bounds count as overlapping, edges may share pixels
+            if (min.x <= group.max.x && group.min.x <= max.x && min.y <= group.max.y && group.min.y <= max.y) {
+                break;
+            }
+        }
 
-    INX_Render2D->vertexBuffer.ebo.Upload(
-        0, INX_Render2D->indices.GetSize() * sizeof(uint16_t),
-        INX_Render2D->indices.GetData()
+        if (target == groups.GetSize()) {
+            (void)groups.PushBack(INX_SortGroup2D{min, max, i});
+        }
+        else {
+            groups[target].min = NX_Vec2Min(groups[target].min, min);
+            groups[target].max = NX_Vec2Max(groups[target].max, max);
+        }
+
+        call.group = target;
+    }
+
+    /* --- Order by group, groups already follow the layers --- */
+
+    std::stable_sort(calls.GetData(), calls.GetData() + calls.GetSize(),
+        [](const INX_DrawCall2D& a, const INX_DrawCall2D& b) {
+            return a.group < b.group;
+        }
     );
 
+    sorted.Clear();
+    sortedQuads.Clear();
+    if (!sorted.Reserve(indices.GetSize()) || !sortedQuads.Reserve(quads.GetSize())) {
+        return;
+    }
+
+    /* --- Rewrite the indices and quads in call order and merge calls sharing a state --- */
+
+    size_t callCount = 0;
+
+    for (size_t i = 0; i < calls.GetSize(); i++)
+    {
+        INX_DrawCall2D call = calls[i];
+        if (call.count == 0) {
+            continue;
+        }
+
+        size_t offset = 0;
+
+        if (call.instanced) {
+            const INX_Quad2D* src = quads.GetData() + call.offset;
+            offset = sortedQuads.GetSize();
+            sortedQuads.Insert(sortedQuads.End(), src, src + call.count);
+        }
+        else {
+            const uint32_t* src = indices.GetData() + call.offset;
+            offset = sorted.GetSize();
+            sorted.Insert(sorted.End(), src, src + call.count);
+        }
+
+        if (callCount > 0 && calls[callCount - 1].HasSameState(call)) {
+            calls[callCount - 1].count += call.count;
+            continue;
+        }
+
+        call.offset = offset;
+        calls[callCount++] = call;
+    }
+
+    calls.Resize(callCount);
+    indices.Swap(sorted);
+    quads.Swap(sortedQuads);
+}
+
+static void INX_Render2D_Flush()
+{
+    if (INX_Render2D->drawCalls.IsEmpty()) {
+        return;
+    }
+
+    if (INX_Render2D->vertices.IsEmpty() && INX_Render2D->quads.IsEmpty()) {
+        INX_Render2D->drawCalls.Clear();
+        return;
+    }
+
+    if (INX_Render2D->batchMode == NX_BATCH_2D_SORTED) {
+        INX_Render2D_SortDrawCalls();
+    }
+
+    /* --- Upload the glyphs rasterized by dynamic fonts --- */
+
+    INX_Pool.ForEach<NX_Font>([](NX_Font& font) {
+        INX_CommitFontCache(&font);
+    });
+
+    INX_VertexBuffer2D& vertexBuffer = INX_Render2D->vertexBuffer;
+    INX_QuadBuffer2D& quadBuffer = INX_Render2D->quadBuffer;
+
+    /* --- Stream the batch to the vertex rings --- */
+
+    // NOTE: Indices are always built as 32-bit, they are narrowed while
+    //       being written to the ring whenever the batch allows it
+    const bool shortIndices = (INX_Render2D->vertices.GetSize() <= INX_Render2DState::MaxShortIndexVertices);
+    const GLenum indexType = shortIndices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    const size_t indexSize = shortIndices ? sizeof(uint16_t) : sizeof(uint32_t);
+
+    gpu::RingBuffer::Range vertexRange{};
+    gpu::RingBuffer::Range indexRange{};
+    gpu::RingBuffer::Range quadRange{};
+
+    bool uploaded = true;
+
+    if (!INX_Render2D->vertices.IsEmpty())
+    {
+        vertexRange = vertexBuffer.vbo.Upload(
+            INX_Render2D->vertices.GetData(),
+            INX_Render2D->vertices.GetSize() * sizeof(NX_Vertex2D)
+        );
+
+        if (shortIndices) {
+            const size_t count = INX_Render2D->indices.GetSize();
+            if (uint16_t* dst = vertexBuffer.ebo.Map<uint16_t>(count, &indexRange)) {
+                const uint32_t* src = INX_Render2D->indices.GetData();
+                for (size_t i = 0; i < count; i++) {
+                    dst[i] = static_cast<uint16_t>(src[i]);
+                }
+                vertexBuffer.ebo.Unmap();
+            }
+        }
+        else {
+            indexRange = vertexBuffer.ebo.Upload(
+                INX_Render2D->indices.GetData(),
+                INX_Render2D->indices.GetSize() * sizeof(uint32_t)
+            );
+        }
+
+        uploaded = (vertexRange.size > 0 && indexRange.size > 0);
+    }
+
+    if (!INX_Render2D->quads.IsEmpty())
+    {
+        quadRange = quadBuffer.ibo.Upload(
+            INX_Render2D->quads.GetData(),
+            INX_Render2D->quads.GetSize() * sizeof(INX_Quad2D)
+        );
+
+        uploaded = uploaded && (quadRange.size > 0);
+    }
+
+    if (!uploaded) {
+        NX_LOG(E, "RENDER: Failed to upload 2D batch");
+        INX_Render2D->drawCalls.Clear();
+        INX_Render2D->vertices.Clear();
+        INX_Render2D->indices.Clear();
+        INX_Render2D->quads.Clear();
+        return;
+    }
+
+    const GLint baseVertex = static_cast<GLint>(vertexRange.offset / sizeof(NX_Vertex2D));
+    const GLint baseIndex = static_cast<GLint>(indexRange.offset / indexSize);
+
+    /* --- Rebuild the vertex arrays if a ring has grown --- */
+
+    if (vertexBuffer.vboID != vertexBuffer.vbo.GetBuffer().GetID() ||
+        vertexBuffer.eboID != vertexBuffer.ebo.GetBuffer().GetID()) {
+        INX_Render2D_CreateVertexArray();
+    }
+
+    if (quadBuffer.iboID != quadBuffer.ibo.GetBuffer().GetID()) {
+        INX_Render2D_CreateQuadArray();
+    }
+
     /* --- Setup pipeline --- */
 
     gpu::Pipeline pipeline;
 
     pipeline.SetBlendMode(gpu::BlendMode::Premultiplied);
-    pipeline.BindVertexArray(INX_Render2D->vertexBuffer.vao);
     pipeline.BindUniform(0, INX_Render2D->uniformBuffer);
     pipeline.BindFramebuffer(INX_Render2D->framebuffer);
     pipeline.SetViewport(INX_Render2D->framebuffer);
 
     /* --- Render all draw calls --- */
 
-    for (const INX_DrawCall2D& call : INX_Render2D->drawCalls)
+    for (size_t i = 0; i < INX_Render2D->drawCalls.GetSize(); i++)
     {
+        const INX_DrawCall2D& call = INX_Render2D->drawCalls[i];
         const NX_Shader2D* shader = INX_Assets.Select(call.shader, INX_Shader2DAsset::DEFAULT);
 
         shader->BindUniforms(pipeline, call.shaderDynamicRangeIndex);
         shader->BindTextures(pipeline, call.shaderTextures);
 
+        NX_Shader2D::Variant variant = NX_Shader2D::Variant::SHAPE_COLOR;
+
         switch (call.mode) {
         case INX_DrawMode2D::SHAPE:
             if (call.texture != nullptr) {
-                pipeline.UseProgram(shader->GetProgram(NX_Shader2D::Variant::SHAPE_TEXTURE));
+                variant = NX_Shader2D::Variant::SHAPE_TEXTURE;
                 pipeline.BindTexture(0, *reinterpret_cast<const gpu::Texture*>(call.texture));
             }
-            else {
-                pipeline.UseProgram(shader->GetProgram(NX_Shader2D::Variant::SHAPE_COLOR));
-            }
             break;
         case INX_DrawMode2D::TEXT:
             const NX_Font* font = INX_Assets.Select(call.font, INX_FontAsset::DEFAULT);
@@ -290,109 +792,140 @@ static void INX_Render2D_Flush()
             case NX_FONT_NORMAL:
             case NX_FONT_LIGHT:
             case NX_FONT_MONO:
-                pipeline.UseProgram(shader->GetProgram(NX_Shader2D::Variant::TEXT_BITMAP));
+                variant = NX_Shader2D::Variant::TEXT_BITMAP;
                 break;
             case NX_FONT_SDF:
-                pipeline.UseProgram(shader->GetProgram(NX_Shader2D::Variant::TEXT_SDF));
+                variant = NX_Shader2D::Variant::TEXT_SDF;
                 break;
             }
-            pipeline.BindTexture(0, font->texture->gpu);
+            pipeline.BindTexture(0, INX_GetFontTexture(font, call.page)->gpu);
             break;
         }
 
-        pipeline.DrawElements(
-            GL_TRIANGLES, GL_UNSIGNED_SHORT,
-            call.offset, call.count
-        );
+        if (call.instanced) {
+            // NOTE: The quad variants follow the regular ones in the same order
+            constexpr int quadVariantOffset = NX_Shader2D::Variant::SHAPE_COLOR_QUAD - NX_Shader2D::Variant::SHAPE_COLOR;
+            variant = static_cast<NX_Shader2D::Variant>(variant + quadVariantOffset);
+
+            pipeline.UseProgram(shader->GetProgram(variant));
+            pipeline.BindVertexArray(quadBuffer.vao);
+            quadBuffer.vao.SetVertexBufferOffset(0, quadRange.offset + call.offset * sizeof(INX_Quad2D));
+            pipeline.DrawInstanced(GL_TRIANGLE_STRIP, 4, call.count);
+        }
+        else {
+            pipeline.UseProgram(shader->GetProgram(variant));
+            pipeline.BindVertexArray(vertexBuffer.vao);
+            pipeline.DrawElementsBaseVertex(
+                GL_TRIANGLES, indexType,
+                baseIndex + call.offset, call.count,
+                baseVertex
+            );
+        }
     }
 
-    /* --- Reset --- */
+    /* --- Update stats and reset --- */
+
+    INX_Render2D->stats.flushes++;
+    INX_Render2D->stats.drawCalls += INX_Render2D->drawCalls.GetSize();
+    INX_Render2D->stats.vertices += INX_Render2D->vertices.GetSize();
+    INX_Render2D->stats.indices += INX_Render2D->indices.GetSize();
+    INX_Render2D->stats.quads += INX_Render2D->quads.GetSize();
 
     INX_Render2D->drawCalls.Clear();
     INX_Render2D->vertices.Clear();
     INX_Render2D->indices.Clear();
+    INX_Render2D->quads.Clear();
 }
 
-static void INX_Render2D_EnsureDrawCall(INX_DrawMode2D mode, int vertices, int indices)
+static bool INX_Render2D_IsCurrentState(const INX_DrawCall2D& call, INX_DrawMode2D mode, int layer)
 {
-    if (INX_Render2D->vertices.GetSize() + vertices > INX_Render2DState::MaxVertices ||
-        INX_Render2D->indices.GetSize() + indices > INX_Render2DState::MaxIndices) {
-        INX_Render2D_Flush();
+    if (call.mode != mode || call.shader != INX_Render2D->currentShader || call.layer != layer) {
+        return false;
     }
 
-    if (INX_Render2D->drawCalls.IsEmpty()) {
-        switch (mode) {
-        case INX_DrawMode2D::SHAPE:
-            INX_Render2D->drawCalls.EmplaceBack(
-                INX_Render2D->currentShader,
-                INX_Render2D->currentTexture,
-                0
-            );
-            break;
-        case INX_DrawMode2D::TEXT:
-            INX_Render2D->drawCalls.EmplaceBack(
-                INX_Render2D->currentShader,
-                INX_Render2D->currentFont,
-                0
-            );
-            break;
-        }
-        return;
+    switch (mode) {
+    case INX_DrawMode2D::SHAPE:
+        return call.texture == INX_Render2D->currentTexture;
+    case INX_DrawMode2D::TEXT:
+        return call.font == INX_Render2D->currentFont && call.page == INX_Render2D->currentFontPage;
     }
 
-    INX_DrawCall2D& call = *INX_Render2D->drawCalls.GetBack();
+    return false;
+}
 
-    if (call.count == 0) {
-        call.shader = INX_Render2D->currentShader;
-        call.mode = mode;
-        switch (mode) {
-        case INX_DrawMode2D::SHAPE:
-            call.texture = INX_Render2D->currentTexture;
-            break;
-        case INX_DrawMode2D::TEXT:
-            call.font = INX_Render2D->currentFont;
-            break;
-        }
-        return;
-    }
+static void INX_Render2D_AddQuadVertices(const INX_Quad2D& quad);
+static void INX_Render2D_ExpandQuadCall();
 
-    if (call.mode == mode && call.shader == INX_Render2D->currentShader) {
-        switch (call.mode) {
-        case INX_DrawMode2D::SHAPE:
-            if (call.texture == INX_Render2D->currentTexture) {
-                return;
-            }
-            break;
-        case INX_DrawMode2D::TEXT:
-            if (call.font == INX_Render2D->currentFont) {
-                return;
+static void INX_Render2D_SelectDrawCall(INX_DrawMode2D mode, bool instanced)
+{
+    const int layer = (INX_Render2D->batchMode == NX_BATCH_2D_SORTED) ? INX_Render2D->currentLayer : 0;
+    const size_t offset = instanced ? INX_Render2D->quads.GetSize() : INX_Render2D->indices.GetSize();
+
+    if (!INX_Render2D->drawCalls.IsEmpty())
+    {
+        const INX_DrawCall2D& call = *INX_Render2D->drawCalls.GetBack();
+
+        if (call.count == 0) {
+            INX_Render2D->drawCalls.PopBack();
+        }
+        else if (INX_Render2D_IsCurrentState(call, mode, layer)) {
+            // NOTE: Quads join an indexed call as regular geometry and an instanced
+            //       call is expanded when other geometry follows it, so that mixing
+            //       quads with other primitives never splits the batch
+            if (call.instanced && !instanced) {
+                INX_Render2D_ExpandQuadCall();
             }
-            break;
+            return;
         }
     }
 
-    if (INX_Render2D->drawCalls.GetSize() == INX_Render2DState::MaxDrawCalls) {
-        INX_Render2D_Flush();
-    }
-
     switch (mode) {
     case INX_DrawMode2D::SHAPE:
         INX_Render2D->drawCalls.EmplaceBack(
             INX_Render2D->currentShader,
             INX_Render2D->currentTexture,
-            INX_Render2D->indices.GetSize()
+            offset, layer, instanced
         );
         break;
     case INX_DrawMode2D::TEXT:
         INX_Render2D->drawCalls.EmplaceBack(
             INX_Render2D->currentShader,
             INX_Render2D->currentFont,
-            INX_Render2D->indices.GetSize()
+            INX_Render2D->currentFontPage,
+            offset, layer, instanced
         );
         break;
     }
 }
 
+static void INX_Render2D_EnsureDrawCall(INX_DrawMode2D mode, int vertices, int indices)
+{
+    // NOTE: The batch is never flushed here, the buffers grow instead so
+    //       that a whole frame is uploaded at once during NX_End2D()
+    const size_t vertexCount = INX_Render2D->vertices.GetSize() + vertices;
+    const size_t indexCount = INX_Render2D->indices.GetSize() + indices;
+
+    if (vertexCount > INX_Render2D->vertices.GetCapacity()) {
+        (void)INX_Render2D->vertices.Reserve(std::max(vertexCount, 2 * INX_Render2D->vertices.GetCapacity()));
+    }
+    if (indexCount > INX_Render2D->indices.GetCapacity()) {
+        (void)INX_Render2D->indices.Reserve(std::max(indexCount, 2 * INX_Render2D->indices.GetCapacity()));
+    }
+
+    INX_Render2D_SelectDrawCall(mode, false);
+}
+
+static void INX_Render2D_EnsureQuadCall(INX_DrawMode2D mode, int quads = 1)
+{
+    const size_t quadCount = INX_Render2D->quads.GetSize() + quads;
+
+    if (quadCount > INX_Render2D->quads.GetCapacity()) {
+        (void)INX_Render2D->quads.Reserve(std::max(quadCount, 2 * INX_Render2D->quads.GetCapacity()));
+    }
+
+    INX_Render2D_SelectDrawCall(mode, true);
+}
+
 static void INX_Render2D_Blit()
 {
     INX_Render2D->framebuffer.Resolve();
@@ -410,38 +943,252 @@ static void INX_Render2D_Blit()
     pipeline.BindTexture(0, INX_Render2D->targetColor);
     pipeline.UseProgram(INX_Programs.GetOverlay());
 
-    pipeline.SetBlendMode(gpu::BlendMode::Premultiplied);
-    pipeline.Draw(GL_TRIANGLES, 3);
-}
+    pipeline.SetBlendMode(gpu::BlendMode::Premultiplied);
+    pipeline.Draw(GL_TRIANGLES, 3);
+}
+
+static uint32_t INX_Render2D_NextVertexIndex()
+{
+    return static_cast<uint32_t>(INX_Render2D->vertices.GetSize());
+}
+
+static void INX_Render2D_AddVertex(float x, float y, float u, float v)
+{
+    INX_Render2D->vertices.EmplaceBack(
+        NX_VEC2(x, y) * (*INX_Render2D->matrixStack.GetBack()),
+        NX_VEC2(u, v), INX_Render2D->currentColor
+    );
+}
+
+static void INX_Render2D_AddVertex(const NX_Vertex2D& vertex)
+{
+    INX_Render2D->vertices.EmplaceBack(
+        vertex.position * (*INX_Render2D->matrixStack.GetBack()),
+        vertex.texcoord, vertex.color
+    );
+}
+
+static void INX_Render2D_AddIndex(uint32_t index)
+{
+    INX_Render2D->indices.EmplaceBack(index);
+    INX_Render2D->drawCalls.GetBack()->count++;
+}
+
+static void INX_Render2D_AddStroke(NX_Vec2 p0, NX_Vec2 p1, float halfThickness)
+{
+    // NOTE: Same quad as NX_DrawLineEx2D, the draw call must have room for it
+    NX_Vec2 d = NX_Vec2Direction(p0, p1);
+    NX_Vec2 n = NX_VEC2(-d.y * halfThickness, d.x * halfThickness);
+
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
+
+    INX_Render2D_AddVertex(p0.x + n.x, p0.y + n.y, 0.0f, 0.0f);
+    INX_Render2D_AddVertex(p0.x - n.x, p0.y - n.y, 0.0f, 0.0f);
+    INX_Render2D_AddVertex(p1.x - n.x, p1.y - n.y, 1.0f, 1.0f);
+    INX_Render2D_AddVertex(p1.x + n.x, p1.y + n.y, 1.0f, 1.0f);
+
+    INX_Render2D_AddIndex(baseIndex + 0);
+    INX_Render2D_AddIndex(baseIndex + 1);
+    INX_Render2D_AddIndex(baseIndex + 2);
+    INX_Render2D_AddIndex(baseIndex + 0);
+    INX_Render2D_AddIndex(baseIndex + 2);
+    INX_Render2D_AddIndex(baseIndex + 3);
+}
+
+static NX_Vec2 INX_Render2D_TurnQuarter(NX_Vec2 v, int turns)
+{
+    // NOTE: Rotation by a multiple of 90 degrees, exact unlike a sin/cos rotation
+    switch (turns & 3) {
+    case 1: return NX_VEC2(-v.y, v.x);
+    case 2: return NX_VEC2(-v.x, -v.y);
+    case 3: return NX_VEC2(v.y, -v.x);
+    default: return v;
+    }
+}
+
+static uint16_t INX_Render2D_ToUnorm16(float v)
+{
+    return static_cast<uint16_t>(NX_CLAMP(v, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+static void INX_Render2D_SetQuadColor(INX_Quad2D* quad)
+{
+    quad->color = INX_Render2D->currentColor;
+}
+
+static void INX_Render2D_AddQuadVertices(const INX_Quad2D& quad)
+{
+    // NOTE: The quad is already transformed, the vertices are pushed as they are
+    constexpr float invUnorm16 = 1.0f / 65535.0f;
+
+    const float u0 = quad.texRect[0] * invUnorm16;
+    const float v0 = quad.texRect[1] * invUnorm16;
+    const float u1 = quad.texRect[2] * invUnorm16;
+    const float v1 = quad.texRect[3] * invUnorm16;
+
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
+
+    INX_Render2D->vertices.EmplaceBack(quad.origin, NX_VEC2(u0, v0), quad.color);
+    INX_Render2D->vertices.EmplaceBack(quad.origin + quad.axisX, NX_VEC2(u1, v0), quad.color);
+    INX_Render2D->vertices.EmplaceBack(quad.origin + quad.axisX + quad.axisY, NX_VEC2(u1, v1), quad.color);
+    INX_Render2D->vertices.EmplaceBack(quad.origin + quad.axisY, NX_VEC2(u0, v1), quad.color);
+
+    INX_Render2D_AddIndex(baseIndex + 0);
+    INX_Render2D_AddIndex(baseIndex + 1);
+    INX_Render2D_AddIndex(baseIndex + 2);
+    INX_Render2D_AddIndex(baseIndex + 0);
+    INX_Render2D_AddIndex(baseIndex + 2);
+    INX_Render2D_AddIndex(baseIndex + 3);
+}
+
+static void INX_Render2D_ExpandQuadCall()
+{
+    // NOTE: Only the last call receives quads, so its quads end the array
+    INX_DrawCall2D& call = *INX_Render2D->drawCalls.GetBack();
+    util::DynamicArray<INX_Quad2D>& quads = INX_Render2D->quads;
+
+    const size_t first = call.offset;
+    const size_t count = quads.GetSize() - first;
+
+    call.instanced = false;
+    call.offset = INX_Render2D->indices.GetSize();
+    call.count = 0;
+
+    (void)INX_Render2D->vertices.Reserve(INX_Render2D->vertices.GetSize() + 4 * count);
+    (void)INX_Render2D->indices.Reserve(INX_Render2D->indices.GetSize() + 6 * count);
+
+    for (size_t i = first; i < quads.GetSize(); i++) {
+        INX_Render2D_AddQuadVertices(quads[i]);
+    }
+
+    (void)quads.Resize(first);
+}
+
+static void INX_Render2D_PushQuad(const INX_Quad2D& quad)
+{
+    INX_DrawCall2D& call = *INX_Render2D->drawCalls.GetBack();
+
+    if (call.instanced) {
+        (void)INX_Render2D->quads.PushBack(quad);
+        call.count++;
+    }
+    else {
+        INX_Render2D_AddQuadVertices(quad);
+    }
+}
+
+static void INX_Render2D_SetQuadRect(INX_Quad2D* quad, const NX_Mat3* mat, float x, float y, float w, float h)
+{
+    if (mat == nullptr) {
+        quad->origin = NX_VEC2(x, y);
+        quad->axisX = NX_VEC2(w, 0.0f);
+        quad->axisY = NX_VEC2(0.0f, h);
+    }
+    else {
+        quad->origin = NX_VEC2(x, y) * (*mat);
+        quad->axisX = NX_VEC2(x + w, y) * (*mat) - quad->origin;
+        quad->axisY = NX_VEC2(x, y + h) * (*mat) - quad->origin;
+    }
+}
+
+static const NX_Mat3* INX_Render2D_GetQuadTransform()
+{
+    // NOTE: Returns NULL for the identity so that quads skip the transform
+    const NX_Mat3* mat = INX_Render2D->matrixStack.GetBack();
+    return NX_IsMat3Identity(mat) ? nullptr : mat;
+}
+
+static bool INX_Render2D_IsScreenAreaVisible(NX_Vec2 origin, NX_Vec2 axisX, NX_Vec2 axisY, float margin)
+{
+    // NOTE: Exact screen bounds of the parallelogram spanned by the two axes
+    float minX = origin.x + std::min(axisX.x, 0.0f) + std::min(axisY.x, 0.0f) - margin;
+    float minY = origin.y + std::min(axisX.y, 0.0f) + std::min(axisY.y, 0.0f) - margin;
+    float maxX = origin.x + std::max(axisX.x, 0.0f) + std::max(axisY.x, 0.0f) + margin;
+    float maxY = origin.y + std::max(axisX.y, 0.0f) + std::max(axisY.y, 0.0f) + margin;
+
+    const NX_Vec2& size = INX_Render2D->targetSize;
+
+    if (maxX < 0.0f || maxY < 0.0f || minX > size.x || minY > size.y) {
+        INX_Render2D->stats.culled++;
+        return false;
+    }
+
+    return true;
+}
+
+static bool INX_Render2D_IsBoundsVisible(NX_Vec2 min, NX_Vec2 max, float thickness = 0.0f)
+{
+    const NX_Mat3* mat = INX_Render2D_GetQuadTransform();
+
+    INX_Quad2D bounds;
+    INX_Render2D_SetQuadRect(&bounds, mat, min.x, min.y, max.x - min.x, max.y - min.y);
+
+    // NOTE: Positive thicknesses are in pixels and negative ones in local units,
+    //       the margin covers both so that the test stays conservative
+    float margin = std::abs(thickness);
+    if (margin > 0.0f && mat != nullptr) {
+        float scaleX = std::sqrt(mat->m00 * mat->m00 + mat->m01 * mat->m01);
+        float scaleY = std::sqrt(mat->m10 * mat->m10 + mat->m11 * mat->m11);
+        margin *= std::max({scaleX, scaleY, 1.0f});
+    }
+
+    return INX_Render2D_IsScreenAreaVisible(bounds.origin, bounds.axisX, bounds.axisY, margin);
+}
+
+static void INX_Render2D_AddQuad(float x, float y, float w, float h, float u0, float v0, float u1, float v1)
+{
+    INX_Quad2D quad;
+
+    INX_Render2D_SetQuadRect(&quad, INX_Render2D_GetQuadTransform(), x, y, w, h);
+    if (!INX_Render2D_IsScreenAreaVisible(quad.origin, quad.axisX, quad.axisY, 0.0f)) {
+        return;
+    }
+
+    INX_Render2D_SetQuadColor(&quad);
+
+    quad.texRect[0] = INX_Render2D_ToUnorm16(u0);
+    quad.texRect[1] = INX_Render2D_ToUnorm16(v0);
+    quad.texRect[2] = INX_Render2D_ToUnorm16(u1);
+    quad.texRect[3] = INX_Render2D_ToUnorm16(v1);
+
+    INX_Render2D_PushQuad(quad);
+}
+
+static void INX_Render2D_AddGlyph(const NX_Font* font, const INX_Glyph& glyph, NX_Vec2 position, float fontSize)
+{
+    /* --- Calculate the scale factor based on font size --- */
+
+    float scale = fontSize / font->baseSize;
+
+    /* --- Calculate the destination of the character with scaling --- */
+
+    float xDst = position.x + glyph.xOffset * scale;
+    float yDst = position.y + glyph.yOffset * scale;
+    float wDst = glyph.wGlyph * scale;
+    float hDst = glyph.hGlyph * scale;
+
+    /* --- Convert the source rect to texture coordinates --- */
+
+    const NX_Texture* texture = INX_GetFontTexture(font, glyph.page);
+
+    float iwAtlas = 1.0f / texture->gpu.GetWidth();
+    float ihAtlas = 1.0f / texture->gpu.GetHeight();
+
+    float u0 = glyph.xAtlas * iwAtlas;
+    float v0 = glyph.yAtlas * ihAtlas;
 
-static uint16_t INX_Render2D_NextVertexIndex()
-{
-    return static_cast<uint16_t>(INX_Render2D->vertices.GetSize());
-}
+    float u1 = u0 + glyph.wGlyph * iwAtlas;
+    float v1 = v0 + glyph.hGlyph * ihAtlas;
 
-static void INX_Render2D_AddVertex(float x, float y, float u, float v)
-{
-    SDL_assert(INX_Render2D->vertices.GetSize() < INX_Render2DState::MaxVertices);
-    INX_Render2D->vertices.EmplaceBack(
-        NX_VEC2(x, y) * (*INX_Render2D->matrixStack.GetBack()),
-        NX_VEC2(u, v), INX_Render2D->currentColor
-    );
-}
+    /* --- Push the character to the batch with scaled dimensions --- */
 
-static void INX_Render2D_AddVertex(const NX_Vertex2D& vertex)
-{
-    SDL_assert(INX_Render2D->vertices.GetSize() < INX_Render2DState::MaxVertices);
-    INX_Render2D->vertices.EmplaceBack(
-        vertex.position * (*INX_Render2D->matrixStack.GetBack()),
-        vertex.texcoord, vertex.color
-    );
-}
+    const NX_Font* currentFont = INX_Render2D->currentFont;
+    INX_Render2D->currentFont = font;
+    INX_Render2D->currentFontPage = glyph.page;
+    INX_Render2D_EnsureQuadCall(INX_DrawMode2D::TEXT);
+    INX_Render2D->currentFont = currentFont;
 
-static void INX_Render2D_AddIndex(uint16_t index)
-{
-    SDL_assert(INX_Render2D->indices.GetSize() < INX_Render2DState::MaxIndices);
-    INX_Render2D->indices.EmplaceBack(index);
-    INX_Render2D->drawCalls.GetBack()->count++;
+    INX_Render2D_AddQuad(xDst, yDst, wDst, hDst, u0, v0, u1, v1);
 }
 
 static float INX_Render2D_ToPixelSize(float unit)
@@ -456,6 +1203,12 @@ static float INX_Render2D_ToPixelSize(float unit)
     return unit;
 }
 
+static float INX_Render2D_ToStrokeWidth(float thickness)
+{
+    // NOTE: Positive thicknesses are in pixels, negative ones are already converted
+    return (thickness > 0.0f) ? INX_Render2D_ToPixelSize(thickness) : -thickness;
+}
+
 // ============================================================================
 // PUBLIC API
 // ============================================================================
@@ -469,6 +1222,7 @@ void NX_Begin2D(NX_RenderTexture* target)
         .time = static_cast<float>(NX_GetElapsedTime())
     });
     INX_Render2D->currentTarget = target;
+    INX_Render2D->targetSize = NX_VEC2(size.x, size.y);
 
     // TODO: Move the clear during the first draw
     gpu::Pipeline([&](const gpu::Pipeline& pipeline) {
@@ -488,6 +1242,16 @@ void NX_End2D()
     });
 }
 
+NX_Render2DStats NX_GetRender2DStats()
+{
+    return INX_Render2D->stats;
+}
+
+void NX_ResetRender2DStats()
+{
+    INX_Render2D->stats = NX_Render2DStats{};
+}
+
 void NX_SetColor2D(NX_Color color)
 {
     INX_Render2D->currentColor = color;
@@ -508,6 +1272,29 @@ void NX_SetShader2D(NX_Shader2D* shader)
     INX_Render2D->currentShader = shader;
 }
 
+void NX_SetBatchMode2D(NX_BatchMode2D mode)
+{
+    if (INX_Render2D->batchMode != mode) {
+        INX_Render2D_Flush();
+        INX_Render2D->batchMode = mode;
+    }
+}
+
+NX_BatchMode2D NX_GetBatchMode2D()
+{
+    return INX_Render2D->batchMode;
+}
+
+void NX_SetLayer2D(int layer)
+{
+    INX_Render2D->currentLayer = layer;
+}
+
+int NX_GetLayer2D()
+{
+    return INX_Render2D->currentLayer;
+}
+
 void NX_Push2D()
 {
     if (!INX_Render2D->matrixStack.PushBack(*INX_Render2D->matrixStack.GetBack())) {
@@ -737,7 +1524,7 @@ void NX_DrawLineEx2D(const NX_Vertex2D* v0, const NX_Vertex2D* v1, float thickne
     float nx = -d.y * thickness * 0.5f;
     float ny = +d.x * thickness * 0.5f;
 
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
 
     /* --- Adding vertices and indices --- */
 
@@ -791,7 +1578,7 @@ void NX_DrawTriangleEx2D(const NX_Vertex2D* v0, const NX_Vertex2D* v1, const NX_
 {
     INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, 3, 3);
 
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
 
     INX_Render2D_AddVertex(*v0);
     INX_Render2D_AddVertex(*v1);
@@ -818,7 +1605,7 @@ void NX_DrawQuadEx2D(const NX_Vertex2D* v0, const NX_Vertex2D* v1, const NX_Vert
 {
     INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, 4, 6);
 
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
 
     INX_Render2D_AddVertex(*v0);
     INX_Render2D_AddVertex(*v1);
@@ -836,26 +1623,35 @@ void NX_DrawQuadEx2D(const NX_Vertex2D* v0, const NX_Vertex2D* v1, const NX_Vert
 
 void NX_DrawRect2D(float x, float y, float w, float h)
 {
-    INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, 4, 6);
-
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
+    INX_Render2D_EnsureQuadCall(INX_DrawMode2D::SHAPE);
+    INX_Render2D_AddQuad(x, y, w, h, 0.0f, 0.0f, 1.0f, 1.0f);
+}
 
-    INX_Render2D_AddVertex(x, y, 0.0f, 0.0f);
-    INX_Render2D_AddVertex(x + w, y, 1.0f, 0.0f);
-    INX_Render2D_AddVertex(x + w, y + h, 1.0f, 1.0f);
-    INX_Render2D_AddVertex(x, y + h, 0.0f, 1.0f);
+void NX_DrawSprite2D(const NX_SpriteAtlas* atlas, int sprite, float x, float y, float w, float h)
+{
+    NX_SpriteRegion region{};
+    if (!NX_GetSpriteRegion(atlas, sprite, &region)) {
+        return;
+    }
 
-    INX_Render2D_AddIndex(baseIndex + 0);
-    INX_Render2D_AddIndex(baseIndex + 1);
-    INX_Render2D_AddIndex(baseIndex + 2);
+    const NX_Texture* texture = INX_Render2D->currentTexture;
+    INX_Render2D->currentTexture = region.texture;
+    INX_Render2D_EnsureQuadCall(INX_DrawMode2D::SHAPE);
+    INX_Render2D->currentTexture = texture;
 
-    INX_Render2D_AddIndex(baseIndex + 0);
-    INX_Render2D_AddIndex(baseIndex + 2);
-    INX_Render2D_AddIndex(baseIndex + 3);
+    INX_Render2D_AddQuad(
+        x, y, w, h,
+        region.uvMin.x, region.uvMin.y,
+        region.uvMax.x, region.uvMax.y
+    );
 }
 
 void NX_DrawRectBorder2D(float x, float y, float w, float h, float thickness)
 {
+    if (!INX_Render2D_IsBoundsVisible(NX_VEC2(x, y), NX_VEC2(x + w, y + h), thickness)) {
+        return;
+    }
+
     const NX_Color& color = INX_Render2D->currentColor;
 
     NX_Vertex2D v0 = { .position = {x,     y},     .texcoord = {0.0f, 0.0f}, .color = color };
@@ -876,6 +1672,10 @@ void NX_DrawRectBorder2D(float x, float y, float w, float h, float thickness)
 
 void NX_DrawRectRounded2D(float x, float y, float w, float h, float radius, int segments)
 {
+    if (!INX_Render2D_IsBoundsVisible(NX_VEC2(x, y), NX_VEC2(x + w, y + h))) {
+        return;
+    }
+
     radius = std::min(radius, std::min(w * 0.5f, h * 0.5f));
 
     if (radius <= 0.0f) {
@@ -885,39 +1685,41 @@ void NX_DrawRectRounded2D(float x, float y, float w, float h, float radius, int
 
     /* --- Calculation of vertices and indices --- */
 
+    segments = std::max(segments, 1);
+
     int cornerVertices = segments + 1;
     int totalVertices = 4 * cornerVertices + 8;
     int totalIndices = 4 * segments * 3 + 12;
 
     INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, totalVertices, totalIndices);
 
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
-    uint16_t currentIndex = 0;
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
+    uint32_t currentIndex = 0;
 
-    /* --- Corner centers and angle data --- */
+    /* --- Corner centers and quarter turns from angle zero --- */
 
-    float cornerData[4][4] = {
-        {x + radius, y + radius, NX_PI, NX_PI * 1.5f},              // Top-left
-        {x + w - radius, y + radius, NX_PI * 1.5f, NX_PI * 2.0f},   // Top-right
-        {x + w - radius, y + h - radius, 0.0f, NX_PI * 0.5f},       // Bottom-right
-        {x + radius, y + h - radius, NX_PI * 0.5f, NX_PI}           // Bottom-left
+    float cornerData[4][3] = {
+        {x + radius, y + radius, 2},            // Top-left
+        {x + w - radius, y + radius, 3},        // Top-right
+        {x + w - radius, y + h - radius, 0},    // Bottom-right
+        {x + radius, y + h - radius, 1}         // Bottom-left
     };
 
+    const NX_Vec2* quarter = INX_Render2D->shapeTables.GetQuarter(segments);
+
     /* --- Corner generation --- */
 
     for (int corner = 0; corner < 4; corner++) {
         float cx = cornerData[corner][0];
         float cy = cornerData[corner][1];
-        float startAngle = cornerData[corner][2];
-        float angleRange = cornerData[corner][3] - startAngle;
-        float angleStep = angleRange / segments;
-        uint16_t centerIdx = currentIndex++;
+        int turns = static_cast<int>(cornerData[corner][2]);
+        uint32_t centerIdx = currentIndex++;
         INX_Render2D_AddVertex(cx, cy, 0.5f, 0.5f);
         for (int i = 0; i <= segments; i++) {
-            float angle = startAngle + i * angleStep;
+            NX_Vec2 dir = INX_Render2D_TurnQuarter(quarter[i], turns);
             INX_Render2D_AddVertex(
-                cx + std::cos(angle) * radius,
-                cy + std::sin(angle) * radius,
+                cx + dir.x * radius,
+                cy + dir.y * radius,
                 0.5f, 0.5f
             );
             if (i > 0) {
@@ -941,7 +1743,7 @@ void NX_DrawRectRounded2D(float x, float y, float w, float h, float radius, int
     };
 
     for (int rect = 0; rect < 3; rect++) {
-        uint16_t rectStart = currentIndex;
+        uint32_t rectStart = currentIndex;
         float uvs[4][2] = {
             {0.0f, 0.0f},
             {1.0f, 0.0f},
@@ -955,7 +1757,7 @@ void NX_DrawRectRounded2D(float x, float y, float w, float h, float radius, int
                 uvs[i][0], uvs[i][1]
             );
         }
-        uint16_t indices[6] = {0, 1, 2, 0, 2, 3};
+        uint32_t indices[6] = {0, 1, 2, 0, 2, 3};
         for (int i = 0; i < 6; i++) {
             INX_Render2D_AddIndex(baseIndex + rectStart + indices[i]);
         }
@@ -965,6 +1767,10 @@ void NX_DrawRectRounded2D(float x, float y, float w, float h, float radius, int
 
 void NX_DrawRectRoundedBorder2D(float x, float y, float w, float h, float radius, int segments, float thickness)
 {
+    if (!INX_Render2D_IsBoundsVisible(NX_VEC2(x, y), NX_VEC2(x + w, y + h), thickness)) {
+        return;
+    }
+
     /* --- Calculation of the minimum radius required per corner --- */
 
     radius = std::min(radius, std::min(w * 0.5f, h * 0.5f));
@@ -989,47 +1795,49 @@ void NX_DrawRectRoundedBorder2D(float x, float y, float w, float h, float radius
     float innerRadius = std::max(0.0f, radius - halfThickness);
     float outerRadius = radius + halfThickness;
 
+    segments = std::max(segments, 1);
+
     int arcVertices = (segments + 1) * 2;
     int totalVertices = 4 * arcVertices + 16;
     int totalIndices = 4 * segments * 6 + 48;
 
     INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, totalVertices, totalIndices);
 
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
-    uint16_t currentIndex = 0;
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
+    uint32_t currentIndex = 0;
 
     /* --- Corner data --- */
 
-    float cornerData[4][4] = {
-        {x + radius, y + radius, NX_PI, NX_PI * 1.5f},
-        {x + w - radius, y + radius, NX_PI * 1.5f, NX_PI * 2.0f},
-        {x + w - radius, y + h - radius, 0.0f, NX_PI * 0.5f},
-        {x + radius, y + h - radius, NX_PI * 0.5f, NX_PI}
+    float cornerData[4][3] = {
+        {x + radius, y + radius, 2},
+        {x + w - radius, y + radius, 3},
+        {x + w - radius, y + h - radius, 0},
+        {x + radius, y + h - radius, 1}
     };
 
+    const NX_Vec2* quarter = INX_Render2D->shapeTables.GetQuarter(segments);
+
     /* --- Generating corner borders --- */
 
     for (int corner = 0; corner < 4; corner++) {
         float cx = cornerData[corner][0];
         float cy = cornerData[corner][1];
-        float startAngle = cornerData[corner][2];
-        float angleRange = cornerData[corner][3] - startAngle;
-        float angleStep = angleRange / segments;
+        int turns = static_cast<int>(cornerData[corner][2]);
 
-        uint16_t cornerStart = currentIndex;
+        uint32_t cornerStart = currentIndex;
 
         // Generation of pairs of vertices and quads
         for (int i = 0; i <= segments; i++) {
-            float angle = startAngle + i * angleStep;
-            float cosA = std::cos(angle);
-            float sinA = std::sin(angle);
+            NX_Vec2 dir = INX_Render2D_TurnQuarter(quarter[i], turns);
+            float cosA = dir.x;
+            float sinA = dir.y;
 
             // Vertices inner/outer
             INX_Render2D_AddVertex(cx + cosA * innerRadius, cy + sinA * innerRadius, 0.5f, 0.5f);
             INX_Render2D_AddVertex(cx + cosA * outerRadius, cy + sinA * outerRadius, 0.5f, 0.5f);
 
             if (i > 0) {
-                uint16_t base = baseIndex + cornerStart + (i - 1) * 2;
+                uint32_t base = baseIndex + cornerStart + (i - 1) * 2;
                 // Quad with 2 triangles
                 INX_Render2D_AddIndex(base);
                 INX_Render2D_AddIndex(base + 1);
@@ -1062,7 +1870,7 @@ void NX_DrawRectRoundedBorder2D(float x, float y, float w, float h, float radius
     /* --- Generation of straight segments --- */
 
     for (int seg = 0; seg < 4; seg++) {
-        uint16_t segStart = currentIndex;
+        uint32_t segStart = currentIndex;
         float uvs[4][2] = {
             {0.0f, 0.0f},
             {1.0f, 0.0f},
@@ -1076,7 +1884,7 @@ void NX_DrawRectRoundedBorder2D(float x, float y, float w, float h, float radius
                 uvs[i][0], uvs[i][1]
             );
         }
-        uint16_t indices[6] = {0, 1, 2, 0, 2, 3};
+        uint32_t indices[6] = {0, 1, 2, 0, 2, 3};
         for (int i = 0; i < 6; i++) {
             INX_Render2D_AddIndex(baseIndex + segStart + indices[i]);
         }
@@ -1086,35 +1894,28 @@ void NX_DrawRectRoundedBorder2D(float x, float y, float w, float h, float radius
 
 void NX_DrawCircle2D(NX_Vec2 center, float radius, int segments)
 {
+    if (!INX_Render2D_IsBoundsVisible(center - NX_VEC2(radius, radius), center + NX_VEC2(radius, radius))) {
+        return;
+    }
+
     if (segments < 3) segments = 32;
 
     INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, segments + 1, segments * 3);
 
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
 
     INX_Render2D_AddVertex(center.x, center.y, 0.5f, 0.5f);
 
-    float delta = NX_TAU / segments;
-    float cosDelta = std::cos(delta);
-    float sinDelta = std::sin(delta);
-
-    float inv2r = 1.0f / (2.0f * radius);
-
-    float cx = radius;
-    float cy = 0.0f;
+    const NX_Vec2* unit = INX_Render2D->shapeTables.GetCircle(segments);
 
     for (int i = 0; i < segments; i++) {
-        float x = center.x + cx;
-        float y = center.y + cy;
+        float x = center.x + radius * unit[i].x;
+        float y = center.y + radius * unit[i].y;
 
-        float u = 0.5f + cx * inv2r;
-        float v = 0.5f + cy * inv2r;
+        float u = 0.5f + 0.5f * unit[i].x;
+        float v = 0.5f + 0.5f * unit[i].y;
 
         INX_Render2D_AddVertex(x, y, u, v);
-
-        float new_cx = cx * cosDelta - cy * sinDelta;
-        cy = cx * sinDelta + cy * cosDelta;
-        cx = new_cx;
     }
 
     for (int i = 0; i < segments; i++) {
@@ -1127,72 +1928,46 @@ void NX_DrawCircle2D(NX_Vec2 center, float radius, int segments)
 
 void NX_DrawCircleBorder2D(NX_Vec2 p, float radius, int segments, float thickness)
 {
-    if (segments < 3) segments = 32;
-
-    if (thickness > 0.0f) {
-        // Convert thickness to pixels and negate it to avoid doing a redundant conversion
-        thickness = -INX_Render2D_ToPixelSize(thickness);
+    if (!INX_Render2D_IsBoundsVisible(p - NX_VEC2(radius, radius), p + NX_VEC2(radius, radius), thickness)) {
+        return;
     }
 
-    float delta = NX_TAU / segments;
-    float cosDelta = std::cos(delta);
-    float sinDelta = std::sin(delta);
-
-    float cx = radius;
-    float cy = 0.0f;
-
-    NX_Vec2 prev = { p.x + cx, p.y + cy };
-
-    for (int i = 1; i <= segments; i++) {
-        float new_cx = cx * cosDelta - cy * sinDelta;
-        float new_cy = cx * sinDelta + cy * cosDelta;
-        cx = new_cx;
-        cy = new_cy;
+    if (segments < 3) segments = 32;
 
-        NX_Vec2 curr = { p.x + cx, p.y + cy };
+    float halfThickness = 0.5f * INX_Render2D_ToStrokeWidth(thickness);
+    const NX_Vec2* unit = INX_Render2D->shapeTables.GetCircle(segments);
 
-        // Line between prev and curr
-        NX_DrawLine2D(prev, curr, thickness);
+    INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, 4 * segments, 6 * segments);
 
-        prev = curr;
+    for (int i = 0; i < segments; i++) {
+        INX_Render2D_AddStroke(p + unit[i] * radius, p + unit[i + 1] * radius, halfThickness);
     }
 }
 
 void NX_DrawEllipse2D(NX_Vec2 center, NX_Vec2 radius, int segments)
 {
+    if (!INX_Render2D_IsBoundsVisible(center - radius, center + radius)) {
+        return;
+    }
+
     if (segments < 3) segments = 32;
 
     INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, segments + 1, segments * 3);
 
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
 
     INX_Render2D_AddVertex(center.x, center.y, 0.5f, 0.5f);
 
-    float delta = NX_TAU / segments;
-    float cosDelta = std::cos(delta);
-    float sinDelta = std::sin(delta);
-
-    float inv2rx = 1.0f / (2.0f * radius.x);
-    float inv2ry = 1.0f / (2.0f * radius.y);
-
-    float ux = 1.0f;
-    float uy = 0.0f;
+    const NX_Vec2* unit = INX_Render2D->shapeTables.GetCircle(segments);
 
     for (int i = 0; i < segments; i++) {
-        float cx = radius.x * ux;
-        float cy = radius.y * uy;
-
-        float x = center.x + cx;
-        float y = center.y + cy;
+        float x = center.x + radius.x * unit[i].x;
+        float y = center.y + radius.y * unit[i].y;
 
-        float u = 0.5f + cx * inv2rx; // = 0.5f + 0.5f * ux
-        float v = 0.5f + cy * inv2ry; // = 0.5f + 0.5f * uy
+        float u = 0.5f + 0.5f * unit[i].x;
+        float v = 0.5f + 0.5f * unit[i].y;
 
         INX_Render2D_AddVertex(x, y, u, v);
-
-        float newUX = ux * cosDelta - uy * sinDelta;
-        uy = ux * sinDelta + uy * cosDelta;
-        ux = newUX;
     }
 
     for (int i = 0; i < segments; i++) {
@@ -1205,35 +1980,28 @@ void NX_DrawEllipse2D(NX_Vec2 center, NX_Vec2 radius, int segments)
 
 void NX_DrawEllipseBorder2D(NX_Vec2 p, NX_Vec2 r, int segments, float thickness)
 {
-    if (segments < 3) segments = 32;
-
-    if (thickness > 0.0f) {
-        // Convert thickness to pixels and negate it to avoid doing a redundant conversion
-        thickness = -INX_Render2D_ToPixelSize(thickness);
+    if (!INX_Render2D_IsBoundsVisible(p - r, p + r, thickness)) {
+        return;
     }
 
-    float delta = NX_TAU / segments;
-    float cosDelta = std::cos(delta);
-    float sinDelta = std::sin(delta);
+    if (segments < 3) segments = 32;
 
-    NX_Vec2 u = { 1.0f, 0.0f };
-    NX_Vec2 prev = p + NX_Vec2{ r.x * u.x, r.y * u.y };
+    float halfThickness = 0.5f * INX_Render2D_ToStrokeWidth(thickness);
+    const NX_Vec2* unit = INX_Render2D->shapeTables.GetCircle(segments);
 
-    for (int i = 1; i <= segments; i++)
-    {
-        u = NX_VEC2(
-            u.x * cosDelta - u.y * sinDelta,
-            u.x * sinDelta + u.y * cosDelta
-        );
+    INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, 4 * segments, 6 * segments);
 
-        NX_Vec2 curr = p + NX_Vec2{ r.x * u.x, r.y * u.y };
-        NX_DrawLine2D(prev, curr, thickness);
-        prev = curr;
+    for (int i = 0; i < segments; i++) {
+        INX_Render2D_AddStroke(p + unit[i] * r, p + unit[i + 1] * r, halfThickness);
     }
 }
 
 void NX_DrawPieSlice2D(NX_Vec2 center, float radius, float startAngle, float endAngle, int segments)
 {
+    if (!INX_Render2D_IsBoundsVisible(center - NX_VEC2(radius, radius), center + NX_VEC2(radius, radius))) {
+        return;
+    }
+
     if (segments < 1) segments = 16;
 
     float angleDiff = endAngle - startAngle;
@@ -1250,7 +2018,7 @@ void NX_DrawPieSlice2D(NX_Vec2 center, float radius, float startAngle, float end
 
     INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, segments + 2, segments * 3);
 
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
 
     INX_Render2D_AddVertex(center.x, center.y, 0.5f, 0.5f);
 
@@ -1278,6 +2046,10 @@ void NX_DrawPieSlice2D(NX_Vec2 center, float radius, float startAngle, float end
 
 void NX_DrawPieSliceBorder2D(NX_Vec2 center, float radius, float startAngle, float endAngle, int segments, float thickness)
 {
+    if (!INX_Render2D_IsBoundsVisible(center - NX_VEC2(radius, radius), center + NX_VEC2(radius, radius), thickness)) {
+        return;
+    }
+
     if (segments < 1) segments = 16;
 
     if (thickness > 0.0f) {
@@ -1316,22 +2088,25 @@ void NX_DrawPieSliceBorder2D(NX_Vec2 center, float radius, float startAngle, flo
 
 void NX_DrawRing2D(NX_Vec2 center, float innerRadius, float outerRadius, int segments)
 {
+    float ringRadius = std::max(innerRadius, outerRadius);
+    if (!INX_Render2D_IsBoundsVisible(center - NX_VEC2(ringRadius, ringRadius), center + NX_VEC2(ringRadius, ringRadius))) {
+        return;
+    }
+
     if (segments < 3) segments = 32;
     if (innerRadius >= outerRadius) return;
 
     INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, segments * 2, segments * 6);
 
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
-
-    float deltaAngle = NX_TAU / segments;
-    float cosDelta = std::cos(deltaAngle);
-    float sinDelta = std::sin(deltaAngle);
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
 
-    float cosA = 1.0f;
-    float sinA = 0.0f;
+    const NX_Vec2* unit = INX_Render2D->shapeTables.GetCircle(segments);
     float innerScale = innerRadius / outerRadius;
 
     for (int i = 0; i < segments; i++) {
+        float cosA = unit[i].x;
+        float sinA = unit[i].y;
+
         float outerX = center.x + outerRadius * cosA;
         float outerY = center.y + outerRadius * sinA;
         float outerU = 0.5f + 0.5f * cosA;
@@ -1343,11 +2118,6 @@ void NX_DrawRing2D(NX_Vec2 center, float innerRadius, float outerRadius, int seg
         float innerU = 0.5f + 0.5f * innerScale * cosA;
         float innerV = 0.5f + 0.5f * innerScale * sinA;
         INX_Render2D_AddVertex(innerX, innerY, innerU, innerV);
-
-        float newCos = cosA * cosDelta - sinA * sinDelta;
-        float newSin = sinA * cosDelta + cosA * sinDelta;
-        cosA = newCos;
-        sinA = newSin;
     }
 
     for (int i = 0; i < segments; i++) {
@@ -1369,43 +2139,33 @@ void NX_DrawRing2D(NX_Vec2 center, float innerRadius, float outerRadius, int seg
 
 void NX_DrawRingBorder2D(NX_Vec2 center, float innerRadius, float outerRadius, int segments, float thickness)
 {
-    if (segments < 3) segments = 32;
-    if (innerRadius >= outerRadius) return;
-
-    if (thickness > 0.0f) {
-        // Convert thickness to pixels and negate it to avoid doing a redundant conversion
-        thickness = -INX_Render2D_ToPixelSize(thickness);
+    float ringRadius = std::max(innerRadius, outerRadius);
+    if (!INX_Render2D_IsBoundsVisible(center - NX_VEC2(ringRadius, ringRadius), center + NX_VEC2(ringRadius, ringRadius), thickness)) {
+        return;
     }
 
-    float deltaAngle = NX_TAU / segments;
-    float cosDelta = std::cos(deltaAngle);
-    float sinDelta = std::sin(deltaAngle);
-
-    float cosA = 1.0f;
-    float sinA = 0.0f;
-    NX_Vec2 outerPrev = { center.x + outerRadius * cosA, center.y + outerRadius * sinA };
-    NX_Vec2 innerPrev = { center.x + innerRadius * cosA, center.y + innerRadius * sinA };
-
-    for (int i = 1; i <= segments; i++) {
-        float newCos = cosA * cosDelta - sinA * sinDelta;
-        float newSin = sinA * cosDelta + cosA * sinDelta;
-        cosA = newCos;
-        sinA = newSin;
+    if (segments < 3) segments = 32;
+    if (innerRadius >= outerRadius) return;
 
-        NX_Vec2 outerCurr = { center.x + outerRadius * cosA, center.y + outerRadius * sinA };
-        NX_Vec2 innerCurr = { center.x + innerRadius * cosA, center.y + innerRadius * sinA };
+    float halfThickness = 0.5f * INX_Render2D_ToStrokeWidth(thickness);
+    const NX_Vec2* unit = INX_Render2D->shapeTables.GetCircle(segments);
 
-        NX_DrawLine2D(outerPrev, outerCurr, thickness);
-        NX_DrawLine2D(innerPrev, innerCurr, thickness);
+    INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, 8 * segments, 12 * segments);
 
-        outerPrev = outerCurr;
-        innerPrev = innerCurr;
+    for (int i = 0; i < segments; i++) {
+        INX_Render2D_AddStroke(center + unit[i] * outerRadius, center + unit[i + 1] * outerRadius, halfThickness);
+        INX_Render2D_AddStroke(center + unit[i] * innerRadius, center + unit[i + 1] * innerRadius, halfThickness);
     }
 }
 
 void NX_DrawRingArc2D(NX_Vec2 center, float innerRadius, float outerRadius,
                       float startAngle, float endAngle, int segments)
 {
+    float ringRadius = std::max(innerRadius, outerRadius);
+    if (!INX_Render2D_IsBoundsVisible(center - NX_VEC2(ringRadius, ringRadius), center + NX_VEC2(ringRadius, ringRadius))) {
+        return;
+    }
+
     if (segments < 1) segments = 16;
     if (innerRadius >= outerRadius) return;
 
@@ -1423,7 +2183,7 @@ void NX_DrawRingArc2D(NX_Vec2 center, float innerRadius, float outerRadius,
 
     INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, (segments + 1) * 2, segments * 6);
 
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
+    uint32_t baseIndex = INX_Render2D_NextVertexIndex();
 
     for (int i = 0; i <= segments; i++) {
         float outerX = center.x + outerRadius * cosA;
@@ -1464,6 +2224,11 @@ void NX_DrawRingArc2D(NX_Vec2 center, float innerRadius, float outerRadius,
 void NX_DrawRingArcBorder2D(NX_Vec2 center, float innerRadius, float outerRadius,
                             float startAngle, float endAngle, int segments, float thickness)
 {
+    float ringRadius = std::max(innerRadius, outerRadius);
+    if (!INX_Render2D_IsBoundsVisible(center - NX_VEC2(ringRadius, ringRadius), center + NX_VEC2(ringRadius, ringRadius), thickness)) {
+        return;
+    }
+
     if (segments < 1) segments = 16;
     if (innerRadius >= outerRadius) return;
 
@@ -1514,6 +2279,10 @@ void NX_DrawArc2D(NX_Vec2 center, float radius,
                    float startAngle, float endAngle,
                    int segments, float thickness)
 {
+    if (!INX_Render2D_IsBoundsVisible(center - NX_VEC2(radius, radius), center + NX_VEC2(radius, radius), thickness)) {
+        return;
+    }
+
     if (segments < 1) segments = 16;
 
     if (thickness > 0.0f) {
@@ -1554,6 +2323,10 @@ void NX_DrawArc2D(NX_Vec2 center, float radius,
 
 void NX_DrawBezierQuad2D(NX_Vec2 p0, NX_Vec2 p1, NX_Vec2 p2, int segments, float thickness)
 {
+    if (!INX_Render2D_IsBoundsVisible(NX_Vec2Min(p0, NX_Vec2Min(p1, p2)), NX_Vec2Max(p0, NX_Vec2Max(p1, p2)), thickness)) {
+        return;
+    }
+
     if (segments < 1) segments = 20;
 
     if (thickness > 0.0f) {
@@ -1593,6 +2366,12 @@ void NX_DrawBezierQuad2D(NX_Vec2 p0, NX_Vec2 p1, NX_Vec2 p2, int segments, float
 
 void NX_DrawBezierCubic2D(NX_Vec2 p0, NX_Vec2 p1, NX_Vec2 p2, NX_Vec2 p3, int segments, float thickness)
 {
+    NX_Vec2 hullMin = NX_Vec2Min(NX_Vec2Min(p0, p1), NX_Vec2Min(p2, p3));
+    NX_Vec2 hullMax = NX_Vec2Max(NX_Vec2Max(p0, p1), NX_Vec2Max(p2, p3));
+    if (!INX_Render2D_IsBoundsVisible(hullMin, hullMax, thickness)) {
+        return;
+    }
+
     if (segments < 1) segments = 30;
 
     if (thickness > 0.0f) {
@@ -1648,10 +2427,11 @@ void NX_DrawSpline2D(const NX_Vec2* points, int count, int segments, float thick
     if (count < 4) return;
     if (segments < 1) segments = 20;
 
-    if (thickness > 0.0f) {
-        // Convert thickness to pixels and negate it to avoid doing a redundant conversion
-        thickness = -INX_Render2D_ToPixelSize(thickness);
-    }
+    float halfThickness = 0.5f * INX_Render2D_ToStrokeWidth(thickness);
+    const NX_Vec4* weights = INX_Render2D->shapeTables.GetCatmullRom(segments);
+
+    int spanCount = count - 3;
+    INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, 4 * segments * spanCount, 6 * segments * spanCount);
 
     for (int i = 1; i < count - 2; i++) {
         NX_Vec2 p0 = points[i - 1];
@@ -1659,78 +2439,94 @@ void NX_DrawSpline2D(const NX_Vec2* points, int count, int segments, float thick
         NX_Vec2 p2 = points[i + 1];
         NX_Vec2 p3 = points[i + 2];
 
-        float prevX = p1.x;
-        float prevY = p1.y;
-
-        for (int j = 1; j <= segments; j++) {
-            float t = static_cast<float>(j) / segments;
-            float t2 = t * t;
-            float t3 = t2 * t;
-
-            // Catmull-Rom coeffs
-            float c0 = -0.5f * t3 + t2 - 0.5f * t;
-            float c1 =  1.5f * t3 - 2.5f * t2 + 1.0f;
-            float c2 = -1.5f * t3 + 2.0f * t2 + 0.5f * t;
-            float c3 =  0.5f * t3 - 0.5f * t2;
-
-            float x = c0 * p0.x + c1 * p1.x + c2 * p2.x + c3 * p3.x;
-            float y = c0 * p0.y + c1 * p1.y + c2 * p2.y + c3 * p3.y;
-
-            NX_DrawLine2D(NX_VEC2(prevX, prevY), NX_VEC2(x, y), thickness);
+        NX_Vec2 prev = p1;
 
-            prevX = x;
-            prevY = y;
+        for (int j = 0; j < segments; j++) {
+            const NX_Vec4& c = weights[j];
+            NX_Vec2 curr = NX_VEC2(
+                c.x * p0.x + c.y * p1.x + c.z * p2.x + c.w * p3.x,
+                c.x * p0.y + c.y * p1.y + c.z * p2.y + c.w * p3.y
+            );
+            INX_Render2D_AddStroke(prev, curr, halfThickness);
+            prev = curr;
         }
     }
 }
 
-void NX_DrawCodepoint2D(int codepoint, NX_Vec2 position, float fontSize)
+void NX_DrawPath2D(const NX_Path2D* path, float thickness)
 {
-    /* --- Get current font and the glyph data --- */
-
-    const NX_Font* font = INX_Assets.Select(INX_Render2D->currentFont, INX_FontAsset::DEFAULT);
-    const INX_Glyph& glyph = INX_GetFontGlyph(font, codepoint);
+    if (path->points.IsEmpty() || !INX_Render2D_IsBoundsVisible(path->boundsMin, path->boundsMax, thickness)) {
+        return;
+    }
 
-    /* --- Calculate the scale factor based on font size --- */
+    /* --- Count the strokes to reserve the whole path at once --- */
 
-    float scale = fontSize / font->baseSize;
+    int strokeCount = 0;
+    for (size_t i = 0; i < path->subPaths.GetSize(); i++) {
+        const INX_SubPath2D& subPath = path->subPaths[i];
+        strokeCount += subPath.count - 1 + ((subPath.closed && subPath.count > 2) ? 1 : 0);
+    }
 
-    /* --- Calculate the destination of the character with scaling --- */
+    if (strokeCount <= 0) {
+        return;
+    }
 
-    float xDst = position.x + glyph.xOffset * scale;
-    float yDst = position.y + glyph.yOffset * scale;
-    float wDst = glyph.wGlyph * scale;
-    float hDst = glyph.hGlyph * scale;
+    float halfThickness = 0.5f * INX_Render2D_ToStrokeWidth(thickness);
+    INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, 4 * strokeCount, 6 * strokeCount);
 
-    /* --- Convert the source rect to texture coordinates --- */
+    /* --- Stroke every sub-path --- */
 
-    float iwAtlas = 1.0f / font->texture->gpu.GetWidth();
-    float ihAtlas = 1.0f / font->texture->gpu.GetHeight();
+    for (size_t i = 0; i < path->subPaths.GetSize(); i++) {
+        const INX_SubPath2D& subPath = path->subPaths[i];
+        const NX_Vec2* points = path->points.GetData() + subPath.first;
+        for (int j = 1; j < subPath.count; j++) {
+            INX_Render2D_AddStroke(points[j - 1], points[j], halfThickness);
+        }
+        if (subPath.closed && subPath.count > 2) {
+            INX_Render2D_AddStroke(points[subPath.count - 1], points[0], halfThickness);
+        }
+    }
+}
 
-    float u0 = glyph.xAtlas * iwAtlas;
-    float v0 = glyph.yAtlas * ihAtlas;
+void NX_DrawPathFilled2D(const NX_Path2D* path)
+{
+    if (path->points.IsEmpty() || !INX_Render2D_IsBoundsVisible(path->boundsMin, path->boundsMax)) {
+        return;
+    }
 
-    float u1 = u0 + glyph.wGlyph * iwAtlas;
-    float v1 = v0 + glyph.hGlyph * ihAtlas;
+    NX_Vec2 size = path->boundsMax - path->boundsMin;
+    NX_Vec2 invSize = NX_VEC2(
+        (size.x > 0.0f) ? 1.0f / size.x : 0.0f,
+        (size.y > 0.0f) ? 1.0f / size.y : 0.0f
+    );
 
-    /* --- Push the character to the batch with scaled dimensions --- */
+    for (size_t i = 0; i < path->subPaths.GetSize(); i++)
+    {
+        const INX_SubPath2D& subPath = path->subPaths[i];
+        if (subPath.count < 3) continue;
 
-    INX_Render2D_EnsureDrawCall(INX_DrawMode2D::TEXT, 4, 6);
+        INX_Render2D_EnsureDrawCall(INX_DrawMode2D::SHAPE, subPath.count, 3 * (subPath.count - 2));
 
-    uint16_t baseIndex = INX_Render2D_NextVertexIndex();
+        uint32_t baseIndex = INX_Render2D_NextVertexIndex();
+        const NX_Vec2* points = path->points.GetData() + subPath.first;
 
-    INX_Render2D_AddVertex(xDst, yDst, u0, v0);
-    INX_Render2D_AddVertex(xDst, yDst + hDst, u0, v1);
-    INX_Render2D_AddVertex(xDst + wDst, yDst + hDst, u1, v1);
-    INX_Render2D_AddVertex(xDst + wDst, yDst, u1, v0);
+        for (int j = 0; j < subPath.count; j++) {
+            NX_Vec2 uv = (points[j] - path->boundsMin) * invSize;
+            INX_Render2D_AddVertex(points[j].x, points[j].y, uv.x, uv.y);
+        }
 
-    INX_Render2D_AddIndex(baseIndex + 0);
-    INX_Render2D_AddIndex(baseIndex + 1);
-    INX_Render2D_AddIndex(baseIndex + 2);
+        for (int j = 1; j < subPath.count - 1; j++) {
+            INX_Render2D_AddIndex(baseIndex);
+            INX_Render2D_AddIndex(baseIndex + j);
+            INX_Render2D_AddIndex(baseIndex + j + 1);
+        }
+    }
+}
 
-    INX_Render2D_AddIndex(baseIndex + 0);
-    INX_Render2D_AddIndex(baseIndex + 2);
-    INX_Render2D_AddIndex(baseIndex + 3);
+void NX_DrawCodepoint2D(int codepoint, NX_Vec2 position, float fontSize)
+{
+    const NX_Font* font = INX_Assets.Select(INX_Render2D->currentFont, INX_FontAsset::DEFAULT);
+    INX_Render2D_AddGlyph(font, INX_GetFontGlyph(font, codepoint), position, fontSize);
 }
 
 void NX_DrawCodepoints2D(const int* codepoints, int length, NX_Vec2 position, float fontSize, NX_Vec2 spacing)
@@ -1749,7 +2545,7 @@ void NX_DrawCodepoints2D(const int* codepoints, int length, NX_Vec2 position, fl
         }
         else {
             if (codepoints[i] != ' ' && codepoints[i] != '\t') {
-                NX_DrawCodepoint2D(codepoints[i], position + offset, fontSize);
+                INX_Render2D_AddGlyph(font, glyph, position + offset, fontSize);
             }
 
             if (glyph.xAdvance == 0) {
@@ -1782,7 +2578,7 @@ void NX_DrawText2D(const char* text, NX_Vec2 position, float fontSize, NX_Vec2 s
         }
         else {
             if (codepoint != ' ' && codepoint != '\t') {
-                NX_DrawCodepoint2D(codepoint, position + offset, fontSize);
+                INX_Render2D_AddGlyph(font, glyph, position + offset, fontSize);
             }
 
             if (glyph.xAdvance == 0) {
@@ -1796,3 +2592,66 @@ void NX_DrawText2D(const char* text, NX_Vec2 position, float fontSize, NX_Vec2 s
         i += codepointByteCount;
     }
 }
+
+void NX_DrawTextLayout2D(const NX_TextLayout* layout, NX_Vec2 position)
+{
+    const size_t count = layout->glyphs.GetSize();
+    if (count == 0) {
+        return;
+    }
+
+    /* --- Skip the whole layout when it is off screen --- */
+
+    // NOTE: Glyphs can overhang the measured size, the font size is used as a margin
+    NX_Vec2 margin = NX_VEC2(layout->fontSize, layout->fontSize);
+    if (!INX_Render2D_IsBoundsVisible(position - margin, position + layout->size + margin)) {
+        return;
+    }
+
+    const INX_LayoutGlyph* glyphs = layout->glyphs.GetData();
+
+    /* --- Dynamic fonts may have evicted glyphs, resolve them again --- */
+
+    if (layout->font->cache != nullptr) {
+        for (size_t i = 0; i < count; i++) {
+            const INX_LayoutGlyph& glyph = glyphs[i];
+            const INX_Glyph& data = INX_GetFontGlyph(layout->font, glyph.codepoint);
+            NX_Vec2 offset = NX_VEC2(data.xOffset, data.yOffset) * (layout->fontSize / layout->font->baseSize);
+            INX_Render2D_AddGlyph(layout->font, data, position + glyph.position - offset, layout->fontSize);
+        }
+        return;
+    }
+
+    /* --- Select a text call with the font of the layout --- */
+
+    const NX_Font* currentFont = INX_Render2D->currentFont;
+    INX_Render2D->currentFont = layout->font;
+    INX_Render2D->currentFontPage = 0;
+    INX_Render2D_EnsureQuadCall(INX_DrawMode2D::TEXT, static_cast<int>(count));
+    INX_Render2D->currentFont = currentFont;
+
+    /* --- Append the cached quads, only their placement changes --- */
+
+    const NX_Mat3* transform = INX_Render2D_GetQuadTransform();
+
+    INX_Quad2D quad;
+    INX_Render2D_SetQuadColor(&quad);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const INX_LayoutGlyph& glyph = glyphs[i];
+
+        INX_Render2D_SetQuadRect(
+            &quad, transform,
+            position.x + glyph.position.x, position.y + glyph.position.y,
+            glyph.size.x, glyph.size.y
+        );
+
+        if (!INX_Render2D_IsScreenAreaVisible(quad.origin, quad.axisX, quad.axisY, 0.0f)) {
+            continue;
+        }
+
+        SDL_memcpy(quad.texRect, glyph.texRect, sizeof(quad.texRect));
+        INX_Render2D_PushQuad(quad);
+    }
+}
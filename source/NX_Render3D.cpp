@@ -33,6 +33,7 @@
 
 #include "./Detail/GPU/StagingBuffer.hpp"
 #include "./Detail/GPU/Framebuffer.hpp"
+#include "./Detail/GPU/RingBuffer.hpp"
 #include "./Detail/GPU/SwapBuffer.hpp"
 #include "./Detail/GPU/MipBuffer.hpp"
 #include "./Detail/GPU/Pipeline.hpp"
@@ -44,10 +45,12 @@
 #include "./INX_VariantMesh.hpp"
 #include "./INX_RenderUtils.hpp"
 #include "./INX_GlobalPool.hpp"
+#include "./INX_JobSystem.hpp"
 #include "./INX_GPUBridge.hpp"
 #include "./INX_Frustum.hpp"
 #include "NX/NX_Material.h"
 
+#include <unordered_map>
 #include <numeric>
 
 // ============================================================================
@@ -122,6 +125,14 @@ struct INX_DrawUnique {
     INX_DrawType type;
 };
 
+/** Skinning palette cached per animation player (or per skeleton for bind poses) */
+struct INX_BonePalette {
+    const NX_Skeleton* skeleton;            //< Skeleton whose bone offsets were used to compute the palette
+    uint32_t poseVersion;                   //< Version of the pose the palette was computed from
+    int offset;                             //< Offset of the palette in the bone buffer (in matrices)
+    int count;                              //< Number of matrices reserved for the palette
+};
+
 /** Data for active lights */
 struct INX_ActiveLight {
     NX_Light* light;
@@ -287,8 +298,8 @@ struct INX_LightingState {
     static constexpr uint32_t MaxLightsPerCluster = 32;     ///< Maximum number of lights in a single cluster
 
     /** Storage buffers */
-    gpu::Buffer storageLights{};        ///< Active lights (sorted DIR -> SPOT -> OMNI)
-    gpu::Buffer storageShadow{};        ///< Per-light shadow data
+    gpu::RingBuffer storageLights{};    ///< Active lights (sorted DIR -> SPOT -> OMNI), streamed each pass
+    gpu::RingBuffer storageShadow{};    ///< Per-light shadow data, streamed each pass
     gpu::Buffer storageClusters{};      ///< Per-cluster light counts (numDir, numSpot, numOmni)
     gpu::Buffer storageIndices{};       ///< Per-cluster light indices (grouped by type)
     gpu::Buffer storageClusterAABB{};   ///< Per-cluster AABBs (computed during culling)
@@ -296,6 +307,8 @@ struct INX_LightingState {
     /** Per-frame caches */
     ActiveLights activeLights{};        ///< Active lights (pointers + shadow indices), same order as storageLights
     ActiveShadows activeShadows{};      ///< Active shadow-casting lights, bucketed by type, same order as storageShadow
+    gpu::RingBuffer::Range rangeLights{};   ///< Range of the current pass in storageLights
+    gpu::RingBuffer::Range rangeShadow{};   ///< Range of the current pass in storageShadow, empty without shadows
 
     /** Additionnal Data */
     NX_IVec3 clusterCount{};            ///< Number of clusters X/Y/Z
@@ -336,11 +349,20 @@ struct INX_DrawCallState {
     util::BucketArray<int, INX_DrawType, DRAW_TYPE_COUNT> sortedUnique{};
     util::DynamicArray<float> sortDistances{}; ///< Sorting cache
 
+    /** Skinning palettes, persistent across passes and frames */
+    std::unordered_map<const void*, INX_BonePalette> bonePalettes{};    ///< Keyed by animation player, or by skeleton for bind poses
+    util::DynamicArray<NX_IVec2> boneFreeRanges{};                      ///< Released palette ranges (x = offset, y = count)
+    util::DynamicArray<NX_Mat4> boneMatrices{};                         ///< CPU copy of the bone buffer
+    int boneDirtyBegin{};                                               ///< First matrix to upload
+    int boneDirtyEnd{};                                                 ///< One past the last matrix to upload
+
     /** Draw call data stored in VRAM */
     gpu::StagingBuffer<INX_GPUReflectionProbe> reflectionProbeBuffer{};
-    gpu::StagingBuffer<NX_Mat4> boneBuffer{};
-    gpu::Buffer sharedBuffer{};
-    gpu::Buffer uniqueBuffer{};
+    gpu::Buffer boneBuffer{};
+    gpu::RingBuffer sharedBuffer{};
+    gpu::RingBuffer uniqueBuffer{};
+    gpu::RingBuffer::Range sharedRange{};   ///< Range of the current pass in sharedBuffer
+    gpu::RingBuffer::Range uniqueRange{};   ///< Range of the current pass in uniqueBuffer
 
     /** Additional infos */
     uint32_t reflectionProbeCount{};
@@ -508,16 +530,14 @@ static void INX_InitLightingState(INX_LightingState* lighting, const NX_AppDesc*
 
     /* --- Create light and shadow storages --- */
 
-    lighting->storageLights = gpu::Buffer(
+    lighting->storageLights = gpu::RingBuffer(
         GL_SHADER_STORAGE_BUFFER,
-        32 * sizeof(INX_GPULight),
-        nullptr, GL_DYNAMIC_DRAW
+        128 * sizeof(INX_GPULight)
     );
 
-    lighting->storageShadow = gpu::Buffer(
+    lighting->storageShadow = gpu::RingBuffer(
         GL_SHADER_STORAGE_BUFFER,
-        32 * sizeof(INX_GPUShadow),
-        nullptr, GL_DYNAMIC_DRAW
+        32 * sizeof(INX_GPUShadow)
     );
 
     /* --- Create lihgting cluster storages --- */
@@ -695,11 +715,15 @@ static void INX_InitDrawCallState(INX_DrawCallState* drawCalls)
 {
     constexpr int drawCallReserveCount = 1024;
 
-    drawCalls->sharedBuffer = gpu::Buffer(GL_SHADER_STORAGE_BUFFER, drawCallReserveCount * sizeof(INX_GPUDrawShared));
-    drawCalls->uniqueBuffer = gpu::Buffer(GL_SHADER_STORAGE_BUFFER, drawCallReserveCount * sizeof(INX_GPUDrawUnique));
+    drawCalls->sharedBuffer = gpu::RingBuffer(GL_SHADER_STORAGE_BUFFER, drawCallReserveCount * sizeof(INX_GPUDrawShared));
+    drawCalls->uniqueBuffer = gpu::RingBuffer(GL_SHADER_STORAGE_BUFFER, drawCallReserveCount * sizeof(INX_GPUDrawUnique));
 
     drawCalls->reflectionProbeBuffer = gpu::StagingBuffer<INX_GPUReflectionProbe>(GL_SHADER_STORAGE_BUFFER, 32);
-    drawCalls->boneBuffer = gpu::StagingBuffer<NX_Mat4>(GL_SHADER_STORAGE_BUFFER, 1024);
+    drawCalls->boneBuffer = gpu::Buffer(GL_SHADER_STORAGE_BUFFER, 1024 * sizeof(NX_Mat4), nullptr, GL_DYNAMIC_DRAW);
+
+    if (!drawCalls->boneMatrices.Reserve(1024)) {
+        NX_LOG(E, "RENDER: Bone matrices array pre-allocation failed (requested: %i entries)", 1024);
+    }
 
     if (!drawCalls->sharedData.Reserve(drawCallReserveCount)) {
         NX_LOG(E, "RENDER: Shared draw call data array pre-allocation failed (requested: %i entries)", drawCallReserveCount);
@@ -831,6 +855,27 @@ const gpu::Texture& INX_Render3DState_GetPrefilterArray()
     return INX_Render3D->indirect.prefilterArray;
 }
 
+void INX_Render3DState_ReleaseBonePalette(const void* owner)
+{
+    if (INX_Render3D == nullptr) {
+        return;
+    }
+
+    INX_DrawCallState& state = INX_Render3D->drawCalls;
+
+    auto it = state.bonePalettes.find(owner);
+    if (it == state.bonePalettes.end()) {
+        return;
+    }
+
+    const INX_BonePalette& palette = it->second;
+    if (palette.offset >= 0) {
+        state.boneFreeRanges.PushBack(NX_IVEC2(palette.offset, palette.count));
+    }
+
+    state.bonePalettes.erase(it);
+}
+
 // ============================================================================
 // LOCAL FUNCTIONS
 // ============================================================================
@@ -912,18 +957,153 @@ static INX_DrawType INX_GetDrawType(const NX_Material& material)
     return INX_DrawType(type);
 }
 
+static int INX_AllocBonePalette(int count)
+{
+    INX_DrawCallState& state = INX_Render3D->drawCalls;
+
+    /* --- Reuse a released range if one is large enough --- */
+
+    for (size_t i = 0; i < state.boneFreeRanges.GetSize(); i++) {
+        NX_IVec2& range = state.boneFreeRanges[i];
+        if (range.y < count) continue;
+        int offset = range.x;
+        range.x += count;
+        range.y -= count;
+        if (range.y == 0) {
+            state.boneFreeRanges.Erase(state.boneFreeRanges.Begin() + i);
+        }
+        return offset;
+    }
+
+    /* --- Otherwise append at the end of the bone buffer --- */
+
+    int offset = static_cast<int>(state.boneMatrices.GetSize());
+    if (!state.boneMatrices.Resize(offset + count)) {
+        NX_LOG(E, "RENDER: Failed to allocate skinning palette (requested: %i matrices)", count);
+        return -1;
+    }
+
+    return offset;
+}
+
 static int INX_ComputeBoneMatrices(const NX_Model& model)
 {
+    INX_DrawCallState& state = INX_Render3D->drawCalls;
     const NX_Skeleton& skeleton = *model.skeleton;
 
+    /* --- Get the cached palette of the pose source --- */
+
+    // Palettes are owned by the animation player when there is one, otherwise by the
+    // skeleton itself (bind pose), so repeated draws of the same player, in the same
+    // pass, in other passes or in later frames, all share the same bone buffer range.
+
+    const void* owner = (model.player != nullptr)
+        ? static_cast<const void*>(model.player)
+        : static_cast<const void*>(model.skeleton);
+
+    const uint32_t poseVersion = (model.player != nullptr)
+        ? model.player->poseVersion : 0;
+
+    auto it = state.bonePalettes.try_emplace(owner, INX_BonePalette {
+        .skeleton = nullptr,
+        .poseVersion = 0,
+        .offset = -1,
+        .count = 0
+    }).first;
+
+    INX_BonePalette& palette = it->second;
+
+    if (palette.skeleton == &skeleton && palette.poseVersion == poseVersion) {
+        return palette.offset;
+    }
+
+    /* --- (Re)allocate the palette range if needed --- */
+
+    if (palette.count != skeleton.boneCount) {
+        if (palette.offset >= 0) {
+            state.boneFreeRanges.PushBack(NX_IVEC2(palette.offset, palette.count));
+        }
+        palette.offset = INX_AllocBonePalette(skeleton.boneCount);
+        palette.count = skeleton.boneCount;
+        if (palette.offset < 0) {
+            state.bonePalettes.erase(it);
+            return -1;
+        }
+    }
+
+    /* --- Compute the palette and mark its range for upload --- */
+
     const NX_Mat4* currentPose = (model.player != nullptr)
         ? model.player->currentPose : skeleton.bindPose;
 
-    int boneMatrixOffset = -1;
-    NX_Mat4* bones = INX_Render3D->drawCalls.boneBuffer.StageMap(skeleton.boneCount, &boneMatrixOffset);
-    NX_Mat4MulBatch(bones, skeleton.boneOffsets, currentPose, skeleton.boneCount);
+    NX_Mat4MulBatch(&state.boneMatrices[palette.offset], skeleton.boneOffsets, currentPose, skeleton.boneCount);
 
-    return boneMatrixOffset;
+    palette.skeleton = &skeleton;
+    palette.poseVersion = poseVersion;
+
+    const int begin = palette.offset;
+    const int end = palette.offset + palette.count;
+
+    if (state.boneDirtyBegin == state.boneDirtyEnd) {
+        state.boneDirtyBegin = begin;
+        state.boneDirtyEnd = end;
+    }
+    else {
+        state.boneDirtyBegin = std::min(state.boneDirtyBegin, begin);
+        state.boneDirtyEnd = std::max(state.boneDirtyEnd, end);
+    }
+
+    return palette.offset;
+}
+
+static void INX_UploadBoneMatrices()
+{
+    INX_DrawCallState& state = INX_Render3D->drawCalls;
+
+    if (state.boneDirtyBegin == state.boneDirtyEnd) {
+        return;
+    }
+
+    /* --- Grow the bone buffer if needed, its content is then fully re-uploaded --- */
+
+    const GLsizeiptr requiredSize = state.boneMatrices.GetSize() * sizeof(NX_Mat4);
+
+    if (requiredSize > state.boneBuffer.GetSize()) {
+        state.boneBuffer.Reserve(std::max(requiredSize, 2 * state.boneBuffer.GetSize()), false);
+        state.boneDirtyBegin = 0;
+        state.boneDirtyEnd = static_cast<int>(state.boneMatrices.GetSize());
+    }
+
+    /* --- Upload only the palettes that have changed --- */
+
+    state.boneBuffer.Upload(
+        state.boneDirtyBegin * sizeof(NX_Mat4),
+        (state.boneDirtyEnd - state.boneDirtyBegin) * sizeof(NX_Mat4),
+        &state.boneMatrices[state.boneDirtyBegin]
+    );
+
+    state.boneDirtyBegin = 0;
+    state.boneDirtyEnd = 0;
+}
+
+/** Requests the mip levels of the streamed material textures from the screen size of the bounds */
+static void INX_RequestTextureLevels(const NX_Material& material, const NX_BoundingBox3D& aabb, const NX_Transform& transform)
+{
+    const INX_ViewFrustum& frustum = INX_Render3D->scene.viewFrustum;
+    INX_BoundingSphere3D sphere(aabb, transform);
+
+    float distance = 1.0f;
+    if (frustum.proj.m23 != 0.0f) /* perspective */ {
+        distance = std::max(NX_Vec3Distance(sphere.center, frustum.position) - sphere.radius, frustum.near);
+    }
+
+    // NOTE: Projected diameter in pixels, proj.m11 is 1/tan(fovy/2) or 2/height
+    float screenSize = sphere.radius * frustum.proj.m11 * INX_Render3D->scene.targetResolution.y / distance;
+
+    INX_TextureStreaming_Request(material.albedo.texture, screenSize);
+    INX_TextureStreaming_Request(material.emission.texture, screenSize);
+    INX_TextureStreaming_Request(material.orm.texture, screenSize);
+    INX_TextureStreaming_Request(material.normal.texture, screenSize);
 }
 
 static void INX_PushDrawCall(
@@ -944,6 +1124,10 @@ static void INX_PushDrawCall(
         }
     }
 
+    if (INX_Render3D->renderPass == INX_RenderPass::RENDER_SCENE && INX_TextureStreaming_IsActive()) {
+        INX_RequestTextureLevels(material, mesh.GetAABB(), transform);
+    }
+
     INX_DrawCallState& state = INX_Render3D->drawCalls;
     int sharedIndex = state.sharedData.GetSize();
     int uniqueIndex = state.uniqueData.GetSize();
@@ -1015,6 +1199,10 @@ static void INX_PushDrawCall(
             if (!view.frustum->ContainsObb(obb)) continue;
         }
 
+        if (INX_Render3D->renderPass == INX_RenderPass::RENDER_SCENE && INX_TextureStreaming_IsActive()) {
+            INX_RequestTextureLevels(model.materials[model.meshMaterials[i]], mesh.aabb, transform);
+        }
+
         INX_DrawUnique uniqueData{
             .mesh = model.meshes[i],
             .material = model.materials[model.meshMaterials[i]],
@@ -1063,23 +1251,19 @@ static void INX_UploadDrawCalls()
     INX_DrawCallState& state = INX_Render3D->drawCalls;
 
     state.reflectionProbeBuffer.Upload();
-    state.boneBuffer.Upload();
+    INX_UploadBoneMatrices();
 
     const size_t sharedCount = state.sharedData.GetSize();
     const size_t uniqueCount = state.uniqueData.GetSize();
-    const size_t sharedBytes = sharedCount * sizeof(INX_GPUDrawShared);
-    const size_t uniqueBytes = uniqueCount * sizeof(INX_GPUDrawUnique);
-
-    state.sharedBuffer.Reserve(sharedBytes, false);
-    state.uniqueBuffer.Reserve(uniqueBytes, false);
+    INX_GPUDrawShared* sharedBuffer = state.sharedBuffer.Map<INX_GPUDrawShared>(sharedCount, &state.sharedRange);
+    INX_GPUDrawUnique* uniqueBuffer = state.uniqueBuffer.Map<INX_GPUDrawUnique>(uniqueCount, &state.uniqueRange);
 
-    INX_GPUDrawShared* sharedBuffer = state.sharedBuffer.MapRange<INX_GPUDrawShared>(
-        0, sharedBytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT
-    );
-
-    INX_GPUDrawUnique* uniqueBuffer = state.uniqueBuffer.MapRange<INX_GPUDrawUnique>(
-        0, uniqueBytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT
-    );
+    if (sharedBuffer == nullptr || uniqueBuffer == nullptr) {
+        NX_LOG(E, "RENDER: Failed to map draw call buffers");
+        state.sharedBuffer.Unmap();
+        state.uniqueBuffer.Unmap();
+        return;
+    }
 
     for (size_t i = 0; i < sharedCount; i++)
     {
@@ -1127,6 +1311,9 @@ static void INX_UploadDrawCalls()
 
 static void INX_SortDrawCalls(const NX_Vec3& viewPosition)
 {
+    // Minimum number of draw calls per job when computing the sort distances
+    static constexpr int SortGrainSize = 256;
+
     INX_DrawCallState& state = INX_Render3D->drawCalls;
     util::DynamicArray<float>& sortDistances = state.sortDistances;
 
@@ -1135,21 +1322,23 @@ static void INX_SortDrawCalls(const NX_Vec3& viewPosition)
         const size_t count = state.uniqueData.GetSize();
         sortDistances.Resize(count);
 
-        for (size_t i = 0; i < count; ++i)
-        {
-            const INX_DrawUnique& unique = state.uniqueData[i];
-            const INX_DrawShared& shared = state.sharedData[unique.sharedDataIndex];
+        INX_Jobs.ParallelFor(static_cast<int>(count), SortGrainSize, [&](int begin, int end) {
+            for (int i = begin; i < end; ++i)
+            {
+                const INX_DrawUnique& unique = state.uniqueData[i];
+                const INX_DrawShared& shared = state.sharedData[unique.sharedDataIndex];
 
-            const NX_BoundingBox3D& box = unique.mesh.GetAABB();
-            const NX_Transform& transform = shared.transform;
+                const NX_BoundingBox3D& box = unique.mesh.GetAABB();
+                const NX_Transform& transform = shared.transform;
 
-            // Distance from view position to the AABB's center
+                // Distance from view position to the AABB's center
 
-            NX_Vec3 local = (box.min + box.max) * 0.5f;
-            NX_Vec3 world = local * transform;
+                NX_Vec3 local = (box.min + box.max) * 0.5f;
+                NX_Vec3 world = local * transform;
 
-            sortDistances[i] = NX_Vec3DistanceSq(viewPosition, world);
-        }
+                sortDistances[i] = NX_Vec3DistanceSq(viewPosition, world);
+            }
+        });
 
         state.sortedUnique.Sort(DRAW_OPAQUE_LIT, [&sortDistances](int a, int b) {
             return sortDistances[a] < sortDistances[b];
@@ -1165,35 +1354,37 @@ static void INX_SortDrawCalls(const NX_Vec3& viewPosition)
         const size_t count = state.uniqueData.GetSize();
         sortDistances.Resize(count);
 
-        for (size_t i = 0; i < count; ++i)
-        {
-            const INX_DrawUnique& unique = state.uniqueData[i];
-            const INX_DrawShared& shared = state.sharedData[unique.sharedDataIndex];
-
-            const NX_BoundingBox3D& box = unique.mesh.GetAABB();
-            const NX_Transform& transform = shared.transform;
-
-            // Distance from view position to the AABB's farthest corner
-
-            const NX_Vec3 corners[8] = {
-                NX_VEC3(box.min.x, box.min.y, box.min.z) * transform,
-                NX_VEC3(box.max.x, box.min.y, box.min.z) * transform,
-                NX_VEC3(box.min.x, box.max.y, box.min.z) * transform,
-                NX_VEC3(box.max.x, box.max.y, box.min.z) * transform,
-                NX_VEC3(box.min.x, box.min.y, box.max.z) * transform,
-                NX_VEC3(box.max.x, box.min.y, box.max.z) * transform,
-                NX_VEC3(box.min.x, box.max.y, box.max.z) * transform,
-                NX_VEC3(box.max.x, box.max.y, box.max.z) * transform
-            };
-
-            float maxDistSq = NX_Vec3DistanceSq(viewPosition, corners[0]);
-            for (int i = 1; i < 8; ++i) {
-                float distSq = NX_Vec3DistanceSq(viewPosition, corners[i]);
-                if (distSq > maxDistSq) maxDistSq = distSq;
+        INX_Jobs.ParallelFor(static_cast<int>(count), SortGrainSize, [&](int begin, int end) {
+            for (int i = begin; i < end; ++i)
+            {
+                const INX_DrawUnique& unique = state.uniqueData[i];
+                const INX_DrawShared& shared = state.sharedData[unique.sharedDataIndex];
+
+                const NX_BoundingBox3D& box = unique.mesh.GetAABB();
+                const NX_Transform& transform = shared.transform;
+
+                // Distance from view position to the AABB's farthest corner
+
+                const NX_Vec3 corners[8] = {
+                    NX_VEC3(box.min.x, box.min.y, box.min.z) * transform,
+                    NX_VEC3(box.max.x, box.min.y, box.min.z) * transform,
+                    NX_VEC3(box.min.x, box.max.y, box.min.z) * transform,
+                    NX_VEC3(box.max.x, box.max.y, box.min.z) * transform,
+                    NX_VEC3(box.min.x, box.min.y, box.max.z) * transform,
+                    NX_VEC3(box.max.x, box.min.y, box.max.z) * transform,
+                    NX_VEC3(box.min.x, box.max.y, box.max.z) * transform,
+                    NX_VEC3(box.max.x, box.max.y, box.max.z) * transform
+                };
+
+                float maxDistSq = NX_Vec3DistanceSq(viewPosition, corners[0]);
+                for (int j = 1; j < 8; ++j) {
+                    float distSq = NX_Vec3DistanceSq(viewPosition, corners[j]);
+                    if (distSq > maxDistSq) maxDistSq = distSq;
+                }
+
+                sortDistances[i] = maxDistSq;
             }
-
-            sortDistances[i] = maxDistSq;
-        }
+        });
 
         state.sortedUnique.Sort(DRAW_TRANSPARENT, [&sortDistances](int a, int b) {
             return sortDistances[a] > sortDistances[b];
@@ -1478,12 +1669,15 @@ static void INX_UploadLightData()
     SDL_assert(!INX_Render3D->lighting.activeLights.IsEmpty());
     INX_LightingState& state = INX_Render3D->lighting;
 
-    state.storageLights.Reserve(INX_Pool.Get<NX_Light>().GetSize() * sizeof(INX_GPULight), false);
-    INX_GPULight* mappedLights = state.storageLights.MapRange<INX_GPULight>(
-        0, state.activeLights.GetSize() * sizeof(INX_GPULight),
-        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT
+    INX_GPULight* mappedLights = state.storageLights.Map<INX_GPULight>(
+        state.activeLights.GetSize(), &state.rangeLights
     );
 
+    if (mappedLights == nullptr) {
+        NX_LOG(E, "RENDER: Failed to map light storage");
+        return;
+    }
+
     for (int i = 0; i < state.activeLights.GetSize(); i++) {
         const INX_ActiveLight& data = state.activeLights[i];
         INX_FillGPULight(data.light, &mappedLights[i], data.shadowIndex);
@@ -1496,14 +1690,19 @@ static void INX_UploadShadowData()
 {
     SDL_assert(!INX_Render3D->lighting.activeLights.IsEmpty());
     INX_LightingState& state = INX_Render3D->lighting;
+
+    state.rangeShadow = {};
     if (state.activeShadows.IsEmpty()) return;
 
-    state.storageShadow.Reserve(state.activeShadows.GetSize() * sizeof(INX_GPUShadow), false);
-    INX_GPUShadow* mappedShadows = state.storageShadow.MapRange<INX_GPUShadow>(
-        0, state.activeShadows.GetSize() * sizeof(INX_GPUShadow),
-        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT
+    INX_GPUShadow* mappedShadows = state.storageShadow.Map<INX_GPUShadow>(
+        state.activeShadows.GetSize(), &state.rangeShadow
     );
 
+    if (mappedShadows == nullptr) {
+        NX_LOG(E, "RENDER: Failed to map shadow storage");
+        return;
+    }
+
     for (int i = 0; i < state.activeShadows.GetSize(); i++) {
         const NX_Light* light = state.activeShadows[i];
         INX_FillGPUShadow(light, &mappedShadows[i]);
@@ -1565,7 +1764,7 @@ static void INX_CullLightsPerCluster(gpu::Pipeline& pipeline)
     pipeline.UseProgram(INX_Programs.GetLightCulling());
 
     pipeline.BindUniform(0, scene.frustumUniform);
-    pipeline.BindStorage(0, state.storageLights);
+    pipeline.BindStorage(0, state.storageLights, state.rangeLights);
     pipeline.BindStorage(1, state.storageClusters);
     pipeline.BindStorage(2, state.storageIndices);
     pipeline.BindStorage(3, state.storageClusterAABB);
@@ -1629,8 +1828,8 @@ static void INX_RenderSceneOpaqueLit(const gpu::Pipeline& pipeline)
 
     /* --- Setup common pipeline state --- */
 
-    pipeline.BindStorage(0, drawCalls.sharedBuffer);
-    pipeline.BindStorage(1, drawCalls.uniqueBuffer);
+    pipeline.BindStorage(0, drawCalls.sharedBuffer, drawCalls.sharedRange);
+    pipeline.BindStorage(1, drawCalls.uniqueBuffer, drawCalls.uniqueRange);
     pipeline.BindStorage(2, drawCalls.boneBuffer);
 
     pipeline.BindUniform(0, scene.frameUniform);
@@ -1716,8 +1915,8 @@ static void INX_RenderSceneOpaqueLit(const gpu::Pipeline& pipeline)
     scene.framebuffer.SetDrawBuffers({0});
 
     pipeline.BindStorage(3, drawCalls.reflectionProbeBuffer);
-    pipeline.BindStorage(4, lighting.storageLights);
-    pipeline.BindStorage(5, lighting.storageShadow);
+    pipeline.BindStorage(4, lighting.storageLights, lighting.rangeLights);
+    pipeline.BindStorage(5, lighting.storageShadow, lighting.rangeShadow);
     pipeline.BindStorage(6, lighting.storageClusters);
     pipeline.BindStorage(7, lighting.storageIndices);
 
@@ -1773,12 +1972,12 @@ static void INX_RenderScene(const gpu::Pipeline& pipeline, Args&&... args)
     pipeline.SetDepthMode(gpu::DepthMode::TestAndWrite);
     pipeline.SetColorWrite(gpu::ColorWrite::RGBA);
 
-    pipeline.BindStorage(0, drawCalls.sharedBuffer);
-    pipeline.BindStorage(1, drawCalls.uniqueBuffer);
+    pipeline.BindStorage(0, drawCalls.sharedBuffer, drawCalls.sharedRange);
+    pipeline.BindStorage(1, drawCalls.uniqueBuffer, drawCalls.uniqueRange);
     pipeline.BindStorage(2, drawCalls.boneBuffer);
     pipeline.BindStorage(3, drawCalls.reflectionProbeBuffer);
-    pipeline.BindStorage(4, lighting.storageLights);
-    pipeline.BindStorage(5, lighting.storageShadow);
+    pipeline.BindStorage(4, lighting.storageLights, lighting.rangeLights);
+    pipeline.BindStorage(5, lighting.storageShadow, lighting.rangeShadow);
     pipeline.BindStorage(6, lighting.storageClusters);
     pipeline.BindStorage(7, lighting.storageIndices);
 
@@ -2085,8 +2284,8 @@ void NX_EndShadow3D()
     if (!drawCalls.sortedUnique.IsEmpty()) {
         INX_UploadDrawCalls();
         pipeline.BindUniform(0, shadowing.frameUniform);
-        pipeline.BindStorage(0, drawCalls.sharedBuffer);
-        pipeline.BindStorage(1, drawCalls.uniqueBuffer);
+        pipeline.BindStorage(0, drawCalls.sharedBuffer, drawCalls.sharedRange);
+        pipeline.BindStorage(1, drawCalls.uniqueBuffer, drawCalls.uniqueRange);
         pipeline.BindStorage(2, drawCalls.boneBuffer);
     }
 
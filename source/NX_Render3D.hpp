@@ -45,6 +45,7 @@ const gpu::Texture& INX_Render3DState_GetIrradianceArray();
 /** Should be called by NX_IndirectLight to prefilter cubemaps */
 const gpu::Texture& INX_Render3DState_GetPrefilterArray();
 
-/** Should be called */
+/** Should be called by NX_AnimationPlayer and NX_Skeleton to release their cached skinning palette */
+void INX_Render3DState_ReleaseBonePalette(const void* owner);
 
 #endif // NX_RENDER_3D_HPP
@@ -9,6 +9,12 @@
 #include <NX/NX_Runtime.h>
 
 #include "./INX_GlobalState.hpp"
+#include "./INX_JobSystem.hpp"
+#include "./NX_AsyncLoad.hpp"
+#include "./NX_AudioClip.hpp"
+#include "./NX_Texture.hpp"
+
+#include "./Detail/GPU/RingBuffer.hpp"
 
 #include <SDL3/SDL_events.h>
 #include <SDL3/SDL_stdinc.h>
@@ -34,6 +40,8 @@ bool NX_FrameStep(void)
         firstFrame = false;
     }
 
+    gpu::RingBuffer::NextFrame();
+
     /* --- Calculate delta time and sleep if enough time remains --- */
 
     Uint64 ticksNow = SDL_GetPerformanceCounter();
@@ -154,6 +162,13 @@ bool NX_FrameStep(void)
         }
     }
 
+    /* --- Run tasks that were deferred to the main thread --- */
+
+    INX_Jobs.RunMainTasks();
+    INX_TextureStreaming_Update();
+    INX_AudioClip_Update();
+    INX_AsyncLoad_Update();
+
     return shouldRun;
 }
 
@@ -185,6 +200,11 @@ int NX_GetFPS(void)
     return static_cast<int>(INX_Frame.fpsAverage + 0.5f);
 }
 
+int NX_GetWorkerCount(void)
+{
+    return INX_Jobs.GetWorkerCount();
+}
+
 void NX_SetTargetFPS(int fps)
 {
     INX_Frame.targetDeltaTime = 1.0 / static_cast<double>(fps);
@@ -28,6 +28,7 @@ NX_Shader2D::NX_Shader2D()
     INX_ShaderDecoder fragCode(SHAPE_FRAG, SHAPE_FRAG_SIZE);
 
     gpu::Shader vertShape(GL_VERTEX_SHADER, vertCode);
+    gpu::Shader vertShapeQuad(GL_VERTEX_SHADER, vertCode, {"INSTANCED_QUAD"});
     gpu::Shader fragShapeColor(GL_FRAGMENT_SHADER, fragCode, {"SHAPE_COLOR"});
     gpu::Shader fragShapeTexture(GL_FRAGMENT_SHADER, fragCode, {"SHAPE_TEXTURE"});
     gpu::Shader fragTextBitmap(GL_FRAGMENT_SHADER, fragCode, {"TEXT_BITMAP"});
@@ -39,6 +40,11 @@ NX_Shader2D::NX_Shader2D()
     mPrograms[Variant::SHAPE_TEXTURE] = gpu::Program(vertShape, fragShapeTexture);
     mPrograms[Variant::TEXT_BITMAP]   = gpu::Program(vertShape, fragTextBitmap);
     mPrograms[Variant::TEXT_SDF]      = gpu::Program(vertShape, fragTextSDF);
+
+    mPrograms[Variant::SHAPE_COLOR_QUAD]   = gpu::Program(vertShapeQuad, fragShapeColor);
+    mPrograms[Variant::SHAPE_TEXTURE_QUAD] = gpu::Program(vertShapeQuad, fragShapeTexture);
+    mPrograms[Variant::TEXT_BITMAP_QUAD]   = gpu::Program(vertShapeQuad, fragTextBitmap);
+    mPrograms[Variant::TEXT_SDF_QUAD]      = gpu::Program(vertShapeQuad, fragTextSDF);
 }
 
 NX_Shader2D::NX_Shader2D(const char* vert, const char* frag)
@@ -68,6 +74,7 @@ NX_Shader2D::NX_Shader2D(const char* vert, const char* frag)
     /* --- Compile shaders --- */
 
     gpu::Shader vertShape(GL_VERTEX_SHADER, vertCode.GetCString());
+    gpu::Shader vertShapeQuad(GL_VERTEX_SHADER, vertCode.GetCString(), {"INSTANCED_QUAD"});
     gpu::Shader fragShapeColor(GL_FRAGMENT_SHADER, fragCode.GetCString(), {"SHAPE_COLOR"});
     gpu::Shader fragShapeTexture(GL_FRAGMENT_SHADER, fragCode.GetCString(), {"SHAPE_TEXTURE"});
     gpu::Shader fragTextBitmap(GL_FRAGMENT_SHADER, fragCode.GetCString(), {"TEXT_BITMAP"});
@@ -80,6 +87,11 @@ NX_Shader2D::NX_Shader2D(const char* vert, const char* frag)
     mPrograms[Variant::TEXT_BITMAP]   = gpu::Program(vertShape, fragTextBitmap);
     mPrograms[Variant::TEXT_SDF]      = gpu::Program(vertShape, fragTextSDF);
 
+    mPrograms[Variant::SHAPE_COLOR_QUAD]   = gpu::Program(vertShapeQuad, fragShapeColor);
+    mPrograms[Variant::SHAPE_TEXTURE_QUAD] = gpu::Program(vertShapeQuad, fragShapeTexture);
+    mPrograms[Variant::TEXT_BITMAP_QUAD]   = gpu::Program(vertShapeQuad, fragTextBitmap);
+    mPrograms[Variant::TEXT_SDF_QUAD]      = gpu::Program(vertShapeQuad, fragTextSDF);
+
     /* --- Collect uniform block sizes and setup bindings --- */
 
     size_t bufferSize[UNIFORM_COUNT] = {};
@@ -104,10 +116,13 @@ NX_Shader2D::NX_Shader2D(const char* vert, const char* frag)
     if (bufferSize[DYNAMIC_UNIFORM] > 0) {
         int alignment = gpu::Pipeline::GetUniformBufferOffsetAlignment();
         int alignedSize = NX_ALIGN_UP(8 * bufferSize[DYNAMIC_UNIFORM], alignment);
-        mDynamicBuffer.buffer = gpu::Buffer(GL_UNIFORM_BUFFER, alignedSize, nullptr, GL_DYNAMIC_DRAW);
+        mDynamicBuffer.buffer = gpu::RingBuffer(GL_UNIFORM_BUFFER, alignedSize);
         if (!mDynamicBuffer.ranges.Reserve(8)) {
             NX_LOG(E, "RENDER: Dynamic uniform buffer range info reservation failed (requested: 8 entries)");
         }
+        if (!mDynamicBuffer.staging.Reserve(alignedSize)) {
+            NX_LOG(E, "RENDER: Dynamic uniform buffer staging reservation failed (requested: %i bytes)", alignedSize);
+        }
     }
 }
 
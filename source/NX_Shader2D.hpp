@@ -26,6 +26,10 @@ struct INX_ShaderTraits<NX_Shader2D> {
         SHAPE_TEXTURE,
         TEXT_BITMAP,
         TEXT_SDF,
+        SHAPE_COLOR_QUAD,
+        SHAPE_TEXTURE_QUAD,
+        TEXT_BITMAP_QUAD,
+        TEXT_SDF_QUAD,
         VARIANT_COUNT
     };
 };
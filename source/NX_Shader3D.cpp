@@ -120,10 +120,13 @@ NX_Shader3D::NX_Shader3D(const char* vert, const char* frag)
     if (bufferSize[DYNAMIC_UNIFORM] > 0) {
         int alignment = gpu::Pipeline::GetUniformBufferOffsetAlignment();
         int alignedSize = NX_ALIGN_UP(8 * bufferSize[DYNAMIC_UNIFORM], alignment);
-        mDynamicBuffer.buffer = gpu::Buffer(GL_UNIFORM_BUFFER, alignedSize, nullptr, GL_DYNAMIC_DRAW);
+        mDynamicBuffer.buffer = gpu::RingBuffer(GL_UNIFORM_BUFFER, alignedSize);
         if (!mDynamicBuffer.ranges.Reserve(8)) {
             NX_LOG(E, "RENDER: Dynamic uniform buffer range info reservation failed (requested: 8 entries)");
         }
+        if (!mDynamicBuffer.staging.Reserve(alignedSize)) {
+            NX_LOG(E, "RENDER: Dynamic uniform buffer staging reservation failed (requested: %i bytes)", alignedSize);
+        }
     }
 }
 
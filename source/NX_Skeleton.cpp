@@ -12,6 +12,8 @@
 #include <NX/NX_Memory.h>
 
 #include "./Importer/SkeletonImporter.hpp"
+#include "./Importer/ModelCache.hpp"
+#include "./NX_Render3D.hpp"
 
 // ============================================================================
 // PUBLIC API
@@ -33,6 +35,10 @@ NX_Skeleton* NX_LoadSkeleton(const char* filePath)
 
 NX_Skeleton* NX_LoadSkeletonFromData(const void* data, unsigned int size, const char* hint)
 {
+    if (import::ModelCacheReader::IsCache(data, size)) {
+        return import::ModelCacheReader(data, size).LoadSkeleton();
+    }
+
     import::SceneImporter importer(data, size, hint);
     if (!importer.IsValid()) {
         return nullptr;
@@ -47,6 +53,8 @@ void NX_DestroySkeleton(NX_Skeleton* skeleton)
         return;
     }
 
+    INX_Render3DState_ReleaseBonePalette(skeleton);
+
     NX_Free(skeleton->boneOffsets);
     NX_Free(skeleton->bindLocal);
     NX_Free(skeleton->bindPose);
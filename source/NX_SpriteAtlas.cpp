@@ -0,0 +1,302 @@
+/* NX_SpriteAtlas.cpp -- API definition for Nexium's sprite atlas module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./NX_SpriteAtlas.hpp"
+
+#include <NX/NX_Log.h>
+
+#include "./Detail/Util/Memory.hpp"
+#include "./Detail/Util/Ranges.hpp"
+#include "./INX_GlobalPool.hpp"
+#include "./INX_GPUBridge.hpp"
+#include "./NX_Texture.hpp"
+
+// ============================================================================
+// OPAQUE DEFINITION
+// ============================================================================
+
+NX_SpriteAtlas::~NX_SpriteAtlas()
+{
+    for (INX_SpritePage& page : pages) {
+        NX_DestroyTexture(page.texture);
+    }
+}
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+static int INX_AllocateSprite(NX_SpriteAtlas* atlas, int w, int h, INX_RectPacker::Rect* rect)
+{
+    const int paddedW = w + 2 * atlas->padding;
+    const int paddedH = h + 2 * atlas->padding;
+
+    if (paddedW > atlas->pageSize || paddedH > atlas->pageSize) {
+        NX_LOG(E, "RENDER: Sprite of %ix%i does not fit in atlas pages of %ix%i",
+            w, h, atlas->pageSize, atlas->pageSize);
+        return -1;
+    }
+
+    /* --- Try the existing pages first --- */
+
+    for (size_t i = 0; i < atlas->pages.GetSize(); i++) {
+        if (atlas->pages[i].packer.Insert(paddedW, paddedH, rect)) {
+            return static_cast<int>(i);
+        }
+    }
+
+    /* --- Otherwise start a new page --- */
+
+    // NOTE: Pages never have mipmaps, they would have to be regenerated on each insertion
+    NX_TextureFilter filter = atlas->filter;
+    if (filter == NX_TEXTURE_FILTER_TRILINEAR) {
+        filter = NX_TEXTURE_FILTER_BILINEAR;
+    }
+
+    NX_Texture* texture = NX_CreateTextureEx(
+        atlas->pageSize, atlas->pageSize, nullptr,
+        NX_PIXEL_FORMAT_RGBA8, NX_TEXTURE_WRAP_CLAMP, filter
+    );
+
+    if (texture == nullptr) {
+        NX_LOG(E, "RENDER: Failed to create sprite atlas page");
+        return -1;
+    }
+
+    INX_SpritePage* page = atlas->pages.EmplaceBack();
+    if (page == nullptr) {
+        NX_LOG(E, "RENDER: Failed to register sprite atlas page");
+        NX_DestroyTexture(texture);
+        return -1;
+    }
+
+    page->texture = texture;
+    page->packer.Reset(atlas->pageSize, atlas->pageSize);
+    page->packer.Insert(paddedW, paddedH, rect);
+
+    return static_cast<int>(atlas->pages.GetSize() - 1);
+}
+
+static int INX_RegisterSprite(NX_SpriteAtlas* atlas, int page, const INX_RectPacker::Rect& rect, int w, int h)
+{
+    int handle = 0;
+
+    if (!atlas->freeSprites.IsEmpty()) {
+        handle = *atlas->freeSprites.GetBack();
+        atlas->freeSprites.PopBack();
+    }
+    else if (atlas->sprites.EmplaceBack() != nullptr) {
+        handle = static_cast<int>(atlas->sprites.GetSize()) - 1;
+    }
+    else {
+        NX_LOG(E, "RENDER: Failed to register sprite; Out of memory");
+        atlas->pages[page].packer.Free(rect);
+        return -1;
+    }
+
+    atlas->sprites[handle] = INX_Sprite{rect, page};
+    atlas->pages[page].spriteCount++;
+    atlas->spriteCount++;
+    atlas->spriteArea += static_cast<int64_t>(w) * h;
+
+    return handle;
+}
+
+static const INX_Sprite* INX_GetSprite(const NX_SpriteAtlas* atlas, int sprite)
+{
+    if (sprite < 0 || sprite >= static_cast<int>(atlas->sprites.GetSize())) {
+        return nullptr;
+    }
+
+    const INX_Sprite& entry = atlas->sprites[sprite];
+    return (entry.page >= 0) ? &entry : nullptr;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+NX_SpriteAtlas* NX_CreateSpriteAtlas(int pageSize, int padding, NX_TextureFilter filter)
+{
+    if (pageSize <= 0 || padding < 0 || 2 * padding >= pageSize) {
+        NX_LOG(E, "RENDER: Failed to create sprite atlas; Invalid page size (%i) or padding (%i)", pageSize, padding);
+        return nullptr;
+    }
+
+    NX_SpriteAtlas* atlas = INX_Pool.Create<NX_SpriteAtlas>();
+    if (atlas == nullptr) {
+        NX_LOG(E, "RENDER: Failed to create sprite atlas; Object pool issue");
+        return nullptr;
+    }
+
+    atlas->filter = filter;
+    atlas->pageSize = pageSize;
+    atlas->padding = padding;
+
+    return atlas;
+}
+
+void NX_DestroySpriteAtlas(NX_SpriteAtlas* atlas)
+{
+    INX_Pool.Destroy(atlas);
+}
+
+int NX_AddSpriteFromImage(NX_SpriteAtlas* atlas, const NX_Image* image)
+{
+    if (image == nullptr || image->pixels == nullptr || image->w <= 0 || image->h <= 0) {
+        NX_LOG(E, "RENDER: Failed to add sprite; Invalid image");
+        return -1;
+    }
+
+    if (NX_IsPixelFormatCompressed(image->format)) {
+        NX_LOG(E, "RENDER: Failed to add sprite; Compressed images are not supported");
+        return -1;
+    }
+
+    INX_RectPacker::Rect rect{};
+    int page = INX_AllocateSprite(atlas, image->w, image->h, &rect);
+    if (page < 0) {
+        return -1;
+    }
+
+    /* --- Convert the image to the page format --- */
+
+    NX_Image source = *image;
+    if (source.format != NX_PIXEL_FORMAT_RGBA8) {
+        source = NX_CopyImage(image, NX_PIXEL_FORMAT_RGBA8);
+    }
+
+    /* --- Copy the pixels, extending the edges over the padding --- */
+
+    util::UniquePtr<uint32_t> pixels = util::MakeUniqueArray<uint32_t>(rect.w * rect.h);
+    const uint32_t* src = static_cast<const uint32_t*>(source.pixels);
+    const int p = atlas->padding;
+
+    for (int y = 0; y < rect.h; y++) {
+        int sy = NX_CLAMP(y - p, 0, source.h - 1);
+        for (int x = 0; x < rect.w; x++) {
+            int sx = NX_CLAMP(x - p, 0, source.w - 1);
+            pixels.get()[y * rect.w + x] = src[sy * source.w + sx];
+        }
+    }
+
+    atlas->pages[page].texture->gpu.Upload(pixels.get(), gpu::UploadRegion {
+        .x = rect.x, .y = rect.y,
+        .width = rect.w, .height = rect.h
+    });
+
+    if (source.pixels != image->pixels) {
+        NX_DestroyImage(&source);
+    }
+
+    return INX_RegisterSprite(atlas, page, rect, image->w, image->h);
+}
+
+int NX_AddSpriteFromTexture(NX_SpriteAtlas* atlas, const NX_Texture* texture)
+{
+    if (texture == nullptr || texture->stream != nullptr) {
+        NX_LOG(E, "RENDER: Failed to add sprite; Invalid or streamed texture");
+        return -1;
+    }
+
+    GLenum internalFormat = texture->gpu.GetInternalFormat();
+    NX_PixelFormat format = INX_GPU_GetPixelFormat(internalFormat);
+
+    bool compatible = (internalFormat == GL_SRGB8_ALPHA8) || (
+        format != NX_PIXEL_FORMAT_INVALID && !NX_IsPixelFormatCompressed(format) &&
+        NX_GetPixelBytes(format) == 4
+    );
+
+    if (!compatible) {
+        NX_LOG(E, "RENDER: Failed to add sprite; Texture format is not compatible with RGBA8");
+        return -1;
+    }
+
+    NX_IVec2 size = texture->gpu.GetDimensions();
+
+    INX_RectPacker::Rect rect{};
+    int page = INX_AllocateSprite(atlas, size.x, size.y, &rect);
+    if (page < 0) {
+        return -1;
+    }
+
+    gpu::Texture& target = atlas->pages[page].texture->gpu;
+    const int p = atlas->padding;
+
+    /* --- Clear the padding, the area may hold an evicted sprite --- */
+
+    if (p > 0) {
+        util::UniquePtr<uint32_t> zeros = util::MakeUniqueArray<uint32_t>(rect.w * rect.h);
+        target.Upload(zeros.get(), gpu::UploadRegion {
+            .x = rect.x, .y = rect.y,
+            .width = rect.w, .height = rect.h
+        });
+    }
+
+    /* --- Copy the texture on the GPU --- */
+
+    target.CopyRegion(texture->gpu, 0, 0, rect.x + p, rect.y + p, size.x, size.y);
+
+    return INX_RegisterSprite(atlas, page, rect, size.x, size.y);
+}
+
+void NX_RemoveSprite(NX_SpriteAtlas* atlas, int sprite)
+{
+    const INX_Sprite* entry = INX_GetSprite(atlas, sprite);
+    if (entry == nullptr) {
+        NX_LOG(W, "RENDER: Cannot remove sprite %i; Invalid handle", sprite);
+        return;
+    }
+
+    const INX_RectPacker::Rect rect = entry->rect;
+    INX_SpritePage& page = atlas->pages[entry->page];
+
+    page.packer.Free(rect);
+    page.spriteCount--;
+
+    const int p = atlas->padding;
+    atlas->spriteArea -= static_cast<int64_t>(rect.w - 2 * p) * (rect.h - 2 * p);
+    atlas->spriteCount--;
+
+    atlas->sprites[sprite].page = -1;
+    atlas->freeSprites.PushBack(sprite);
+}
+
+bool NX_GetSpriteRegion(const NX_SpriteAtlas* atlas, int sprite, NX_SpriteRegion* region)
+{
+    const INX_Sprite* entry = INX_GetSprite(atlas, sprite);
+    if (entry == nullptr) {
+        return false;
+    }
+
+    const float invSize = 1.0f / atlas->pageSize;
+    const int p = atlas->padding;
+
+    region->texture = atlas->pages[entry->page].texture;
+    region->w = entry->rect.w - 2 * p;
+    region->h = entry->rect.h - 2 * p;
+    region->uvMin = NX_VEC2((entry->rect.x + p) * invSize, (entry->rect.y + p) * invSize);
+    region->uvMax = NX_VEC2((entry->rect.x + p + region->w) * invSize, (entry->rect.y + p + region->h) * invSize);
+
+    return true;
+}
+
+NX_SpriteAtlasStats NX_GetSpriteAtlasStats(const NX_SpriteAtlas* atlas)
+{
+    NX_SpriteAtlasStats stats{};
+
+    stats.pageCount = static_cast<int>(atlas->pages.GetSize());
+    stats.spriteCount = atlas->spriteCount;
+
+    if (stats.pageCount > 0) {
+        double pageArea = static_cast<double>(atlas->pageSize) * atlas->pageSize;
+        stats.occupancy = static_cast<float>(atlas->spriteArea / (stats.pageCount * pageArea));
+    }
+
+    return stats;
+}
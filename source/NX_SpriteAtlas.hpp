@@ -0,0 +1,45 @@
+/* NX_SpriteAtlas.hpp -- API definition for Nexium's sprite atlas module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_SPRITE_ATLAS_HPP
+#define NX_SPRITE_ATLAS_HPP
+
+#include <NX/NX_SpriteAtlas.h>
+
+#include "./Detail/Util/DynamicArray.hpp"
+#include "./INX_RectPacker.hpp"
+
+// ============================================================================
+// OPAQUE DEFINITION
+// ============================================================================
+
+struct INX_SpritePage {
+    NX_Texture* texture{};          //< RGBA8 page texture, owned by the atlas
+    INX_RectPacker packer{};
+    int spriteCount{};
+};
+
+struct INX_Sprite {
+    INX_RectPacker::Rect rect{};    //< Allocated rectangle in the page, padding included
+    int page{-1};                   //< Index of the page, -1 if the handle is free
+};
+
+struct NX_SpriteAtlas {
+    util::DynamicArray<INX_SpritePage> pages{};
+    util::DynamicArray<INX_Sprite> sprites{};
+    util::DynamicArray<int> freeSprites{};  //< Handles of removed sprites, reused first
+    NX_TextureFilter filter{};
+    int pageSize{};
+    int padding{};
+    int spriteCount{};
+    int64_t spriteArea{};                   //< Sum of the sprite areas, padding excluded
+
+    ~NX_SpriteAtlas();
+};
+
+#endif // NX_SPRITE_ATLAS_HPP
@@ -0,0 +1,191 @@
+/* NX_TextLayout.cpp -- API definition for Nexium's text layout module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include "./NX_TextLayout.hpp"
+
+#include <NX/NX_Codepoint.h>
+#include <NX/NX_Log.h>
+
+#include "./INX_GlobalAssets.hpp"
+#include "./INX_GlobalPool.hpp"
+#include "./NX_Font.hpp"
+
+#include <algorithm>
+
+// ============================================================================
+// INTERNAL FUNCTIONS
+// ============================================================================
+
+static uint16_t INX_TextLayout_ToUnorm16(float v)
+{
+    return static_cast<uint16_t>(NX_CLAMP(v, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+static void INX_TextLayout_Build(NX_TextLayout* layout, const char* text)
+{
+    const NX_Font* font = layout->font;
+    const float scale = layout->fontSize / font->baseSize;
+    const float lineStep = layout->fontSize + layout->spacing.y;
+    const float wrapWidth = layout->wrapWidth;
+
+    util::DynamicArray<INX_LayoutGlyph>& glyphs = layout->glyphs;
+    glyphs.Clear();
+
+    /* --- Pen state --- */
+
+    float penX = 0.0f;          //< Start of the next character
+    float lineY = 0.0f;
+    float lineRight = 0.0f;     //< End of the last visible character of the line
+    float maxWidth = 0.0f;
+    int lineCount = 1;
+
+    // NOTE: The last space or tab of the line where it can be broken,
+    //       the glyphs following it are moved when the line overflows
+    size_t breakGlyph = 0;
+    float breakX = 0.0f;
+    float breakRight = 0.0f;
+    bool hasBreak = false;
+
+    /* --- Shape the text --- */
+
+    const size_t length = SDL_strlen(text);
+
+    for (size_t i = 0; i < length;)
+    {
+        int codepointByteCount = 0;
+        int codepoint = NX_GetCodepointNext(&text[i], &codepointByteCount);
+        i += codepointByteCount;
+
+        if (codepoint == '\n') {
+            maxWidth = std::max(maxWidth, lineRight);
+            penX = lineRight = 0.0f;
+            lineY += lineStep;
+            hasBreak = false;
+            lineCount++;
+            continue;
+        }
+
+        const INX_Glyph& glyph = INX_GetFontGlyph(font, codepoint);
+        const float advance = ((glyph.xAdvance == 0) ? glyph.wGlyph : glyph.xAdvance) * scale;
+
+        if (codepoint == ' ' || codepoint == '\t') {
+            penX += advance + layout->spacing.x;
+            breakGlyph = glyphs.GetSize();
+            breakRight = lineRight;
+            breakX = penX;
+            hasBreak = true;
+            continue;
+        }
+
+        /* --- Wrap the line if this character overflows it --- */
+
+        if (wrapWidth > 0.0f && penX > 0.0f && penX + advance > wrapWidth)
+        {
+            if (hasBreak) {
+                maxWidth = std::max(maxWidth, breakRight);
+                for (size_t j = breakGlyph; j < glyphs.GetSize(); j++) {
+                    glyphs[j].position.x -= breakX;
+                    glyphs[j].position.y += lineStep;
+                }
+                penX -= breakX;
+                lineRight = std::max(lineRight - breakX, 0.0f);
+            }
+            else {
+                maxWidth = std::max(maxWidth, lineRight);
+                penX = lineRight = 0.0f;
+            }
+            lineY += lineStep;
+            hasBreak = false;
+            lineCount++;
+        }
+
+        /* --- Append the glyph quad --- */
+
+        if (glyph.wGlyph > 0 && glyph.hGlyph > 0)
+        {
+            const NX_Texture* texture = INX_GetFontTexture(font, glyph.page);
+            const float iwAtlas = 1.0f / texture->gpu.GetWidth();
+            const float ihAtlas = 1.0f / texture->gpu.GetHeight();
+
+            float u0 = glyph.xAtlas * iwAtlas;
+            float v0 = glyph.yAtlas * ihAtlas;
+            float u1 = u0 + glyph.wGlyph * iwAtlas;
+            float v1 = v0 + glyph.hGlyph * ihAtlas;
+
+            (void)glyphs.PushBack(INX_LayoutGlyph {
+                .position = NX_VEC2(penX + glyph.xOffset * scale, lineY + glyph.yOffset * scale),
+                .size = NX_VEC2(glyph.wGlyph * scale, glyph.hGlyph * scale),
+                .texRect = {
+                    INX_TextLayout_ToUnorm16(u0), INX_TextLayout_ToUnorm16(v0),
+                    INX_TextLayout_ToUnorm16(u1), INX_TextLayout_ToUnorm16(v1)
+                },
+                .codepoint = codepoint
+            });
+        }
+
+        lineRight = penX + advance;
+        penX += advance + layout->spacing.x;
+    }
+
+    maxWidth = std::max(maxWidth, lineRight);
+
+    layout->size = NX_VEC2(maxWidth, lineCount * layout->fontSize + (lineCount - 1) * layout->spacing.y);
+    layout->lineCount = lineCount;
+}
+
+// ============================================================================
+// PUBLIC API
+// ============================================================================
+
+NX_TextLayout* NX_CreateTextLayout(const NX_Font* font, const char* text, float fontSize, NX_Vec2 spacing, float wrapWidth)
+{
+    if (text == nullptr || fontSize <= 0.0f) {
+        NX_LOG(E, "RENDER: Failed to create text layout; Invalid text or font size (%f)", fontSize);
+        return nullptr;
+    }
+
+    NX_TextLayout* layout = INX_Pool.Create<NX_TextLayout>();
+    if (layout == nullptr) {
+        NX_LOG(E, "RENDER: Failed to create text layout; Object pool issue");
+        return nullptr;
+    }
+
+    layout->font = INX_Assets.Select(font, INX_FontAsset::DEFAULT);
+    layout->fontSize = fontSize;
+    layout->spacing = spacing;
+    layout->wrapWidth = wrapWidth;
+
+    INX_TextLayout_Build(layout, text);
+
+    return layout;
+}
+
+void NX_DestroyTextLayout(NX_TextLayout* layout)
+{
+    INX_Pool.Destroy(layout);
+}
+
+void NX_SetTextLayoutText(NX_TextLayout* layout, const char* text)
+{
+    if (text == nullptr) {
+        NX_LOG(W, "RENDER: Cannot set the text of a layout; Text is NULL");
+        return;
+    }
+
+    INX_TextLayout_Build(layout, text);
+}
+
+NX_Vec2 NX_GetTextLayoutSize(const NX_TextLayout* layout)
+{
+    return layout->size;
+}
+
+int NX_GetTextLayoutLineCount(const NX_TextLayout* layout)
+{
+    return layout->lineCount;
+}
@@ -0,0 +1,37 @@
+/* NX_TextLayout.hpp -- API definition for Nexium's text layout module
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#ifndef NX_TEXT_LAYOUT_HPP
+#define NX_TEXT_LAYOUT_HPP
+
+#include <NX/NX_TextLayout.h>
+
+#include "./Detail/Util/DynamicArray.hpp"
+
+// ============================================================================
+// OPAQUE DEFINITION
+// ============================================================================
+
+struct INX_LayoutGlyph {
+    NX_Vec2 position;               //< Top-left corner relative to the layout origin
+    NX_Vec2 size;                   //< Size of the glyph quad in pixels
+    uint16_t texRect[4];            //< Normalized min and max texture coordinates, unused with dynamic fonts
+    int codepoint;                  //< Looked up again when drawn with a dynamic font
+};
+
+struct NX_TextLayout {
+    util::DynamicArray<INX_LayoutGlyph> glyphs{};
+    const NX_Font* font{};          //< Font the glyphs were resolved with, never NULL
+    float fontSize{};
+    NX_Vec2 spacing{};
+    float wrapWidth{};
+    NX_Vec2 size{};
+    int lineCount{};
+};
+
+#endif // NX_TEXT_LAYOUT_HPP
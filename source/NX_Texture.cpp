@@ -7,11 +7,26 @@
  */
 
 #include "./NX_Texture.hpp"
+#include <NX/NX_Filesystem.h>
+#include <NX/NX_Memory.h>
 #include <NX/NX_Log.h>
 
+#include "./Detail/GPU/UnpackBufferPool.hpp"
 #include "./Detail/GPU/Texture.hpp"
+#include "./Detail/Util/Ranges.hpp"
 #include "./INX_GlobalPool.hpp"
 #include "./INX_GPUBridge.hpp"
+#include "./INX_ImageContainer.hpp"
+#include "./INX_ImageMipmaps.hpp"
+#include "./NX_AsyncLoad.hpp"
+
+#include <unordered_map>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <utility>
+#include <memory>
+#include <string>
 
 // ============================================================================
 // LOCAL MANAGEMENT
@@ -21,6 +36,17 @@ static NX_TextureFilter INX_DefaultFilter = NX_TEXTURE_FILTER_BILINEAR;
 static NX_TextureWrap INX_DefaultWrap = NX_TEXTURE_WRAP_CLAMP;
 static float INX_DefaultAnisotropy = 1.0f;
 
+static std::unordered_map<uint64_t, NX_Texture*> INX_TextureCache;
+static NX_TextureCacheStats INX_TextureCacheStats{};
+
+static gpu::UnpackBufferPool INX_UnpackBuffers;
+
+static util::DynamicArray<NX_Texture*> INX_StreamedTextures;
+static util::DynamicArray<NX_Texture*> INX_StreamingOrder;     //< Scratch array sorted by last use
+static NX_TextureStreamingStats INX_StreamingStats{};
+static size_t INX_StreamingBudget = 0;
+static uint64_t INX_StreamingFrame = 0;
+
 // ============================================================================
 // INTERNAL FUNCTIONS
 // ============================================================================
@@ -67,6 +93,621 @@ static GLenum INX_GetWrap(NX_TextureWrap wrap)
     return glWrap;
 }
 
+/** Creates a texture matching the image, 'data' can be null to only allocate its storage */
+static NX_Texture* INX_CreateImageTexture(const NX_Image* image, const void* data, NX_TextureWrap wrap, NX_TextureFilter filter, int levelCount = 1)
+{
+    const bool compressed = NX_IsPixelFormatCompressed(image->format);
+
+    if (compressed && !NX_IsTextureFormatSupported(image->format)) {
+        NX_LOG(E, "RENDER: Failed to create texture; Block compressed format not supported by the device");
+        return nullptr;
+    }
+
+    // NOTE: Compressed textures cannot generate their mipmaps, they must be provided
+    bool genMipmap = (filter == NX_TEXTURE_FILTER_TRILINEAR) && (levelCount > 1 || !compressed);
+    std::pair<GLenum, GLenum> glFilter = INX_GetFilter(filter, genMipmap);
+    GLenum glWrap = INX_GetWrap(wrap);
+
+    gpu::Texture texture(
+        gpu::TextureConfig
+        {
+            .target = GL_TEXTURE_2D,
+            .internalFormat = INX_GPU_GetInternalFormat(image->format, false),
+            .data = data,
+            .width = image->w,
+            .height = image->h,
+            .depth = 0,
+            .mipmap = genMipmap
+        },
+        gpu::TextureParam
+        {
+            .minFilter = glFilter.first,
+            .magFilter = glFilter.second,
+            .sWrap = glWrap,
+            .tWrap = glWrap,
+            .rWrap = glWrap,
+            .anisotropy = INX_DefaultAnisotropy
+        }
+    );
+
+    return INX_Pool.Create<NX_Texture>(std::move(texture));
+}
+
+/** Completes the mip chain of a texture whose first 'levelCount' levels were uploaded */
+static void INX_FinalizeMipmaps(NX_Texture* texture, int levelCount)
+{
+    gpu::Texture& gpu = texture->gpu;
+
+    if (!gpu.HasMipmap()) {
+        return;
+    }
+
+    if (levelCount == 1) {
+        gpu.GenerateMipmap();
+    }
+    else if (levelCount < gpu.GetNumLevels()) {
+        gpu.SetMipLevelRange(0, levelCount - 1);
+    }
+}
+
+/** Returns the number of leading levels that form a valid mip chain with the base image */
+static int INX_GetValidLevelCount(const NX_Image* levels, int levelCount)
+{
+    const NX_Image& base = levels[0];
+
+    for (int i = 1; i < levelCount; i++) {
+        const NX_Image& level = levels[i];
+        if (level.pixels == nullptr || level.format != base.format ||
+            level.w != std::max(base.w >> i, 1) || level.h != std::max(base.h >> i, 1)) {
+            NX_LOG(W, "RENDER: Mip level %i does not match the base image, it will be ignored", i);
+            return i;
+        }
+    }
+
+    return levelCount;
+}
+
+/** Creates a texture and uploads all of its levels at once, the missing ones are generated if needed */
+static NX_Texture* INX_CreateLevelsTexture(const NX_Image* levels, int levelCount, NX_TextureWrap wrap, NX_TextureFilter filter)
+{
+    levelCount = INX_GetValidLevelCount(levels, levelCount);
+
+    NX_Texture* texture = INX_CreateImageTexture(&levels[0], nullptr, wrap, filter, levelCount);
+    if (texture == nullptr) {
+        return nullptr;
+    }
+
+    // NOTE: Levels beyond the allocated chain are dropped when mipmaps are disabled
+    const int uploadCount = std::min(levelCount, texture->gpu.GetNumLevels());
+
+    for (int i = 0; i < uploadCount; i++) {
+        gpu::UploadRegion region{};
+        region.width = levels[i].w;
+        region.height = levels[i].h;
+        region.level = i;
+        texture->gpu.Upload(levels[i].pixels, region);
+    }
+
+    INX_FinalizeMipmaps(texture, uploadCount);
+
+    return texture;
+}
+
+/** Loads all the levels of an image file, a single one unless the file is a DDS or KTX2 container */
+static bool INX_LoadTextureLevels(const char* filePath, util::DynamicArray<NX_Image>* levels)
+{
+    size_t fileSize = 0;
+    void* fileData = NX_LoadFile(filePath, &fileSize);
+    if (fileData == nullptr) {
+        NX_LOG(E, "RENDER: Failed to load texture file: %s", filePath);
+        return false;
+    }
+
+    if (INX_IsImageContainer(fileData, fileSize)) {
+        INX_LoadImageContainer(fileData, fileSize, levels);
+    }
+    else if (NX_Image image = NX_LoadImageFromData(fileData, fileSize); image.pixels != nullptr) {
+        levels->PushBack(image);
+    }
+
+    NX_Free(fileData);
+
+    if (levels->IsEmpty()) {
+        NX_LOG(E, "RENDER: Failed to load texture: %s", filePath);
+        return false;
+    }
+
+    return true;
+}
+
+// ============================================================================
+// SHARED TEXTURE CACHE
+// ============================================================================
+
+NX_Texture* INX_TextureCache_Acquire(uint64_t key)
+{
+    auto it = INX_TextureCache.find(key);
+    if (it == INX_TextureCache.end()) {
+        return nullptr;
+    }
+
+    INX_TextureCacheStats.hits++;
+
+    return NX_RetainTexture(it->second);
+}
+
+void INX_TextureCache_Insert(uint64_t key, NX_Texture* texture)
+{
+    SDL_assert(key != 0 && texture->cacheKey == 0);
+
+    INX_TextureCacheStats.misses++;
+
+    if (INX_TextureCache.try_emplace(key, texture).second) {
+        texture->cacheKey = key;
+    }
+}
+
+void INX_TextureCache_Clear()
+{
+    INX_TextureCache.clear();
+}
+
+// ============================================================================
+// STAGED TEXTURE UPLOAD
+// ============================================================================
+
+INX_TextureUpload::INX_TextureUpload(const NX_Image* levels, int levelCount, NX_TextureWrap wrap, NX_TextureFilter filter)
+    : mLevels(levels), mLevelCount(levelCount), mWrap(wrap), mFilter(filter)
+{
+    SDL_assert(levels != nullptr && levelCount > 0);
+}
+
+INX_TextureUpload::~INX_TextureUpload()
+{
+    if (!mCopyCounter.IsDone()) {
+        INX_Jobs.Wait(mCopyCounter);
+    }
+
+    if (mSlot >= 0) {
+        INX_UnpackBuffers.Release(mSlot);
+    }
+
+    NX_DestroyTexture(mTexture);
+}
+
+NX_AsyncStatus INX_TextureUpload::Step(size_t* bytes)
+{
+    *bytes = 0;
+
+    switch (mStage) {
+    case Stage::Create:
+        if (!Create()) {
+            NX_DestroyTexture(mTexture);
+            mTexture = nullptr;
+            mStage = Stage::Done;
+            return NX_ASYNC_FAILED;
+        }
+        return NX_ASYNC_PENDING;
+
+    case Stage::Stage:
+        if (!mCopyCounter.IsDone()) {
+            return NX_ASYNC_PENDING;
+        }
+        mStage = Stage::Transfer;
+        [[fallthrough]];
+
+    case Stage::Transfer:
+        {
+            const NX_Image& level = mLevels[mLevel];
+            Transfer(mLevel++);
+            *bytes = NX_GetImageDataSize(level.w, level.h, level.format);
+        }
+        if (mLevel < mLevelCount) {
+            return NX_ASYNC_PENDING;
+        }
+        break;
+
+    case Stage::Done:
+        return (mTexture != nullptr) ? NX_ASYNC_READY : NX_ASYNC_FAILED;
+    }
+
+    /* --- Complete the mip chain and hand the staging slot back --- */
+
+    INX_FinalizeMipmaps(mTexture, mLevelCount);
+
+    if (mSlot >= 0) {
+        INX_UnpackBuffers.Release(mSlot);
+        mSlot = -1;
+    }
+
+    mStage = Stage::Done;
+
+    return NX_ASYNC_READY;
+}
+
+NX_Texture* INX_TextureUpload::Take()
+{
+    if (mStage != Stage::Done) {
+        return nullptr;
+    }
+    return std::exchange(mTexture, nullptr);
+}
+
+bool INX_TextureUpload::Create()
+{
+    const NX_Image& base = mLevels[0];
+
+    if (base.pixels == nullptr || base.w <= 0 || base.h <= 0) {
+        NX_LOG(E, "RENDER: Failed to upload texture; Image is invalid");
+        return false;
+    }
+
+    mLevelCount = INX_GetValidLevelCount(mLevels, mLevelCount);
+
+    mTexture = INX_CreateImageTexture(&base, nullptr, mWrap, mFilter, mLevelCount);
+    if (mTexture == nullptr || !mTexture->gpu.IsValid()) {
+        NX_LOG(E, "RENDER: Failed to upload texture; Texture creation failed");
+        return false;
+    }
+
+    /* --- Keep the levels that match the allocated mip chain --- */
+
+    mLevelCount = std::min(mLevelCount, mTexture->gpu.GetNumLevels());
+
+    /* --- Layout the levels in a staging slot --- */
+
+    // NOTE: Offsets are kept aligned for the drivers that copy from the buffer with wide loads
+    constexpr size_t offsetAlignment = 16;
+
+    size_t totalSize = 0;
+    if (!mOffsets.Resize(mLevelCount)) {
+        mStage = Stage::Transfer;
+        return true;
+    }
+
+    for (int i = 0; i < mLevelCount; i++) {
+        const NX_Image& level = mLevels[i];
+        mOffsets[i] = totalSize;
+        totalSize += NX_GetImageDataSize(level.w, level.h, level.format);
+        totalSize = (totalSize + offsetAlignment - 1) & ~(offsetAlignment - 1);
+    }
+
+    // NOTE: If no slot is available the levels are transferred directly from
+    //       client memory, waiting here could stall NX_WaitAsyncLoad forever
+    mSlot = INX_UnpackBuffers.Acquire(static_cast<GLsizeiptr>(totalSize));
+    if (mSlot < 0) {
+        mStage = Stage::Transfer;
+        return true;
+    }
+
+    /* --- Copy the pixels into the slot from a worker --- */
+
+    auto copy = [this, dst = INX_UnpackBuffers.GetPointer(mSlot)]() {
+        for (int i = 0; i < mLevelCount; i++) {
+            const NX_Image& level = mLevels[i];
+            size_t size = NX_GetImageDataSize(level.w, level.h, level.format);
+            std::memcpy(dst + mOffsets[i], level.pixels, size);
+        }
+    };
+
+    if (INX_Jobs.GetWorkerCount() > 0) {
+        INX_Jobs.Submit(std::move(copy), &mCopyCounter);
+        mStage = Stage::Stage;
+    }
+    else {
+        copy();
+        mStage = Stage::Transfer;
+    }
+
+    return true;
+}
+
+void INX_TextureUpload::Transfer(int level)
+{
+    gpu::UploadRegion region{};
+    region.width = mLevels[level].w;
+    region.height = mLevels[level].h;
+    region.level = level;
+
+    if (mSlot >= 0) {
+        INX_UnpackBuffers.Upload(mSlot, mTexture->gpu, static_cast<GLintptr>(mOffsets[level]), region);
+    }
+    else {
+        mTexture->gpu.Upload(mLevels[level].pixels, region);
+    }
+}
+
+void INX_TextureUpload_Quit()
+{
+    INX_UnpackBuffers.Clear();
+}
+
+/**
+ * Loads the levels of an image file in the background, from 'firstLevel' of its full chain.
+ * The mip chain is generated by the worker when needed, so that the main thread only transfers it.
+ */
+static NX_AsyncLoad* INX_LoadTextureAsync(const char* filePath, NX_TextureWrap wrap, NX_TextureFilter filter, int firstLevel)
+{
+    struct State {
+        std::string filePath;
+        NX_TextureWrap wrap;
+        NX_TextureFilter filter;
+        int firstLevel;
+        util::DynamicArray<NX_Image> levels;
+        std::unique_ptr<INX_TextureUpload> upload;
+        ~State() {
+            upload.reset();
+            for (NX_Image& level : levels) NX_DestroyImage(&level);
+        }
+    };
+
+    auto state = std::make_shared<State>();
+    state->filePath = filePath;
+    state->wrap = wrap;
+    state->filter = filter;
+    state->firstLevel = firstLevel;
+
+    return INX_AsyncLoad_Submit(
+        [state]() {
+            util::DynamicArray<NX_Image>& levels = state->levels;
+            if (!INX_LoadTextureLevels(state->filePath.c_str(), &levels)) {
+                return false;
+            }
+            const bool needChain = (state->filter == NX_TEXTURE_FILTER_TRILINEAR || state->firstLevel > 0);
+            if (needChain && levels.GetSize() == 1 && !NX_IsPixelFormatCompressed(levels[0].format)) {
+                INX_GenImageMipmaps(levels[0], NX_MIPMAP_FILTER_KAISER, false, 0.0f, &levels);
+            }
+            if (state->firstLevel >= static_cast<int>(levels.GetSize())) {
+                return false;
+            }
+            for (int i = 0; i < state->firstLevel; i++) {
+                NX_DestroyImage(&levels[i]);
+            }
+            levels.Erase(levels.Begin(), levels.Begin() + state->firstLevel);
+            return true;
+        },
+        [state](size_t* bytes, void** result) {
+            if (state->upload == nullptr) {
+                state->upload = std::make_unique<INX_TextureUpload>(
+                    state->levels.GetData(), static_cast<int>(state->levels.GetSize()),
+                    state->wrap, state->filter
+                );
+            }
+            NX_AsyncStatus status = state->upload->Step(bytes);
+            if (status != NX_ASYNC_PENDING) {
+                *result = state->upload->Take();
+                state->upload.reset();
+                for (NX_Image& level : state->levels) NX_DestroyImage(&level);
+                state->levels.Clear();
+            }
+            return status;
+        },
+        [](void* result) {
+            NX_DestroyTexture(static_cast<NX_Texture*>(result));
+        }
+    );
+}
+
+// ============================================================================
+// TEXTURE STREAMING
+// ============================================================================
+
+/** Levels whose largest side is at most this size stay resident */
+static constexpr int INX_StreamTailSize = 128;
+
+/** Maximum number of stream ins in flight */
+static constexpr int INX_MaxStreamLoads = 4;
+
+INX_TextureStream::~INX_TextureStream()
+{
+    NX_DestroyAsyncLoad(load);
+}
+
+/** GPU memory used by the levels of a streamed texture from 'level' */
+static size_t INX_GetStreamBytes(const INX_TextureStream& stream, int level)
+{
+    size_t bytes = 0;
+    for (int i = level; i < stream.levelCount; i++) {
+        bytes += NX_GetImageDataSize(std::max(stream.size.x >> i, 1), std::max(stream.size.y >> i, 1), stream.format);
+    }
+    return bytes;
+}
+
+/** Swaps in the texture of a finished stream in, the handle keeps its parameters */
+static void INX_FinishStreamIn(NX_Texture* texture)
+{
+    INX_TextureStream& stream = *texture->stream;
+
+    if (NX_PollAsyncLoad(stream.load) == NX_ASYNC_PENDING) {
+        return;
+    }
+
+    NX_Texture* loaded = static_cast<NX_Texture*>(INX_AsyncLoad_Take(stream.load));
+
+    if (loaded != nullptr) {
+        gpu::TextureParam parameters = texture->gpu.GetParameters();
+        std::swap(texture->gpu, loaded->gpu);
+        texture->gpu.SetParameters(parameters);
+        INX_StreamingStats.streamedLevels += stream.residentLevel - stream.loadLevel;
+        stream.residentLevel = stream.loadLevel;
+        NX_DestroyTexture(loaded);
+    }
+    else {
+        NX_LOG(W, "RENDER: Failed to stream texture levels from '%s', its resolution will stay limited", stream.filePath.c_str());
+        stream.minLevel = stream.residentLevel;
+    }
+
+    NX_DestroyAsyncLoad(stream.load);
+    stream.load = nullptr;
+}
+
+/** Releases the levels of a streamed texture above 'level' */
+static void INX_EvictStreamLevels(NX_Texture* texture, int level)
+{
+    INX_TextureStream& stream = *texture->stream;
+
+    const int count = level - stream.residentLevel;
+    const int prevLevels = texture->gpu.GetNumLevels();
+
+    texture->gpu.DropTopLevels(count);
+
+    if (texture->gpu.GetNumLevels() != prevLevels) {
+        INX_StreamingStats.evictedLevels += count;
+        stream.residentLevel = level;
+    }
+}
+
+bool INX_TextureStreaming_IsActive()
+{
+    return !INX_StreamedTextures.IsEmpty();
+}
+
+void INX_TextureStreaming_Request(NX_Texture* texture, float screenSize)
+{
+    if (texture == nullptr || texture->stream == nullptr) {
+        return;
+    }
+
+    INX_TextureStream& stream = *texture->stream;
+
+    // NOTE: One texel per pixel along the largest side, rounded down to the sharper level
+    const float texels = static_cast<float>(std::max(stream.size.x, stream.size.y));
+
+    int level = 0;
+    if (screenSize < texels) {
+        level = static_cast<int>(std::log2(texels / std::max(screenSize, 1.0f)));
+    }
+
+    stream.wantedLevel = std::min(stream.wantedLevel, std::min(level, stream.tailLevel));
+    stream.lastUseFrame = INX_StreamingFrame;
+}
+
+void INX_TextureStreaming_Update()
+{
+    INX_StreamingFrame++;
+
+    if (INX_StreamedTextures.IsEmpty()) {
+        return;
+    }
+
+    /* --- Complete the finished stream ins, the pending ones count as resident --- */
+
+    size_t usedBytes = 0;
+    int pendingLoads = 0;
+
+    for (NX_Texture* texture : INX_StreamedTextures) {
+        INX_TextureStream& stream = *texture->stream;
+        if (stream.load != nullptr) {
+            INX_FinishStreamIn(texture);
+        }
+        if (stream.load != nullptr) {
+            usedBytes += INX_GetStreamBytes(stream, std::min(stream.loadLevel, stream.residentLevel));
+            pendingLoads++;
+        }
+        else {
+            usedBytes += INX_GetStreamBytes(stream, stream.residentLevel);
+        }
+    }
+
+    /* --- Evict in LRU order, first the levels no longer requested, then any level above the tails --- */
+
+    if (!INX_StreamingOrder.Assign(INX_StreamedTextures.Begin(), INX_StreamedTextures.End())) {
+        return;
+    }
+
+    std::stable_sort(INX_StreamingOrder.Begin(), INX_StreamingOrder.End(),
+        [](const NX_Texture* a, const NX_Texture* b) {
+            return a->stream->lastUseFrame < b->stream->lastUseFrame;
+        }
+    );
+
+    const size_t budget = INX_StreamingBudget;
+
+    for (int pass = 0; pass < 2 && budget > 0 && usedBytes > budget; pass++) {
+        for (NX_Texture* texture : INX_StreamingOrder) {
+            INX_TextureStream& stream = *texture->stream;
+            if (stream.load != nullptr) {
+                continue;
+            }
+            const int limit = (pass == 0) ? std::max(stream.wantedLevel, stream.residentLevel) : stream.tailLevel;
+            int level = stream.residentLevel;
+            while (level < limit && usedBytes > budget) {
+                usedBytes -= INX_GetStreamBytes(stream, level) - INX_GetStreamBytes(stream, level + 1);
+                level++;
+            }
+            if (level > stream.residentLevel) {
+                INX_EvictStreamLevels(texture, level);
+            }
+            if (usedBytes <= budget) {
+                break;
+            }
+        }
+    }
+
+    /* --- Stream in the requested levels, most recently used textures first --- */
+
+    for (auto it = INX_StreamingOrder.ReverseBegin(); it != INX_StreamingOrder.ReverseEnd(); ++it)
+    {
+        if (pendingLoads >= INX_MaxStreamLoads) {
+            break;
+        }
+
+        NX_Texture* texture = *it;
+        INX_TextureStream& stream = *texture->stream;
+
+        if (stream.load != nullptr) {
+            continue;
+        }
+
+        // NOTE: Under budget pressure, the finest level that still fits is loaded instead
+        const size_t currentBytes = INX_GetStreamBytes(stream, stream.residentLevel);
+        int level = std::max(stream.wantedLevel, stream.minLevel);
+        while (level < stream.residentLevel && budget > 0 &&
+               usedBytes - currentBytes + INX_GetStreamBytes(stream, level) > budget) {
+            level++;
+        }
+
+        if (level >= stream.residentLevel) {
+            continue;
+        }
+
+        stream.load = INX_LoadTextureAsync(stream.filePath.c_str(), INX_DefaultWrap, NX_TEXTURE_FILTER_TRILINEAR, level);
+        if (stream.load == nullptr) {
+            continue;
+        }
+
+        stream.loadLevel = level;
+        usedBytes += INX_GetStreamBytes(stream, level) - currentBytes;
+        pendingLoads++;
+    }
+
+    /* --- Update the statistics and reset the requests for the next frame --- */
+
+    INX_StreamingStats.textureCount = static_cast<int>(INX_StreamedTextures.GetSize());
+    INX_StreamingStats.pendingLoads = pendingLoads;
+    INX_StreamingStats.residentBytes = 0;
+    INX_StreamingStats.wantedBytes = 0;
+    INX_StreamingStats.budgetBytes = budget;
+
+    for (NX_Texture* texture : INX_StreamedTextures) {
+        INX_TextureStream& stream = *texture->stream;
+        INX_StreamingStats.residentBytes += INX_GetStreamBytes(stream, stream.residentLevel);
+        INX_StreamingStats.wantedBytes += INX_GetStreamBytes(stream, std::max(stream.wantedLevel, stream.minLevel));
+        stream.wantedLevel = stream.tailLevel;
+    }
+}
+
+void INX_TextureStreaming_Quit()
+{
+    for (NX_Texture* texture : INX_StreamedTextures) {
+        NX_DestroyAsyncLoad(texture->stream->load);
+        texture->stream->load = nullptr;
+    }
+
+    INX_StreamedTextures.Clear();
+    INX_StreamingOrder.Clear();
+}
+
 // ============================================================================
 // PUBLIC API
 // ============================================================================
@@ -145,46 +786,130 @@ NX_Texture* NX_CreateTextureFromImageEx(const NX_Image* image, NX_TextureWrap wr
         return nullptr;
     }
 
-    bool genMipmap = (filter == NX_TEXTURE_FILTER_TRILINEAR);
-    std::pair<GLenum, GLenum> glFilter = INX_GetFilter(filter, genMipmap);
-    GLenum glWrap = INX_GetWrap(wrap);
+    return INX_CreateImageTexture(image, image->pixels, wrap, filter);
+}
 
-    gpu::Texture texture(
-        gpu::TextureConfig
-        {
-            .target = GL_TEXTURE_2D,
-            .internalFormat = INX_GPU_GetInternalFormat(image->format, false),
-            .data = image->pixels,
-            .width = image->w,
-            .height = image->h,
-            .depth = 0,
-            .mipmap = genMipmap
-        },
-        gpu::TextureParam
-        {
-            .minFilter = glFilter.first,
-            .magFilter = glFilter.second,
-            .sWrap = glWrap,
-            .tWrap = glWrap,
-            .rWrap = glWrap,
-            .anisotropy = INX_DefaultAnisotropy
-        }
-    );
+NX_Texture* NX_CreateTextureFromMipmaps(const NX_Image* levels, int levelCount, NX_TextureWrap wrap, NX_TextureFilter filter)
+{
+    if (levels == nullptr || levelCount <= 0 || levels[0].pixels == nullptr) {
+        NX_LOG(E, "RENDER: Failed to load texture; Mip levels are invalid");
+        return nullptr;
+    }
 
-    return INX_Pool.Create<NX_Texture>(std::move(texture));
+    return INX_CreateLevelsTexture(levels, levelCount, wrap, filter);
 }
 
 NX_Texture* NX_LoadTexture(const char* filePath)
 {
-    NX_Image image = NX_LoadImage(filePath);
-    if (image.pixels == nullptr) return nullptr;
+    util::DynamicArray<NX_Image> levels;
+    if (!INX_LoadTextureLevels(filePath, &levels)) {
+        return nullptr;
+    }
 
-    NX_Texture* texture = NX_CreateTextureFromImage(&image);
-    NX_DestroyImage(&image);
+    NX_Texture* texture = nullptr;
+
+    if (levels.GetSize() == 1) {
+        texture = NX_CreateTextureFromImage(&levels[0]);
+    }
+    else {
+        texture = INX_CreateLevelsTexture(levels.GetData(), static_cast<int>(levels.GetSize()), INX_DefaultWrap, INX_DefaultFilter);
+    }
+
+    for (NX_Image& level : levels) {
+        NX_DestroyImage(&level);
+    }
 
     return texture;
 }
 
+NX_AsyncLoad* NX_LoadTextureAsync(const char* filePath)
+{
+    return INX_LoadTextureAsync(filePath, INX_DefaultWrap, INX_DefaultFilter, 0);
+}
+
+NX_Texture* NX_LoadTextureStreamed(const char* filePath)
+{
+    util::DynamicArray<NX_Image> levels;
+    if (!INX_LoadTextureLevels(filePath, &levels)) {
+        return nullptr;
+    }
+
+    if (levels.GetSize() == 1 && !NX_IsPixelFormatCompressed(levels[0].format)) {
+        INX_GenImageMipmaps(levels[0], NX_MIPMAP_FILTER_KAISER, false, 0.0f, &levels);
+    }
+
+    const NX_Image& base = levels[0];
+    const int levelCount = static_cast<int>(levels.GetSize());
+
+    /* --- Find the tail, the first level small enough to stay resident --- */
+
+    int tailLevel = 0;
+    while (tailLevel < levelCount - 1 && std::max(levels[tailLevel].w, levels[tailLevel].h) > INX_StreamTailSize) {
+        tailLevel++;
+    }
+
+    /* --- Small images and partial chains are not streamed --- */
+
+    NX_Texture* texture = nullptr;
+
+    if (tailLevel == 0 || levelCount != INX_GetMipLevelCount(base.w, base.h)) {
+        texture = INX_CreateLevelsTexture(levels.GetData(), levelCount, INX_DefaultWrap, INX_DefaultFilter);
+    }
+    else {
+        texture = INX_CreateLevelsTexture(levels.GetData() + tailLevel, levelCount - tailLevel, INX_DefaultWrap, NX_TEXTURE_FILTER_TRILINEAR);
+        if (texture != nullptr) {
+            NX_SetTextureParameters(texture, INX_DefaultFilter, INX_DefaultWrap, INX_DefaultAnisotropy);
+            texture->stream = std::make_unique<INX_TextureStream>();
+            INX_TextureStream& stream = *texture->stream;
+            stream.filePath = filePath;
+            stream.size = NX_IVEC2(base.w, base.h);
+            stream.format = base.format;
+            stream.levelCount = levelCount;
+            stream.tailLevel = tailLevel;
+            stream.minLevel = 0;
+            stream.residentLevel = tailLevel;
+            stream.wantedLevel = tailLevel;
+            stream.lastUseFrame = INX_StreamingFrame;
+            if (!INX_StreamedTextures.PushBack(texture)) {
+                NX_LOG(W, "RENDER: Failed to register streamed texture '%s'; Only the tail levels will be resident", filePath);
+                texture->stream.reset();
+            }
+        }
+    }
+
+    for (NX_Image& level : levels) {
+        NX_DestroyImage(&level);
+    }
+
+    return texture;
+}
+
+void NX_SetTextureStreamingBudget(size_t bytes)
+{
+    INX_StreamingBudget = bytes;
+}
+
+size_t NX_GetTextureStreamingBudget()
+{
+    return INX_StreamingBudget;
+}
+
+NX_TextureStreamingStats NX_GetTextureStreamingStats()
+{
+    return INX_StreamingStats;
+}
+
+void NX_ResetTextureStreamingStats()
+{
+    INX_StreamingStats.streamedLevels = 0;
+    INX_StreamingStats.evictedLevels = 0;
+}
+
+NX_Texture* NX_GetAsyncTexture(NX_AsyncLoad* load)
+{
+    return static_cast<NX_Texture*>(INX_AsyncLoad_Take(load));
+}
+
 NX_Texture* NX_LoadTextureAsData(const char* filePath)
 {
     NX_Image image = NX_LoadImageRaw(filePath);
@@ -195,11 +920,51 @@ NX_Texture* NX_LoadTextureAsData(const char* filePath)
 
 void NX_DestroyTexture(NX_Texture* texture)
 {
+    if (texture == nullptr || --texture->refCount > 0) {
+        return;
+    }
+
+    if (texture->cacheKey != 0) {
+        INX_TextureCache.erase(texture->cacheKey);
+    }
+
+    if (texture->stream != nullptr) {
+        auto it = std::find(INX_StreamedTextures.Begin(), INX_StreamedTextures.End(), texture);
+        if (it != INX_StreamedTextures.End()) {
+            *it = *INX_StreamedTextures.GetBack();
+            INX_StreamedTextures.PopBack();
+        }
+    }
+
     INX_Pool.Destroy(texture);
 }
 
+NX_Texture* NX_RetainTexture(NX_Texture* texture)
+{
+    if (texture != nullptr) {
+        texture->refCount++;
+    }
+    return texture;
+}
+
+NX_TextureCacheStats NX_GetTextureCacheStats()
+{
+    NX_TextureCacheStats stats = INX_TextureCacheStats;
+    stats.entries = static_cast<int>(INX_TextureCache.size());
+    return stats;
+}
+
+void NX_ResetTextureCacheStats()
+{
+    INX_TextureCacheStats.hits = 0;
+    INX_TextureCacheStats.misses = 0;
+}
+
 NX_IVec2 NX_GetTextureSize(const NX_Texture* texture)
 {
+    if (texture->stream != nullptr) {
+        return texture->stream->size;
+    }
     return texture->gpu.GetDimensions();
 }
 
@@ -237,6 +1002,11 @@ void NX_SetTextureWrap(NX_Texture* texture, NX_TextureWrap wrap)
 
 void NX_UploadTexture(NX_Texture* texture, const NX_Image* image)
 {
+    if (texture->stream != nullptr) {
+        NX_LOG(E, "RENDER: Streamed textures cannot be updated");
+        return;
+    }
+
     NX_Image source = *image;
 
     NX_PixelFormat texFormat = INX_GPU_GetPixelFormat(texture->gpu.GetInternalFormat());
@@ -245,7 +1015,7 @@ void NX_UploadTexture(NX_Texture* texture, const NX_Image* image)
         source = NX_CopyImage(image, texFormat);
     }
 
-    texture->gpu.Upload(image->pixels, 0, 0);
+    texture->gpu.Upload(source.pixels, 0, 0);
     if (texture->gpu.HasMipmap()) {
         texture->gpu.GenerateMipmap();
     }
@@ -259,3 +1029,16 @@ void NX_GenerateMipmap(NX_Texture* texture)
 {
     texture->gpu.GenerateMipmap();
 }
+
+bool NX_IsTextureFormatSupported(NX_PixelFormat format)
+{
+    if (format == NX_PIXEL_FORMAT_INVALID) {
+        return false;
+    }
+
+    if (!NX_IsPixelFormatCompressed(format)) {
+        return true;
+    }
+
+    return gpu::Texture::IsCompressedFormatSupported(INX_GPU_GetInternalFormat(format, false));
+}
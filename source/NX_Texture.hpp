@@ -9,15 +9,132 @@
 #ifndef NX_TEXTURE_HPP
 #define NX_TEXTURE_HPP
 
+#include <NX/NX_AsyncLoad.h>
 #include <NX/NX_Texture.h>
+
 #include "./Detail/GPU/Texture.hpp"
+#include "./Detail/Util/DynamicArray.hpp"
+#include "./INX_JobSystem.hpp"
+
+#include <memory>
+#include <string>
 
 // ============================================================================
 // OPAQUE DEFINITION
 // ============================================================================
 
+/** Residency of a texture loaded with NX_LoadTextureStreamed, levels are indexed in its full chain */
+struct INX_TextureStream {
+    std::string filePath;
+    NX_IVec2 size{};            //< Size of the full resolution level
+    NX_PixelFormat format{};
+    int levelCount{};           //< Number of levels of the full chain
+    int tailLevel{};            //< First level of the tail, which is never evicted
+    int minLevel{};             //< Finest level that can be streamed in, raised when a load fails
+    int residentLevel{};        //< First level currently on the GPU
+    int wantedLevel{};          //< Finest level requested by the draws since the last update
+    uint64_t lastUseFrame{};
+    NX_AsyncLoad* load{};       //< Pending stream in, or nullptr
+    int loadLevel{};            //< First level of the pending stream in
+
+    ~INX_TextureStream();
+};
+
 struct NX_Texture {
     gpu::Texture gpu;
+    int refCount{1};            //< Released by NX_DestroyTexture once it drops to zero
+    uint64_t cacheKey{0};       //< Key in the shared texture cache, zero if not shared
+    std::unique_ptr<INX_TextureStream> stream;  //< Only set for streamed textures
+};
+
+// ============================================================================
+// SHARED TEXTURE CACHE
+// ============================================================================
+
+/**
+ * Weak cache of textures shared between materials and models, entries
+ * are removed when their texture is released. Keys are computed by the
+ * callers from the image source and every parameter affecting the result.
+ */
+
+/** Returns a new reference to the cached texture, or nullptr if the key is unknown */
+NX_Texture* INX_TextureCache_Acquire(uint64_t key);
+
+/** Registers a newly created texture, counts as a miss in the statistics */
+void INX_TextureCache_Insert(uint64_t key, NX_Texture* texture);
+
+/** Should be called before releasing all pools, textures are not destroyed */
+void INX_TextureCache_Clear();
+
+// ============================================================================
+// STAGED TEXTURE UPLOAD
+// ============================================================================
+
+/**
+ * Creates a texture from images over several main thread steps, for the asynchronous loaders.
+ * The pixels are copied by a worker into a pixel unpack buffer, then the main thread only issues
+ * the transfers from that buffer, one mip level per step, and fences it.
+ * Each level must be half the size of the previous one, the images must outlive the upload.
+ * Falls back to direct transfers from the images if no staging buffer can be created.
+ */
+class INX_TextureUpload {
+public:
+    INX_TextureUpload(const NX_Image* levels, int levelCount, NX_TextureWrap wrap, NX_TextureFilter filter);
+    ~INX_TextureUpload();
+
+    INX_TextureUpload(const INX_TextureUpload&) = delete;
+    INX_TextureUpload& operator=(const INX_TextureUpload&) = delete;
+
+    /** Performs the next step and writes the number of transferred bytes, returns NX_ASYNC_PENDING while steps remain */
+    NX_AsyncStatus Step(size_t* bytes);
+
+    /** Retrieves the texture once the upload is ready, the caller takes ownership */
+    NX_Texture* Take();
+
+private:
+    enum class Stage { Create, Stage, Transfer, Done };
+
+private:
+    bool Create();
+    void Transfer(int level);
+
+private:
+    const NX_Image* mLevels{};
+    int mLevelCount{};
+    NX_TextureWrap mWrap{};
+    NX_TextureFilter mFilter{};
+
+    NX_Texture* mTexture{};
+    util::DynamicArray<size_t> mOffsets;  //< Offset of each level in the staging slot
+    INX_JobCounter mCopyCounter;
+    Stage mStage{Stage::Create};
+    int mSlot{-1};                  //< Staging slot, -1 when transferring directly from the images
+    int mLevel{0};                  //< Next level to transfer
 };
 
+/** Should be called before destroying the GL context, once no upload is pending */
+void INX_TextureUpload_Quit();
+
+// ============================================================================
+// TEXTURE STREAMING
+// ============================================================================
+
+/**
+ * Streamed textures keep a low resolution tail on the GPU, their larger levels are loaded
+ * in the background when the draws need them and evicted in LRU order under the budget.
+ * Residency changes replace the GPU texture, the NX_Texture handle stays the same.
+ */
+
+/** Returns true if at least one texture is streamed, lets the renderer skip its requests */
+bool INX_TextureStreaming_IsActive();
+
+/** Registers the size in pixels at which a texture is drawn, does nothing if it is not streamed */
+void INX_TextureStreaming_Request(NX_Texture* texture, float screenSize);
+
+/** Applies the requests of the previous frame, called by NX_FrameStep before the asynchronous uploads */
+void INX_TextureStreaming_Update();
+
+/** Cancels the pending stream ins, should be called after INX_AsyncLoad_Quit */
+void INX_TextureStreaming_Quit();
+
 #endif // NX_TEXTURE_HPP
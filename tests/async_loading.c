@@ -0,0 +1,145 @@
+/* async_loading.c -- Test for asynchronous model and texture loading with a per-frame upload budget
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define GRID_SIZE 6
+#define MODEL_COUNT (GRID_SIZE * GRID_SIZE)
+
+static const char* MODEL_FILES[] = {
+    "models/DamagedHelmet.glb",
+    "models/MultiUVTest.glb",
+    "models/CesiumMan.glb",
+};
+
+typedef struct {
+    NX_AsyncLoad* load;
+    NX_Model* model;
+} Slot;
+
+static void RequestModels(Slot slots[MODEL_COUNT])
+{
+    for (int i = 0; i < MODEL_COUNT; i++) {
+        NX_DestroyAsyncLoad(slots[i].load);
+        NX_DestroyModel(slots[i].model);
+        slots[i].model = NULL;
+        slots[i].load = NX_LoadModelAsync(MODEL_FILES[i % NX_ARRAY_SIZE(MODEL_FILES)]);
+    }
+}
+
+int main(void)
+{
+    /* --- Initialize engine and load resources --- */
+
+    NX_Init("Nexium - Async Loading", 800, 450, 0);
+    NX_AddSearchPath(RESOURCES_PATH, false);
+
+    NX_AsyncLoad* groundLoad = NX_LoadTextureAsync("images/uv-grid.png");
+    NX_Texture* groundTexture = NULL;
+
+    NX_Mesh* ground = NX_GenMeshQuad(NX_VEC2_1(3.0f * GRID_SIZE), NX_IVEC2_ONE, NX_VEC3_UP);
+    NX_Material groundMaterial = NX_GetDefaultMaterial();
+
+    Slot slots[MODEL_COUNT] = { 0 };
+    RequestModels(slots);
+
+    /* --- Setup scene --- */
+
+    NX_Light* light = NX_CreateLight(NX_LIGHT_DIR);
+    NX_SetLightDirection(light, NX_VEC3(-1, -1, -1));
+    NX_SetLightActive(light, true);
+
+    NX_Camera camera = NX_GetDefaultCamera();
+
+    bool budgetEnabled = true;
+    double frameTimeMax = 0.0;
+
+    /* --- Main loop --- */
+
+    while (NX_FrameStep())
+    {
+        CMN_UpdateCamera(&camera, NX_VEC3_ZERO, 2.0f * GRID_SIZE, 6.0f);
+
+        /* --- Controls --- */
+
+        if (NX_IsKeyJustPressed(NX_KEY_R)) {
+            RequestModels(slots);
+            frameTimeMax = 0.0;
+        }
+
+        if (NX_IsKeyJustPressed(NX_KEY_SPACE)) {
+            budgetEnabled = !budgetEnabled;
+            NX_SetAsyncUploadBudget(budgetEnabled ? 2.0 : 0.0, budgetEnabled ? 16 * 1024 * 1024 : 0);
+            frameTimeMax = 0.0;
+        }
+
+        /* --- Retrieve finished loads --- */
+
+        if (groundTexture == NULL && NX_PollAsyncLoad(groundLoad) == NX_ASYNC_READY) {
+            groundTexture = NX_GetAsyncTexture(groundLoad);
+            groundMaterial.albedo.texture = groundTexture;
+        }
+
+        int loadedCount = 0;
+        for (int i = 0; i < MODEL_COUNT; i++) {
+            if (slots[i].model == NULL && NX_PollAsyncLoad(slots[i].load) == NX_ASYNC_READY) {
+                slots[i].model = NX_GetAsyncModel(slots[i].load);
+            }
+            loadedCount += (slots[i].model != NULL);
+        }
+
+        double frameTime = 1000.0 * NX_GetDeltaTime();
+        if (frameTime > frameTimeMax && NX_GetElapsedTime() > 1.0) {
+            frameTimeMax = frameTime;
+        }
+
+        /* --- Render the models already available --- */
+
+        NX_Begin3D(&camera, NULL, 0);
+        {
+            NX_DrawMesh3D(ground, &groundMaterial, NULL);
+
+            for (int i = 0; i < MODEL_COUNT; i++) {
+                if (slots[i].model == NULL) continue;
+                NX_Transform transform = NX_TRANSFORM_IDENTITY;
+                transform.translation = NX_VEC3(
+                    2.5f * (i % GRID_SIZE - 0.5f * (GRID_SIZE - 1)), 1.0f,
+                    2.5f * (i / GRID_SIZE - 0.5f * (GRID_SIZE - 1))
+                );
+                NX_DrawModel3D(slots[i].model, &transform);
+            }
+        }
+        NX_End3D();
+
+        /* --- UI --- */
+
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_YELLOW);
+        NX_DrawText2D(CMN_FormatText("Models: %i / %i - Frame: %.2f ms - Max: %.2f ms", loadedCount, MODEL_COUNT, frameTime, frameTimeMax), NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("[SPACE] Upload budget: %s", budgetEnabled ? "2 ms / 16 MB" : "OFF"), NX_VEC2(10, 30), 16, NX_VEC2_ONE);
+        NX_DrawText2D("[R] Reload", NX_VEC2(10, 50), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    /* --- Cleanup --- */
+
+    for (int i = 0; i < MODEL_COUNT; i++) {
+        NX_DestroyAsyncLoad(slots[i].load);
+        NX_DestroyModel(slots[i].model);
+    }
+
+    NX_DestroyAsyncLoad(groundLoad);
+    NX_DestroyTexture(groundTexture);
+    NX_DestroyMesh(ground);
+    NX_DestroyLight(light);
+
+    NX_Quit();
+
+    return 0;
+}
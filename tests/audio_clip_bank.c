@@ -0,0 +1,103 @@
+/* audio_clip_bank.c -- Load time and memory benchmark of decoded and compressed audio clips
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ *
+ * Loads the sine test files many times over, one by one, as a decoded bank and
+ * as a compressed bank, then plays every compressed clip once to compare the
+ * memory of the files with the memory of their decoded buffers.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define REPEAT_COUNT 32
+#define FORMAT_COUNT 4
+#define CLIP_COUNT (REPEAT_COUNT * FORMAT_COUNT)
+
+static const char* FILES[FORMAT_COUNT] = {
+    "audio/sine.wav", "audio/sine.flac",
+    "audio/sine.mp3", "audio/sine.ogg"
+};
+
+static void DestroyClips(NX_AudioClip* clips[CLIP_COUNT])
+{
+    for (int i = 0; i < CLIP_COUNT; i++) {
+        NX_DestroyAudioClip(clips[i]);
+        clips[i] = NULL;
+    }
+}
+
+int main(void)
+{
+    NX_Init("Nexium - Audio Clip Bank", 800, 450, 0);
+    NX_AddSearchPath(RESOURCES_PATH, false);
+
+    const char* paths[CLIP_COUNT];
+    for (int i = 0; i < CLIP_COUNT; i++) {
+        paths[i] = FILES[i % FORMAT_COUNT];
+    }
+
+    NX_AudioClip* clips[CLIP_COUNT] = { 0 };
+
+    /* --- Sequential decoded loads --- */
+
+    double start = NX_GetCurrentTime();
+    for (int i = 0; i < CLIP_COUNT; i++) {
+        clips[i] = NX_LoadAudioClip(paths[i], 1);
+    }
+    double sequentialTime = NX_GetCurrentTime() - start;
+    DestroyClips(clips);
+
+    /* --- Decoded bank, files decoded on the workers --- */
+
+    start = NX_GetCurrentTime();
+    int decodedCount = NX_LoadAudioClipBank(paths, CLIP_COUNT, 1, NX_AUDIO_CLIP_DECODED, clips);
+    double decodedTime = NX_GetCurrentTime() - start;
+    DestroyClips(clips);
+
+    /* --- Compressed bank, files only read --- */
+
+    start = NX_GetCurrentTime();
+    int compressedCount = NX_LoadAudioClipBank(paths, CLIP_COUNT, 1, NX_AUDIO_CLIP_COMPRESSED, clips);
+    double compressedTime = NX_GetCurrentTime() - start;
+
+    /* --- Decode every compressed clip once, without eviction --- */
+
+    NX_SetAudioVolume(0.0f);
+    NX_SetAudioClipCacheBudget(SIZE_MAX);
+
+    start = NX_GetCurrentTime();
+    for (int i = 0; i < CLIP_COUNT; i++) {
+        NX_PlayAudioClip(clips[i], 0);
+        NX_StopAudioClip(clips[i], 0);
+    }
+    double firstPlayTime = NX_GetCurrentTime() - start;
+
+    NX_AudioClipCacheStats stats = NX_GetAudioClipCacheStats();
+
+    /* --- Show the results until the window is closed --- */
+
+    while (NX_FrameStep())
+    {
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_BLACK);
+        NX_DrawRect2D(0, 0, NX_GetWindowWidth(), NX_GetWindowHeight());
+        NX_SetColor2D(NX_YELLOW);
+        NX_DrawText2D(CMN_FormatText("Clips: %i (%i formats x %i)", CLIP_COUNT, FORMAT_COUNT, REPEAT_COUNT), NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("Sequential decoded load: %.2f ms", 1000.0 * sequentialTime), NX_VEC2(10, 30), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("Decoded bank load: %.2f ms (%i clips)", 1000.0 * decodedTime, decodedCount), NX_VEC2(10, 50), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("Compressed bank load: %.2f ms (%i clips)", 1000.0 * compressedTime, compressedCount), NX_VEC2(10, 70), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("Compressed first plays: %.2f ms", 1000.0 * firstPlayTime), NX_VEC2(10, 90), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("Memory: %.1f KB compressed / %.1f KB decoded", stats.compressedBytes / 1024.0, stats.residentBytes / 1024.0), NX_VEC2(10, 110), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    DestroyClips(clips);
+
+    NX_Quit();
+
+    return 0;
+}
@@ -4,6 +4,9 @@
  *
  * This software is provided 'as-is', without any express or implied warranty.
  * For conditions of distribution and use, see accompanying LICENSE file.
+ *
+ * Starts with 100k bunnies so that a frame exceeds the 16-bit index range,
+ * holding the left button adds 100 per frame and the right button 10k.
  */
 
 #include <NX/Nexium.h>
@@ -12,6 +15,7 @@
 /* --- Bunny Definition --- */
 
 #define MAX_BUNNIES 500000
+#define START_BUNNIES 100000
 
 typedef struct {
     NX_Vec2 position;
@@ -71,6 +75,13 @@ int main(void)
     NX_Texture* texture = NX_LoadTexture("images/wabbit_alpha.png");
     NX_SetTexture2D(texture);
 
+    /* --- Spawn the initial bunnies --- */
+
+    NX_Vec2 center = NX_VEC2(0.5f * NX_GetWindowWidth(), 0.5f * NX_GetWindowHeight());
+    while (bunnyCount < START_BUNNIES) {
+        Bunny_Init(&bunnies[bunnyCount++], center);
+    }
+
     /* --- Main loop --- */
 
     while (NX_FrameStep())
@@ -91,6 +102,12 @@ int main(void)
                 Bunny_Init(&bunnies[bunnyCount++], pos);
         }
 
+        if (NX_IsMouseButtonPressed(NX_MOUSE_BUTTON_RIGHT)) {
+            NX_Vec2 pos = NX_GetMousePosition();
+            for (int i = 0; i < 10000 && bunnyCount < MAX_BUNNIES; i++)
+                Bunny_Init(&bunnies[bunnyCount++], pos);
+        }
+
         /* --- 2D Rendering --- */
 
         NX_Begin2D(NULL);
@@ -0,0 +1,71 @@
+/* culling_2d.c -- Scrolls a large 2D map where most primitives are off screen
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ *
+ * Every tile of the map is submitted each frame through a translated and
+ * rotated transform, the renderer only emits the visible ones.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define MAP_SIZE 128
+#define TILE_SIZE 48.0f
+
+int main(void)
+{
+    NX_Init("Nexium - 2D Culling", 800, 450, 0);
+
+    NX_Vec2 scroll = NX_VEC2_ZERO;
+
+    while (NX_FrameStep())
+    {
+        /* --- Scroll the map in a circle --- */
+
+        float time = (float)NX_GetElapsedTime();
+        scroll = NX_VEC2(
+            0.5f * MAP_SIZE * TILE_SIZE * (1.0f + 0.8f * cosf(0.1f * time)),
+            0.5f * MAP_SIZE * TILE_SIZE * (1.0f + 0.8f * sinf(0.1f * time))
+        );
+
+        NX_ResetRender2DStats();
+
+        /* --- Submit every tile of the map --- */
+
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_BLACK);
+        NX_DrawRect2D(0, 0, NX_GetWindowWidth(), NX_GetWindowHeight());
+
+        NX_Push2D();
+        NX_Translate2D(NX_VEC2(0.5f * NX_GetWindowWidth(), 0.5f * NX_GetWindowHeight()));
+        NX_Rotate2D(0.1f * sinf(0.5f * time));
+        NX_Translate2D(NX_Vec2Scale(scroll, -1.0f));
+
+        for (int y = 0; y < MAP_SIZE; y++) {
+            for (int x = 0; x < MAP_SIZE; x++) {
+                float px = x * TILE_SIZE, py = y * TILE_SIZE;
+                NX_SetColor2D(NX_ColorFromHSV(360.0f * (x ^ y) / MAP_SIZE, 0.6f, 0.8f, 1.0f));
+                NX_DrawRectRounded2D(px + 2, py + 2, TILE_SIZE - 4, TILE_SIZE - 4, 8, 4);
+                NX_SetColor2D(NX_WHITE);
+                NX_DrawText2D(CMN_FormatText("%i", x + y * MAP_SIZE), NX_VEC2(px + 6, py + 16), 12, NX_VEC2_ONE);
+            }
+        }
+
+        NX_Pop2D();
+
+        NX_Render2DStats stats = NX_GetRender2DStats();
+
+        NX_SetColor2D(NX_YELLOW);
+        NX_DrawText2D(CMN_FormatText("Culled: %llu - Vertices: %llu - Quads: %llu - FPS: %i",
+            (unsigned long long)stats.culled, (unsigned long long)stats.vertices,
+            (unsigned long long)stats.quads, NX_GetFPS()), NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    NX_Quit();
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+/* dynamic_font.c -- Draws glyphs rasterized on first use by a dynamic font
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ *
+ * Scrolls through a range of codepoints with a large base size so that the
+ * glyph cache fills its pages and starts evicting the oldest glyphs.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define FIRST_CODEPOINT 32
+#define LAST_CODEPOINT 0x2FF
+#define COLUMNS 16
+#define ROWS 6
+
+int main(void)
+{
+    NX_Init("Nexium - Dynamic Font", 800, 450, 0);
+    NX_AddSearchPath(RESOURCES_PATH, false);
+
+    double start = NX_GetCurrentTime();
+    NX_Font* font = NX_LoadDynamicFont("fonts/Eater-Regular.ttf", NX_FONT_NORMAL, 96);
+    double loadTime = 1000.0 * (NX_GetCurrentTime() - start);
+
+    int first = FIRST_CODEPOINT;
+    float timer = 0.0f;
+
+    while (NX_FrameStep())
+    {
+        /* --- Move to the next row of codepoints twice per second --- */
+
+        timer += NX_GetDeltaTime();
+        if (timer > 0.5f) {
+            first += COLUMNS;
+            if (first + COLUMNS * ROWS > LAST_CODEPOINT) {
+                first = FIRST_CODEPOINT;
+            }
+            timer = 0.0f;
+        }
+
+        /* --- Draw the visible codepoints --- */
+
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_BLACK);
+        NX_DrawRect2D(0, 0, NX_GetWindowWidth(), NX_GetWindowHeight());
+
+        NX_SetFont2D(font);
+        NX_SetColor2D(NX_WHITE);
+
+        for (int i = 0; i < COLUMNS * ROWS; i++) {
+            NX_Vec2 position = NX_VEC2(10.0f + (i % COLUMNS) * 48.0f, 40.0f + (i / COLUMNS) * 64.0f);
+            NX_DrawCodepoint2D(first + i, position, 48.0f);
+        }
+
+        NX_SetFont2D(NULL);
+        NX_SetColor2D(NX_YELLOW);
+        NX_DrawText2D(CMN_FormatText("Codepoints U+%04X to U+%04X - Loaded in %.2f ms - FPS: %i",
+            first, first + COLUMNS * ROWS - 1, loadTime, NX_GetFPS()), NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    NX_DestroyFont(font);
+    NX_Quit();
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/* dynamic_terrain.c -- Streams indexed terrain chunks into a single dynamic mesh
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ *
+ * One chunk is appended each frame with NX_AppendDynamicMesh, so only its
+ * vertices and indices are processed and uploaded. Press R to rebuild the
+ * whole terrain at once and compare the time spent in NX_EndDynamicMesh,
+ * or SPACE to stream the chunks again.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define CHUNK_COUNT 8
+#define CHUNK_RES 32
+#define CHUNK_SIZE 2.0f
+
+static float TerrainHeight(float x, float z)
+{
+    return 0.4f * sinf(0.7f * x) * cosf(0.5f * z) + 0.1f * sinf(2.3f * x + 1.7f * z);
+}
+
+static void AddChunk(NX_DynamicMesh* mesh, int cx, int cz, uint32_t base)
+{
+    float x0 = (cx - 0.5f * CHUNK_COUNT) * CHUNK_SIZE;
+    float z0 = (cz - 0.5f * CHUNK_COUNT) * CHUNK_SIZE;
+
+    NX_SetDynamicMeshColor(mesh, NX_ColorFromHSV(90.0f + 10.0f * ((cx + cz) % 4), 0.5f, 0.7f, 1.0f));
+
+    for (int z = 0; z <= CHUNK_RES; z++) {
+        for (int x = 0; x <= CHUNK_RES; x++) {
+            float px = x0 + CHUNK_SIZE * x / CHUNK_RES;
+            float pz = z0 + CHUNK_SIZE * z / CHUNK_RES;
+            NX_SetDynamicMeshTexCoord(mesh, NX_VEC2((float)x / CHUNK_RES, (float)z / CHUNK_RES));
+            NX_AddDynamicMeshVertex(mesh, NX_VEC3(px, TerrainHeight(px, pz), pz));
+        }
+    }
+
+    // NOTE: Indices are relative to the first vertex recorded since the last begin or append,
+    //       'base' is the index of the first vertex of this chunk from there
+    for (int z = 0; z < CHUNK_RES; z++) {
+        for (int x = 0; x < CHUNK_RES; x++) {
+            uint32_t i0 = base + z * (CHUNK_RES + 1) + x;
+            uint32_t i1 = i0 + CHUNK_RES + 1;
+            NX_AddDynamicMeshIndex(mesh, i0);
+            NX_AddDynamicMeshIndex(mesh, i1);
+            NX_AddDynamicMeshIndex(mesh, i0 + 1);
+            NX_AddDynamicMeshIndex(mesh, i0 + 1);
+            NX_AddDynamicMeshIndex(mesh, i1);
+            NX_AddDynamicMeshIndex(mesh, i1 + 1);
+        }
+    }
+}
+
+int main(void)
+{
+    NX_AppDesc desc = {
+        .render3D = { .sampleCount = 4, .resolution = { 800, 450 } },
+        .flags = NX_FLAG_VSYNC_HINT
+    };
+
+    NX_InitEx("Nexium - Dynamic Terrain", 800, 450, &desc);
+
+    NX_DynamicMesh* terrain = NX_CreateDynamicMesh(CHUNK_COUNT * CHUNK_COUNT * (CHUNK_RES + 1) * (CHUNK_RES + 1));
+
+    NX_Light* light = NX_CreateLight(NX_LIGHT_DIR);
+    NX_SetLightDirection(light, NX_VEC3(-1, -1, -1));
+    NX_SetLightActive(light, true);
+
+    NX_Camera cam = NX_GetDefaultCamera();
+
+    int chunkCount = 0;
+    double endTime = 0.0;
+    const char* lastOp = "none";
+
+    while (NX_FrameStep())
+    {
+        CMN_UpdateCamera(&cam, NX_VEC3(0, 0, 0), 12.0f, 6.0f);
+
+        /* --- Rebuild everything at once, or stream the next chunk --- */
+
+        if (NX_IsKeyJustPressed(NX_KEY_SPACE)) {
+            chunkCount = 0;
+        }
+
+        if (NX_IsKeyJustPressed(NX_KEY_R)) {
+            NX_BeginDynamicMesh(terrain, NX_PRIMITIVE_TRIANGLES, NX_DYNAMIC_MESH_GEN_NORMALS);
+            for (chunkCount = 0; chunkCount < CHUNK_COUNT * CHUNK_COUNT; chunkCount++) {
+                AddChunk(terrain, chunkCount % CHUNK_COUNT, chunkCount / CHUNK_COUNT, chunkCount * (CHUNK_RES + 1) * (CHUNK_RES + 1));
+            }
+            double start = NX_GetCurrentTime();
+            NX_EndDynamicMesh(terrain);
+            endTime = 1000.0 * (NX_GetCurrentTime() - start);
+            lastOp = "rebuild";
+        }
+        else if (chunkCount < CHUNK_COUNT * CHUNK_COUNT) {
+            if (chunkCount == 0) NX_BeginDynamicMesh(terrain, NX_PRIMITIVE_TRIANGLES, NX_DYNAMIC_MESH_GEN_NORMALS);
+            else NX_AppendDynamicMesh(terrain);
+            AddChunk(terrain, chunkCount % CHUNK_COUNT, chunkCount / CHUNK_COUNT, 0);
+            double start = NX_GetCurrentTime();
+            NX_EndDynamicMesh(terrain);
+            endTime = 1000.0 * (NX_GetCurrentTime() - start);
+            lastOp = "append";
+            chunkCount++;
+        }
+
+        /* --- Draw the terrain --- */
+
+        NX_Begin3D(&cam, NULL, 0);
+        NX_DrawDynamicMesh3D(terrain, NULL, NULL);
+        NX_End3D();
+
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_YELLOW);
+        NX_DrawText2D(CMN_FormatText("Chunks: %i - Last %s: %.3f ms - R to rebuild - SPACE to stream again",
+            chunkCount, lastOp, endTime), NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    NX_DestroyDynamicMesh(terrain);
+    NX_DestroyLight(light);
+
+    NX_Quit();
+
+    return 0;
+}
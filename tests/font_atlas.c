@@ -0,0 +1,76 @@
+/* font_atlas.c -- Benchmark test comparing font atlas generation and atlas cache loading
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ *
+ * Loads an SDF font with a large codepoint set twice: the first load rasterizes
+ * every glyph across the worker threads and writes the atlas cache, the second
+ * one reads it back and skips rasterization entirely.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define FIRST_CODEPOINT 32
+#define CODEPOINT_COUNT 736
+
+static double BenchLoad(NX_Font** font, const int* codepoints)
+{
+    double start = NX_GetCurrentTime();
+    *font = NX_LoadFont("fonts/Eater-Regular.ttf", NX_FONT_SDF, 64, codepoints, CODEPOINT_COUNT);
+    return 1000.0 * (NX_GetCurrentTime() - start);
+}
+
+int main(void)
+{
+    /* --- Initialize engine and file system --- */
+
+    NX_Init("Nexium - Font Atlas", 800, 450, 0);
+    NX_AddSearchPath(RESOURCES_PATH, false);
+
+    // Caches are written in the user directory, which is also mounted for reading
+    const char* writeDir = NX_GetPrefDir("Nexium", "FontAtlas");
+    NX_SetWriteDir(writeDir);
+    NX_AddSearchPath(writeDir, false);
+    NX_SetFontCacheDir("fonts");
+
+    /* --- Run benchmarks --- */
+
+    int codepoints[CODEPOINT_COUNT];
+    for (int i = 0; i < CODEPOINT_COUNT; i++) {
+        codepoints[i] = FIRST_CODEPOINT + i;
+    }
+
+    // NOTE: The first load only rasterizes if no cache remains from a previous run
+    NX_Font* font = NULL;
+    double firstTime = BenchLoad(&font, codepoints);
+    NX_DestroyFont(font);
+
+    double cachedTime = BenchLoad(&font, codepoints);
+
+    /* --- Draw the loaded glyphs --- */
+
+    while (NX_FrameStep())
+    {
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_BLACK);
+        NX_DrawRect2D(0, 0, NX_GetWindowWidth(), NX_GetWindowHeight());
+
+        NX_SetFont2D(font);
+        NX_SetColor2D(NX_WHITE);
+        NX_DrawText2D("The quick brown fox\njumps over the lazy dog", NX_VEC2(20, 60), 48, NX_VEC2_ONE);
+
+        NX_SetFont2D(NULL);
+        NX_SetColor2D(NX_YELLOW);
+        NX_DrawText2D(CMN_FormatText("First load: %.2f ms - Cached load: %.2f ms", firstTime, cachedTime),
+            NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    NX_DestroyFont(font);
+    NX_Quit();
+
+    return 0;
+}
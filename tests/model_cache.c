@@ -0,0 +1,113 @@
+/* model_cache.c -- Benchmark test comparing model loading from source files and from binary caches
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define BENCH_ITERATIONS 5
+
+typedef struct {
+    const char* source;
+    const char* cache;
+    double sourceTime;  //< Average load time through the regular import, in ms
+    double cacheTime;   //< Average load time from the binary cache, in ms
+} BenchEntry;
+
+static double BenchLoad(const char* filePath)
+{
+    double total = 0.0;
+
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        double start = NX_GetCurrentTime();
+        NX_Model* model = NX_LoadModel(filePath);
+        total += NX_GetCurrentTime() - start;
+        NX_DestroyModel(model);
+    }
+
+    return 1000.0 * total / BENCH_ITERATIONS;
+}
+
+int main(void)
+{
+    /* --- Initialize engine and file system --- */
+
+    NX_Init("Nexium - Model Cache", 800, 450, 0);
+    NX_AddSearchPath(RESOURCES_PATH, false);
+
+    // Caches are written in the user directory, which is also mounted for reading
+    const char* writeDir = NX_GetPrefDir("Nexium", "ModelCache");
+    NX_SetWriteDir(writeDir);
+    NX_AddSearchPath(writeDir, false);
+
+    /* --- Run benchmarks --- */
+
+    BenchEntry entries[] = {
+        { "models/DamagedHelmet.glb", "DamagedHelmet.nxm" },
+        { "models/CesiumMan.glb", "CesiumMan.nxm" },
+    };
+
+    for (int i = 0; i < NX_ARRAY_SIZE(entries); i++) {
+        entries[i].sourceTime = BenchLoad(entries[i].source);
+        if (NX_SaveModelCache(entries[i].source, entries[i].cache)) {
+            entries[i].cacheTime = BenchLoad(entries[i].cache);
+        }
+    }
+
+    /* --- Load both versions of the helmet for visual comparison --- */
+
+    NX_Model* models[2] = {
+        NX_LoadModel(entries[0].source),
+        NX_LoadModel(entries[0].cache)
+    };
+
+    NX_Light* light = NX_CreateLight(NX_LIGHT_DIR);
+    NX_SetLightDirection(light, NX_VEC3(-1, -1, -1));
+    NX_SetLightActive(light, true);
+
+    NX_Camera camera = NX_GetDefaultCamera();
+    int modelIndex = 1;
+
+    /* --- Main loop --- */
+
+    while (NX_FrameStep())
+    {
+        CMN_UpdateCamera(&camera, NX_VEC3_ZERO, 2.5f, 1.0f);
+
+        if (NX_IsKeyJustPressed(NX_KEY_SPACE)) {
+            modelIndex = (modelIndex + 1) % 2;
+        }
+
+        NX_Begin3D(&camera, NULL, 0);
+        NX_DrawModel3D(models[modelIndex], NULL);
+        NX_End3D();
+
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_YELLOW);
+        for (int i = 0; i < NX_ARRAY_SIZE(entries); i++) {
+            const BenchEntry* e = &entries[i];
+            NX_DrawText2D(
+                CMN_FormatText("%s - Source: %.2f ms - Cache: %.2f ms - x%.1f",
+                    e->source, e->sourceTime, e->cacheTime,
+                    e->cacheTime > 0.0 ? e->sourceTime / e->cacheTime : 0.0),
+                NX_VEC2(10, 10 + 20 * i), 16, NX_VEC2_ONE
+            );
+        }
+        NX_DrawText2D(CMN_FormatText("[SPACE] Displayed: %s", modelIndex ? "Cache" : "Source"), NX_VEC2(10, 60), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    /* --- Cleanup --- */
+
+    NX_DestroyModel(models[0]);
+    NX_DestroyModel(models[1]);
+    NX_DestroyLight(light);
+
+    NX_Quit();
+
+    return 0;
+}
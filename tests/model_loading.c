@@ -0,0 +1,93 @@
+/* model_loading.c -- Benchmark test for loading many small models through the job system
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ *
+ * Run with '--serial' to run every job on the main thread and compare with the default pool.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#include <string.h>
+
+#define MODEL_COUNT 100
+
+static double BenchLoad(const char* filePath, NX_Model** lastModel)
+{
+    double start = NX_GetCurrentTime();
+
+    // NOTE: Each model is destroyed before the next one is loaded so that
+    //       its textures are released from the cache and decoded again
+    for (int i = 0; i < MODEL_COUNT; i++) {
+        NX_DestroyModel(*lastModel);
+        *lastModel = NX_LoadModel(filePath);
+    }
+
+    return 1000.0 * (NX_GetCurrentTime() - start);
+}
+
+int main(int argc, char** argv)
+{
+    /* --- Worker pool configuration from the command line --- */
+
+    bool usePool = true;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--serial") == 0) usePool = false;
+    }
+
+    NX_AppDesc desc = {
+        .jobs.workerCount = usePool ? 0 : -1
+    };
+
+    /* --- Initialize engine and file system --- */
+
+    NX_InitEx("Nexium - Model Loading", 800, 450, &desc);
+    NX_AddSearchPath(RESOURCES_PATH, false);
+
+    /* --- Run the first benchmark --- */
+
+    const char* filePath = "models/MultiUVTest.glb";
+
+    NX_Model* model = NULL;
+    double loadTime = BenchLoad(filePath, &model);
+
+    NX_Light* light = NX_CreateLight(NX_LIGHT_DIR);
+    NX_SetLightDirection(light, NX_VEC3(-1, -1, -1));
+    NX_SetLightActive(light, true);
+
+    NX_Camera camera = NX_GetDefaultCamera();
+
+    /* --- Main loop --- */
+
+    while (NX_FrameStep())
+    {
+        CMN_UpdateCamera(&camera, NX_VEC3_ZERO, 2.5f, 1.0f);
+
+        if (NX_IsKeyJustPressed(NX_KEY_R)) {
+            loadTime = BenchLoad(filePath, &model);
+        }
+
+        NX_Begin3D(&camera, NULL, 0);
+        NX_DrawModel3D(model, NULL);
+        NX_End3D();
+
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_YELLOW);
+        NX_DrawText2D(CMN_FormatText("Workers: %i (%s)", NX_GetWorkerCount(), usePool ? "pool" : "serial"), NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("%i models loaded in %.2f ms - %.3f ms/model", MODEL_COUNT, loadTime, loadTime / MODEL_COUNT), NX_VEC2(10, 30), 16, NX_VEC2_ONE);
+        NX_DrawText2D("[R] Reload", NX_VEC2(10, 50), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    /* --- Cleanup --- */
+
+    NX_DestroyModel(model);
+    NX_DestroyLight(light);
+
+    NX_Quit();
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/* path_2d.c -- Benchmark test comparing immediate rounded rectangles and cached 2D paths
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ *
+ * Draws a grid of rounded panels either through NX_DrawRectRounded2D, which
+ * tessellates every panel each frame, or through a single NX_Path2D built
+ * once and redrawn with a translation. Press SPACE to switch between modes.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define COLUMNS 24
+#define ROWS 16
+#define PANEL_W 30.0f
+#define PANEL_H 24.0f
+#define RADIUS 8.0f
+#define SEGMENTS 16
+
+int main(void)
+{
+    NX_Init("Nexium - 2D Path", 800, 450, 0);
+
+    NX_Path2D* panel = NX_CreatePath2D();
+    NX_PathRectRounded2D(panel, 0, 0, PANEL_W, PANEL_H, RADIUS, SEGMENTS);
+
+    bool useCache = true;
+    double submitTime = 0.0;
+
+    while (NX_FrameStep())
+    {
+        if (NX_IsKeyJustPressed(NX_KEY_SPACE)) {
+            useCache = !useCache;
+        }
+
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_BLACK);
+        NX_DrawRect2D(0, 0, NX_GetWindowWidth(), NX_GetWindowHeight());
+
+        /* --- Submit every panel, filled and outlined --- */
+
+        double start = NX_GetCurrentTime();
+
+        for (int y = 0; y < ROWS; y++) {
+            for (int x = 0; x < COLUMNS; x++) {
+                float px = 10.0f + x * (PANEL_W + 3.0f);
+                float py = 40.0f + y * (PANEL_H + 2.0f);
+                NX_SetColor2D(NX_ColorFromHSV(15.0f * (x + y), 0.6f, 0.8f, 1.0f));
+                if (useCache) {
+                    NX_Push2D();
+                    NX_Translate2D(NX_VEC2(px, py));
+                    NX_DrawPathFilled2D(panel);
+                    NX_SetColor2D(NX_WHITE);
+                    NX_DrawPath2D(panel, 1.0f);
+                    NX_Pop2D();
+                }
+                else {
+                    NX_DrawRectRounded2D(px, py, PANEL_W, PANEL_H, RADIUS, SEGMENTS);
+                    NX_SetColor2D(NX_WHITE);
+                    NX_DrawRectRoundedBorder2D(px, py, PANEL_W, PANEL_H, RADIUS, SEGMENTS, 1.0f);
+                }
+            }
+        }
+
+        // NOTE: Smoothed over frames to keep the displayed value readable
+        submitTime = 0.9 * submitTime + 0.1 * (NX_GetCurrentTime() - start);
+
+        /* --- Display the results --- */
+
+        // Each panel is submitted twice, once filled and once outlined
+        double segments = 2.0 * COLUMNS * ROWS * 4 * SEGMENTS;
+
+        NX_SetColor2D(NX_YELLOW);
+        NX_DrawText2D(CMN_FormatText("%s - %.2f M segments/s - FPS: %i - SPACE to switch",
+            useCache ? "Cached path" : "Immediate", 1e-6 * segments / submitTime, NX_GetFPS()),
+            NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    NX_DestroyPath2D(panel);
+    NX_Quit();
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+/* skinned_crowd.c -- Benchmark test for skinning palette caching with many animated characters
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define CROWD_COLS 25
+#define CROWD_ROWS 20
+#define CROWD_SIZE (CROWD_COLS * CROWD_ROWS)
+
+int main(void)
+{
+    /* --- Initialize engine and load resources --- */
+
+    NX_Init("Nexium - Skinned Crowd", 800, 450, 0);
+    NX_AddSearchPath(RESOURCES_PATH, false);
+
+    /* --- Create ground plane --- */
+
+    NX_Mesh* ground = NX_GenMeshQuad(NX_VEC2_1(100.0f), NX_IVEC2_ONE, NX_VEC3_UP);
+
+    /* --- Load model and animation --- */
+
+    NX_AnimationLib* animLib = NX_LoadAnimationLib("models/CesiumMan.glb");
+    NX_Model* model = NX_LoadModel("models/CesiumMan.glb");
+
+    /* --- Create one animation player per character, with desynchronized timings --- */
+
+    NX_AnimationPlayer* players[CROWD_SIZE];
+    NX_Transform transforms[CROWD_SIZE];
+
+    for (int i = 0; i < CROWD_SIZE; i++) {
+        players[i] = NX_CreateAnimationPlayer(model->skeleton, animLib);
+        players[i]->states[0] = (NX_AnimationState) {
+            .currentTime = NX_RandRangeFloat(NULL, 0.0f, 1.0f),
+            .weight = 1.0f, .loop = true
+        };
+        transforms[i] = NX_TRANSFORM_IDENTITY;
+        transforms[i].translation = NX_VEC3(
+            1.5f * (i % CROWD_COLS - 0.5f * CROWD_COLS), 0.0f,
+            1.5f * (i / CROWD_COLS - 0.5f * CROWD_ROWS)
+        );
+    }
+
+    /* --- Setup directional light and shadows --- */
+
+    NX_Light* light = NX_CreateLight(NX_LIGHT_DIR);
+    NX_SetLightDirection(light, NX_VEC3(-1, -1, -1));
+    NX_SetShadowActive(light, true);
+    NX_SetLightActive(light, true);
+
+    /* --- Setup camera and benchmark state --- */
+
+    NX_Camera camera = NX_GetDefaultCamera();
+
+    bool sharedPlayer = false;  //< All characters use the same player, one palette for the whole crowd
+    bool paused = false;        //< Players are not updated, palettes are neither recomputed nor uploaded
+
+    double cpuTimeAvg = 0.0;
+
+    /* --- Main loop --- */
+
+    while (NX_FrameStep())
+    {
+        /* --- Update camera and benchmark state --- */
+
+        CMN_UpdateCamera(&camera, NX_VEC3(0, 1, 0), 25.0f, 10.0f);
+
+        if (NX_IsKeyJustPressed(NX_KEY_SPACE)) sharedPlayer = !sharedPlayer;
+        if (NX_IsKeyJustPressed(NX_KEY_P)) paused = !paused;
+
+        double cpuStart = NX_GetCurrentTime();
+
+        /* --- Update animations --- */
+
+        if (!paused) {
+            int playerCount = sharedPlayer ? 1 : CROWD_SIZE;
+            for (int i = 0; i < playerCount; i++) {
+                NX_UpdateAnimationPlayer(players[i], NX_GetDeltaTime());
+            }
+        }
+
+        /* --- 3D rendering, each character is drawn in both passes --- */
+
+        NX_BeginShadow3D(light, &camera, NX_RENDER_FRUSTUM_CULLING);
+        {
+            for (int i = 0; i < CROWD_SIZE; i++) {
+                model->player = players[sharedPlayer ? 0 : i];
+                NX_DrawModel3D(model, &transforms[i]);
+            }
+        }
+        NX_EndShadow3D();
+
+        NX_Begin3D(&camera, NULL, NX_RENDER_FRUSTUM_CULLING);
+        {
+            NX_DrawMesh3D(ground, NULL, NULL);
+            for (int i = 0; i < CROWD_SIZE; i++) {
+                model->player = players[sharedPlayer ? 0 : i];
+                NX_DrawModel3D(model, &transforms[i]);
+            }
+        }
+        NX_End3D();
+
+        /* --- Smooth the CPU time spent on animation and draw submission --- */
+
+        double cpuTime = 1000.0 * (NX_GetCurrentTime() - cpuStart);
+        cpuTimeAvg = cpuTimeAvg * 0.95 + cpuTime * 0.05;
+
+        /* --- 2D UI rendering --- */
+
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_YELLOW);
+        NX_DrawText2D(CMN_FormatText("Characters: %i - FPS: %i - CPU: %.2f ms", CROWD_SIZE, NX_GetFPS(), cpuTimeAvg), NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("[SPACE] Shared player: %s", sharedPlayer ? "ON" : "OFF"), NX_VEC2(10, 30), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("[P] Paused: %s", paused ? "ON" : "OFF"), NX_VEC2(10, 50), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    /* --- Cleanup --- */
+
+    model->player = NULL;
+    for (int i = 0; i < CROWD_SIZE; i++) {
+        NX_DestroyAnimationPlayer(players[i]);
+    }
+
+    NX_DestroyAnimationLib(animLib);
+    NX_DestroyMesh(ground);
+    NX_DestroyLight(light);
+    NX_DestroyModel(model);
+
+    NX_Quit();
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+/* sprite_atlas.c -- Packing efficiency and draw count benchmark of the runtime sprite atlas
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ *
+ * Packs many generated images of random sizes, evicts half of them and packs
+ * them again, then draws every sprite either from its own texture or from the
+ * atlas. Press SPACE to switch between both and compare the draw calls.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define SPRITE_COUNT 1024
+#define PAGE_SIZE 1024
+#define PADDING 1
+
+static NX_Image GenSpriteImage(void)
+{
+    int w = NX_RandRangeInt(NULL, 8, 64);
+    int h = NX_RandRangeInt(NULL, 8, 64);
+
+    NX_Color inner = NX_ColorFromHSV(360 * NX_RandFloat(NULL), 1, 1, 1);
+    NX_Color outer = NX_ColorFromHSV(360 * NX_RandFloat(NULL), 1, 0.5f, 1);
+
+    return NX_GenImageGradientRadial(w, h, 0.5f, inner, outer);
+}
+
+int main(void)
+{
+    NX_Init("Nexium - Sprite Atlas", 800, 450, 0);
+
+    /* --- Generate the source images --- */
+
+    NX_Image images[SPRITE_COUNT];
+    NX_Texture* textures[SPRITE_COUNT];
+
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        images[i] = GenSpriteImage();
+        textures[i] = NX_CreateTextureFromImage(&images[i]);
+    }
+
+    /* --- Pack every image --- */
+
+    NX_SpriteAtlas* atlas = NX_CreateSpriteAtlas(PAGE_SIZE, PADDING, NX_TEXTURE_FILTER_BILINEAR);
+    int sprites[SPRITE_COUNT];
+
+    double start = NX_GetCurrentTime();
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        sprites[i] = NX_AddSpriteFromImage(atlas, &images[i]);
+    }
+    double packTime = NX_GetCurrentTime() - start;
+    NX_SpriteAtlasStats packStats = NX_GetSpriteAtlasStats(atlas);
+
+    /* --- Evict every other sprite and pack it again --- */
+
+    start = NX_GetCurrentTime();
+    for (int i = 0; i < SPRITE_COUNT; i += 2) {
+        NX_RemoveSprite(atlas, sprites[i]);
+    }
+    for (int i = 0; i < SPRITE_COUNT; i += 2) {
+        sprites[i] = NX_AddSpriteFromImage(atlas, &images[i]);
+    }
+    double repackTime = NX_GetCurrentTime() - start;
+    NX_SpriteAtlasStats repackStats = NX_GetSpriteAtlasStats(atlas);
+
+    /* --- Main loop --- */
+
+    bool useAtlas = true;
+
+    while (NX_FrameStep())
+    {
+        if (NX_IsKeyJustPressed(NX_KEY_SPACE)) {
+            useAtlas = !useAtlas;
+        }
+
+        NX_Render2DStats stats = NX_GetRender2DStats();
+        NX_ResetRender2DStats();
+
+        NX_Begin2D(NULL);
+        NX_SetTexture2D(NULL);
+        NX_SetColor2D(NX_BLACK);
+        NX_DrawRect2D(0, 0, NX_GetWindowWidth(), NX_GetWindowHeight());
+        NX_SetColor2D(NX_WHITE);
+
+        for (int i = 0; i < SPRITE_COUNT; i++) {
+            float x = (float)((i % 40) * 20);
+            float y = (float)(56 + (i / 40) * 15);
+            if (useAtlas) {
+                NX_DrawSprite2D(atlas, sprites[i], x, y, 18, 14);
+            }
+            else {
+                NX_SetTexture2D(textures[i]);
+                NX_DrawRect2D(x, y, 18, 14);
+            }
+        }
+
+        NX_SetTexture2D(NULL);
+        NX_SetColor2D(NX_YELLOW);
+        NX_DrawText2D(CMN_FormatText("%s - Draw calls: %i - Occupancy: %.1f%% - FPS: %i",
+            useAtlas ? "Atlas" : "Textures", (int)stats.drawCalls,
+            100.0f * repackStats.occupancy, NX_GetFPS()), NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("Pack: %.2f ms (%i pages of %ix%i, %.1f%%) - Repack half: %.2f ms (%i pages)",
+            1000.0 * packTime, packStats.pageCount, PAGE_SIZE, PAGE_SIZE, 100.0f * packStats.occupancy,
+            1000.0 * repackTime, repackStats.pageCount), NX_VEC2(10, 30), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    /* --- Cleanup --- */
+
+    NX_DestroySpriteAtlas(atlas);
+
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        NX_DestroyTexture(textures[i]);
+        NX_DestroyImage(&images[i]);
+    }
+
+    NX_Quit();
+
+    return 0;
+}
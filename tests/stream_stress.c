@@ -0,0 +1,82 @@
+/* stream_stress.c -- Stress benchmark for many concurrent audio streams decoded ahead on the workers
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ *
+ * Plays 64 looping OGG streams with small buffers for a fixed duration, then
+ * stops them and keeps the decode and underrun counters on screen. Run it with SDL_AUDIO_DRIVER=dummy
+ * to measure without an audio device, the mixing is then paced by SDL alone.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define STREAM_COUNT 64
+#define BUFFER_COUNT 3
+#define BUFFER_FRAMES 2048
+#define BENCH_DURATION 10.0
+
+int main(void)
+{
+    NX_Init("Nexium - Stream Stress", 800, 450, 0);
+    NX_AddSearchPath(RESOURCES_PATH, false);
+
+    NX_AudioStream* streams[STREAM_COUNT] = { 0 };
+    for (int i = 0; i < STREAM_COUNT; i++) {
+        streams[i] = NX_LoadAudioStreamEx("audio/sine.ogg", BUFFER_COUNT, BUFFER_FRAMES);
+        NX_SetAudioStreamLoop(streams[i], true);
+    }
+
+    NX_SetAudioVolume(0.05f);
+
+    for (int i = 0; i < STREAM_COUNT; i++) {
+        NX_PlayAudioStream(streams[i]);
+    }
+
+    NX_ResetAudioStreamStats();
+
+    double frameTimeMax = 0.0;
+    bool finished = false;
+
+    while (NX_FrameStep())
+    {
+        double elapsed = NX_MIN(NX_GetElapsedTime(), BENCH_DURATION);
+        double frameTime = 1000.0 * NX_GetDeltaTime();
+
+        /* --- Stop the streams once, the counters then stay as they were at the end --- */
+
+        if (!finished && elapsed >= BENCH_DURATION) {
+            for (int i = 0; i < STREAM_COUNT; i++) {
+                NX_StopAudioStream(streams[i]);
+            }
+            finished = true;
+        }
+
+        if (!finished && frameTime > frameTimeMax && elapsed > 1.0) {
+            frameTimeMax = frameTime;
+        }
+
+        NX_AudioStreamStats stats = NX_GetAudioStreamStats();
+
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_BLACK);
+        NX_DrawRect2D(0, 0, NX_GetWindowWidth(), NX_GetWindowHeight());
+        NX_SetColor2D(stats.underruns > 0 ? NX_RED : NX_GREEN);
+        NX_DrawText2D(CMN_FormatText("Streams: %i / %i - Buffers: %i x %i frames", stats.activeStreams, STREAM_COUNT, BUFFER_COUNT, BUFFER_FRAMES), NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("Decoded buffers: %llu (%.1f/s)", (unsigned long long)stats.decodedBuffers, stats.decodedBuffers / NX_MAX(elapsed, 1e-3)), NX_VEC2(10, 30), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("Underruns: %llu", (unsigned long long)stats.underruns), NX_VEC2(10, 50), 16, NX_VEC2_ONE);
+        NX_DrawText2D(CMN_FormatText("Frame: %.2f ms - Max: %.2f ms", frameTime, frameTimeMax), NX_VEC2(10, 70), 16, NX_VEC2_ONE);
+        NX_DrawText2D(finished ? "Finished" : CMN_FormatText("Time left: %.1f s", BENCH_DURATION - elapsed), NX_VEC2(10, 90), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    for (int i = 0; i < STREAM_COUNT; i++) {
+        NX_DestroyAudioStream(streams[i]);
+    }
+
+    NX_Quit();
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/* text_layout.c -- Draws many static labels from cached text layouts
+ *
+ * Copyright (c) 2025 Le Juez Victor
+ *
+ * This software is provided 'as-is', without any express or implied warranty.
+ * For conditions of distribution and use, see accompanying LICENSE file.
+ *
+ * Every label is shaped once into a layout, then drawn each frame either from
+ * its layout or with NX_DrawText2D. Press SPACE to switch between both and
+ * compare the CPU time spent submitting the text.
+ */
+
+#include <NX/Nexium.h>
+#include "./common.h"
+
+#define LABEL_COUNT 2000
+#define FONT_SIZE 12
+
+int main(void)
+{
+    NX_Init("Nexium - Text Layout", 800, 450, 0);
+
+    /* --- Shape every label once --- */
+
+    static char labels[LABEL_COUNT][64];
+    NX_TextLayout* layouts[LABEL_COUNT];
+
+    for (int i = 0; i < LABEL_COUNT; i++) {
+        snprintf(labels[i], sizeof(labels[i]), "Label %i", i);
+        layouts[i] = NX_CreateTextLayout(NULL, labels[i], FONT_SIZE, NX_VEC2_ZERO, 0.0f);
+    }
+
+    /* --- Main loop --- */
+
+    bool useLayouts = true;
+    double submitTime = 0.0;
+
+    while (NX_FrameStep())
+    {
+        if (NX_IsKeyJustPressed(NX_KEY_SPACE)) {
+            useLayouts = !useLayouts;
+        }
+
+        NX_Begin2D(NULL);
+        NX_SetColor2D(NX_BLACK);
+        NX_DrawRect2D(0, 0, NX_GetWindowWidth(), NX_GetWindowHeight());
+        NX_SetColor2D(NX_WHITE);
+
+        double start = NX_GetCurrentTime();
+
+        for (int i = 0; i < LABEL_COUNT; i++) {
+            NX_Vec2 position = NX_VEC2((i % 50) * 16.0f, 40.0f + (i / 50) * 10.0f);
+            if (useLayouts) {
+                NX_DrawTextLayout2D(layouts[i], position);
+            }
+            else {
+                NX_DrawText2D(labels[i], position, FONT_SIZE, NX_VEC2_ZERO);
+            }
+        }
+
+        submitTime = NX_GetCurrentTime() - start;
+
+        NX_SetColor2D(NX_YELLOW);
+        NX_DrawText2D(CMN_FormatText("%s - Submit: %.3f ms - FPS: %i",
+            useLayouts ? "Layouts" : "NX_DrawText2D", 1000.0 * submitTime, NX_GetFPS()),
+            NX_VEC2(10, 10), 16, NX_VEC2_ONE);
+        NX_End2D();
+    }
+
+    /* --- Cleanup --- */
+
+    for (int i = 0; i < LABEL_COUNT; i++) {
+        NX_DestroyTextLayout(layouts[i]);
+    }
+
+    NX_Quit();
+
+    return 0;
+}